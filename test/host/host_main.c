@@ -0,0 +1,4639 @@
+/***********************************************************************
+*
+*  FILE        : host_main.c
+*  DESCRIPTION : Host runner. Resets the RX231 model, runs the firmware
+*                from PowerON_Reset_PC for a cycle budget and prints a
+*                summary of the final state.
+*
+*  NOTE: Usage: rx231_host [-r resets] [-t cycles] [-q nop_cycles]
+*                          [-a access_cycles] [-T ring_entries]
+*                          [-s samples] [-b ticks] [-l ticks] [-p]
+*                          [-w items] [-d ticks] [-i ticks]
+*                          [-H samples] [-f scopes] [-o updates]
+*                          [-e periods] [-S wraps] [-g]
+*                          [-n trials] [-B] [-C trials] [-D trials]
+*                          [-u trials] [-m trials] [-k trials]
+*                          [-R trials] [-z] [-c]
+*        -a and -T need the firmware built with 'make TRACE=1'. -a lets
+*        time pass at every register access; -T prints the register
+*        access trace of the last run.
+*        -s checks R_Config_CMT0_GetTicks64()/GetTimeNs() after the last
+*        run against the CMT0 model, with compare matches placed just
+*        before and inside each call and interrupts masked at random.
+*        -b runs the r_timer wheel for the given number of ticks with
+*        10, 100, 1000 and 10000 periodic timers and prints the host
+*        time per tick, which should not grow with the timer count,
+*        then runs a timer set up with R_TIMER_Init() from a block that
+*        was never zeroed.
+*        -l runs a sparse timer load for the given number of ticks, once
+*        with a CMT0 interrupt per tick and once tickless, and prints
+*        the interrupts taken and the timekeeping and expiry errors; a
+*        delay of 2^31 - 1 must be refused while the wheel is behind.
+*        -p checks the CMT period solver in r_cg_cmt.h against an
+*        exhaustive search for every PCLKB the RX231 clock tree can
+*        produce and periods from 1 us to 10 s.
+*        -w passes the given number of items through an r_workq queue
+*        from a host thread standing in for the interrupt to the main
+*        thread, and prints the throughput, the cost of a post and the
+*        post-to-handler latency.
+*        -d checks the r_sched dispatch order and prints the host time
+*        per post and dispatch, then runs always-ready load tasks for
+*        the given number of CMT0 ticks and prints how late a higher
+*        priority task posted from each tick starts.
+*        -i checks the r_idle mode selection and a software standby
+*        woken by a simulated IRQ0, then runs the scheduler with a
+*        short task per CMT0 tick for the given number of ticks and
+*        compares the time r_idle accounts as asleep and awake with
+*        the model.
+*        -H checks the r_lathist bins and percentiles against a sorted
+*        reference and prints the cost of a sample, then takes the
+*        given number of CMT0 latency samples from WAIT and from a
+*        busy loop of long nops, and checks them against the bounds
+*        the model gives.
+*        -f checks the r_profile table over the given number of scopes
+*        timed by a simulated clock, including nested scopes and clock
+*        wrap-around, and prints the cost of a scope; then it times
+*        nop loops up to a few CMT1 wraps long, some with interrupts
+*        masked, with R_Config_CMT1_GetCount32() against the model.
+*        -o checks r_port updates and, in TRACE=1 builds, counts their
+*        PORTD register accesses against LED bitfield toggles; then it
+*        makes the given number of LED0 updates from the main loop
+*        while a simulated IRQ1 toggles LED1, once with r_port and once
+*        with PODR byte read-modify-writes, and counts the updates
+*        lost. The latter can only be lost with -a, which lets the
+*        interrupt in between the read and the write of PODR.
+*        -e checks the Config_ELC/Config_TMR0 event link, then runs for
+*        the given number of TMR0 periods with interrupts masked and
+*        checks that the ELC toggles PB0 once per period, and not at
+*        all while the link is disabled.
+*        -S checks the r_dtcseq transfer information builder, then
+*        replays sequences of 2, 37 and 256 random steps from CMT2
+*        through the DTC model for the given number of table wraps
+*        with interrupts masked, and checks each PORTD output and
+*        step length, that the CPU takes no CMT2 interrupt and that
+*        PORTD holds still after R_DTCSEQ_Stop().
+*        -g runs each r_pin pin and group operation on PORTA and
+*        checks the port registers after it and, in TRACE=1 builds,
+*        its exact sequence of register accesses.
+*        -n runs bsp_non_existent_port_init() as built for each RX231
+*        package on the given number of random PDR states and checks
+*        that it sets exactly the missing pins of the package; in
+*        TRACE=1 builds it prints the register accesses it makes and
+*        checks that each is a byte access.
+*        -B boots through PowerON_Reset_PC with a HOCO wait, prints
+*        the r_boottime timeline and checks that every stage was
+*        marked, at the PCLKB the model ran, and that the stages add
+*        up to the CMT3 counts of the model; then boots again with a
+*        HOCO wait over two CMT3 turns and checks that the record is
+*        saturated and misses only whole turns.
+*        -C checks the r_clock registry against the model and against
+*        get_iclk_freq_hz() for every clock source setting with every
+*        pair of divider values (every divider combination for the
+*        LOCO), then makes the given number of random R_CLOCK_Switch()
+*        calls and checks the result, the registry, the clocks left
+*        alone on a refusal and the subscribers called; it prints the
+*        cost of an ICLK read both ways and checks that
+*        R_BSP_SoftwareDelay() follows each switch.
+*        -D checks the loop count of R_BSP_SoftwareDelay() against the
+*        division it replaced for every ICLK the clock sources and
+*        the ICLK divider give, in each unit, at the edges of one loop
+*        and of 2^32 loops and for the given number of random delays
+*        per ICLK and unit; it must match or run one loop short. It
+*        also checks the constant loop count of R_BSP_SOFTWARE_DELAY()
+*        at BSP_ICLK_HZ and its fallback at other clocks.
+*        -u checks r_deadline on a simulated clock at several rates:
+*        the given number of random deadlines, many of them across
+*        the wrap-around, must expire neither early nor more than one
+*        count late and stay expired, and delays started together and
+*        from their callbacks, some cancelled, must each run once on
+*        time when polled at random intervals; deadlines set before
+*        and after an R_DEADLINE_SetRate() to a random other rate must
+*        also expire neither early nor more than a few counts late. It
+*        prints the cost of a poll with one and with many delays
+*        pending, then times deadlines and delays on CMT1 across its
+*        wraps against the model.
+*        -m makes the given number of random R_CLOCK_SetPerformance()
+*        calls, some invalid and some with their source stopped, and
+*        checks the result, that a refusal leaves the registers alone,
+*        and after a switch the registry, the operating mode and wait
+*        states (the slowest the clock allows, never broken on the way),
+*        the PLL stopped when unused and the CMT0 period solved again
+*        for the new PCLKB; with random dwells in between, CMT0 time
+*        and the r_timer ticks must follow the model across them all,
+*        and a deadline on CMT1 set before each call must expire
+*        neither early nor later than the call and a count allow.
+*        -k runs the staged clock bring-up of r_clkstage for the HOCO,
+*        main clock and PLL sources with random oscillator
+*        stabilization times and start-up work for the given number
+*        of trials, once switching the clock first and once after the
+*        work, and checks that the clock is never switched to an
+*        unstable oscillator, that each switch follows its oscillator
+*        by at most a poll, and that the work hides the wait whenever
+*        it fits in it; it prints the time to the end of the work both
+*        ways, then boots with slow oscillators.
+*        -R simulates the given number of resets of random causes, some
+*        after the RETAIN section was changed without a seal, and
+*        checks that R_RETAIN_Open() keeps the section after exactly
+*        the sealed software and watchdog resets and clears it after
+*        the others; then it boots after a watchdog reset and after
+*        R_RETAIN_Reset() and checks that the section was kept and
+*        that the reset was write-enabled through the BSP's register
+*        protection count. Part of the section is a BRETAIN_1, as
+*        CC-RX makes for byte variables.
+*        -z round-trips data of several kinds through the zsect LZ4
+*        compressor and R_INITSCT_Unpack(), checks that damaged
+*        streams are rejected without writing outside the area,
+*        prints the ratio and the pack and unpack speed against a
+*        plain copy, and runs R_INITSCT_Run() on a C$ZSEC table, which
+*        must not copy a D section it unpacks.
+*        -c checks the r_initsct copy and clear for every source and
+*        destination alignment and lengths across several words,
+*        prints their speed against byte loops, and runs
+*        R_INITSCT_Run() on the host section tables. It runs last, as
+*        it clears the firmware's data.
+*
+***********************************************************************/
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <getopt.h>
+#include <pthread.h>
+#include <sched.h>
+#include "platform.h"
+#include "rx_host.h"
+#include "rx_host_trace.h"
+#include "Config_CMT0.h"
+#include "Config_CMT1.h"
+#include "Config_CMT2.h"
+#include "Config_TMR0.h"
+#include "Config_ELC.h"
+#include "r_timer.h"
+#include "r_workq.h"
+#include "r_sched.h"
+#include "r_idle.h"
+#include "r_lathist.h"
+#include "r_profile.h"
+#include "r_port.h"
+#include "r_dtcseq.h"
+#include "r_boottime.h"
+#include "r_initsct.h"
+#include "r_retain.h"
+#include "r_clkstage.h"
+#include "r_clock.h"
+#include "r_deadline.h"
+#include "r_cg_userdefine.h"
+#include "tools/lz4_pack.h"
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* Default budget: 2 seconds of ICLK at 54 MHz, enough for four CMT0 compare matches. */
+#define HOST_DEFAULT_CYCLES     (108000000ULL)
+
+/* Budget for host-driven checks; they end on their own. */
+#define HOST_CHECK_CYCLES       (1ULL << 62)
+
+/* Timer wheel benchmark: largest timer count. Periods are 1 to 4 times the timer count so that about the same number
+   of timers expire per tick at every count. */
+#define HOST_BENCH_TIMERS_MAX   (10000U)
+
+/* Period solver check: tolerance passed to CMT_PERIOD_VALID, and PCLKB limit. */
+#define HOST_PERIOD_PPM         (1000U)
+#define HOST_PCLKB_MAX_HZ       (32000000UL)
+#define HOST_PERIOD_STEPS       (5U * 8U)
+
+/* Work queue benchmark: queue size, items drained per call, and post time stamps kept (the producer writes the stamp
+   of an item up to a queue ahead of the one being handled). */
+#define HOST_WORKQ_SIZE         (256U)
+#define HOST_WORKQ_BATCH        (32U)
+#define HOST_WORKQ_STAMPS       (2U * HOST_WORKQ_SIZE)
+
+/* Scheduler benchmark: dispatch rounds, probe and load task priorities, and the nop cycles and most nops of a load
+   task run, which bound the start latency of the probe. */
+#define HOST_SCHED_ROUNDS       (100000U)
+#define HOST_SCHED_PROBE        (1U)
+#define HOST_SCHED_LOAD_FIRST   (8U)
+#define HOST_SCHED_LOADS        (8U)
+#define HOST_SCHED_NOP_CYCLES   (10000U)
+#define HOST_SCHED_LOAD_NOPS    (20U)
+
+/* Idle check: standby length, task priority, and the cycles the model charges per interrupt, which r_idle counts as
+   asleep or awake depending on where the interrupt is taken. */
+#define HOST_STANDBY_CYCLES     (5000000U)
+#define HOST_IDLE_TASK          (1U)
+#define HOST_IDLE_SLACK         (RX_HOST_INT_ENTRY_CYCLES + RX_HOST_INT_EXIT_CYCLES + (256U * g_rx_host_access_cycles))
+
+/* Latency check: synthetic samples, and the nop length of the busy loop (prime, so that compare matches fall at
+   varying points of a nop). */
+#define HOST_LATENCY_SAMPLES    (1000000U)
+#define HOST_LATENCY_NOP_CYCLES (99991U)
+
+/* Profiling check: sites used, CMT1 scopes, and the longest nop loop in them. Loops timed with interrupts masked are
+   kept below half a CMT1 wrap, as R_Config_CMT1_GetCount32() requires. */
+#define HOST_PROFILE_SITES      (8U)
+#define HOST_PROFILE_CMT1_RUNS  (200U)
+#define HOST_PROFILE_NOPS       (50000U)
+#define HOST_PROFILE_MASKED_NOPS (4000U)
+#define HOST_PROFILE_SLACK      (2U)
+
+/* Port check: most ICLK cycles between simulated IRQ1 requests. */
+#define HOST_PORT_IRQ_SPACING   (64U)
+
+/* ELC check: nop length while PB0 is sampled, and the ICLK cycles in a TMR0/TMR1 period. */
+#define HOST_ELC_NOP_CYCLES     (10007U)
+#define HOST_ELC_PERIOD_CYCLES  (((uint64_t)TMR01_COUNT_CLOCK_DIVISOR * (TMR01_TCORA_VALUE + 1U) * \
+                                  rx_host_clock_hz(RX_HOST_CLOCK_ICLK)) / rx_host_clock_hz(RX_HOST_CLOCK_PCLKB))
+
+/* DTC sequencer check: longest random step as a CMCOR value, nop length while PORTD is sampled, and the ICLK cycles
+   in a step. */
+#define HOST_DTCSEQ_CMCOR_MAX   (200U)
+#define HOST_DTCSEQ_NOP_CYCLES  (7U)
+#define HOST_DTCSEQ_STEP_CYCLES(cmcor)  (((uint64_t)((cmcor) + 1U) * CMT2_COUNT_CLOCK_DIVISOR * \
+                                          rx_host_clock_hz(RX_HOST_CLOCK_ICLK)) / rx_host_clock_hz(RX_HOST_CLOCK_PCLKB))
+
+/* Pin check: PORTA register values before each operation (PIDR is read-only on the MCU, plain memory in the model),
+   and the most register accesses of one operation. */
+#define HOST_PIN_PODR           (0xA5U)
+#define HOST_PIN_PMR            (0x5AU)
+#define HOST_PIN_PDR            (0xA5U)
+#define HOST_PIN_DSCR           (0xA5U)
+#define HOST_PIN_PIDR           (0x5AU)
+#define HOST_PIN_ACCESSES_MAX   (8U)
+
+/* Non-existent port check: PDR bytes from PORT0.PDR to PORTJ.PDR, and the ports among them. */
+#define HOST_NE_PDRS            (0x13U)
+#define HOST_NE_PORTS           (12U)
+
+/* Boot timeline check (-B): the HOCO stabilization time of a normal boot and of one over two CMT3 turns at the LOCO
+   (131 ms each), the cycles PowerON_Reset_PC is given and the counts of a turn. */
+#define HOST_BOOT_HOCO_US       (2000U)
+#define HOST_BOOT_LONG_HOCO_US  (300000U)
+#define HOST_BOOT_CYCLES        (5400000U)
+#define HOST_BOOT_TURN          (0x10000ULL)
+
+/* Section initialization check: alignments and lengths tried, guard bytes around each area, and the area timed. */
+#define HOST_INITSCT_ALIGNS     (8U)
+#define HOST_INITSCT_LENGTHS    (80U)
+#define HOST_INITSCT_GUARD      (16U)
+#define HOST_INITSCT_BENCH      (64U * 1024U)
+#define HOST_INITSCT_RUNS       (8U)
+#define HOST_INITSCT_FILL       (0xEEU)
+
+/* Packed initial data check (-z) */
+#define HOST_ZSECT_MAX          (64U * 1024U)
+#define HOST_ZSECT_SMALL        (40U)
+#define HOST_ZSECT_DAMAGED      (2000U)
+#define HOST_ZSECT_RUN          (4096U)
+#define HOST_ZSECT_UNMAPPED     (0x10U)
+
+/* Clock registry check (-C): SCKCR divider field values, PLL multiplier settings, the delay timed after each switch
+   and its tolerance in ICLK cycles, and the reads timed. */
+#define HOST_CLOCK_DIVS         (7U)
+#define HOST_CLOCK_STC_MIN      (7U)
+#define HOST_CLOCK_STC_MAX      (26U)
+#define HOST_CLOCK_DELAY_US     (500U)
+#define HOST_CLOCK_DELAY_SLACK  (16U)
+#define HOST_CLOCK_READS        (1000000UL)
+
+/* Software delay check (-D): the delay of the compile-time path, and the loop counts drawn either side of the edges
+   of a delay (one loop, and the 2^32 loops delayWait() takes). */
+#define HOST_DELAY_CONST_US     (500U)
+#define HOST_DELAY_EDGE         (3U)
+
+/* Deadline check (-u): delays made per clock rate in the async run, CMT1 runs and their longest deadline, the
+   delays pending in the poll benchmark and the polls timed. */
+#define HOST_DEADLINE_DELAYS    (64U)
+#define HOST_DEADLINE_CMT1_RUNS (40U)
+#define HOST_DEADLINE_CMT1_US   (40000U)
+#define HOST_DEADLINE_PENDING   (1000U)
+#define HOST_DEADLINE_POLLS     (1000000UL)
+#define HOST_DEADLINE_STEP      (0x40000000UL)
+
+/* Performance level check (-m): stabilization times, nops per second while dwelling (a nop takes ICLK cycles, so at
+   the sub-clock a fixed count would outlast a tick), the longest dwell, and the time CMT0 may gain or lose besides a
+   count clock per restart. */
+#define HOST_PERF_HOCO_US       (50U)
+#define HOST_PERF_MAIN_US       (1000U)
+#define HOST_PERF_PLL_US        (100U)
+#define HOST_PERF_NOPS_PER_S    (1000U)
+#define HOST_PERF_DWELL_MS      (1200U)
+#define HOST_PERF_SLACK_NS      (20000U)
+#define HOST_PERF_DEADLINE_US   (100000U)
+
+/* Staged clock check (-k): stabilization times and start-up work drawn per trial, the work between polls and the
+   time a switch may take after both are over. */
+#define HOST_CLKSTAGE_HOCO_US   (50U)
+#define HOST_CLKSTAGE_MAIN_US   (1000U)
+#define HOST_CLKSTAGE_PLL_US    (100U)
+#define HOST_CLKSTAGE_SPREAD    (4U)
+#define HOST_CLKSTAGE_WORK      (8000U)
+#define HOST_CLKSTAGE_POLL_NOPS (256U)
+#define HOST_CLKSTAGE_SLACK_NS  (20000U)
+#define HOST_CLKSTAGE_LOCO_HZ   (4000000U)
+#define HOST_CLKSTAGE_BOOT_CYCLES (5400000U)
+
+/* Retained data check (-R) */
+#define HOST_RETAIN_SIZE        (256U)
+#define HOST_RETAIN_1_SIZE      (7U)
+#define HOST_RETAIN_BOOT_CYCLES (5400000U)
+
+/* Tickless check: ICLK cycles in two CMT0 ticks. */
+#define HOST_IDLE_SPREAD_CYCLES    ((2ULL * (CMT0_CMCOR_VALUE + 1U) * CMT0_COUNT_CLOCK_DIVISOR * \
+                                  rx_host_clock_hz(RX_HOST_CLOCK_ICLK)) / rx_host_clock_hz(RX_HOST_CLOCK_PCLKB))
+
+/***********************************************************************************************************************
+Private global variables and functions
+***********************************************************************************************************************/
+extern void PowerON_Reset_PC(void);
+
+static unsigned long s_samples;
+static unsigned long s_sample_errors;
+static unsigned long s_sample_pending;
+
+static unsigned long s_bench_ticks;
+static unsigned long s_bench_errors;
+static uint64_t      s_bench_expiries;
+static r_timer_t     s_bench_timers[HOST_BENCH_TIMERS_MAX];
+static uint32_t      s_bench_due[HOST_BENCH_TIMERS_MAX];
+
+static bool          s_period_check;
+static unsigned long s_period_errors;
+
+static unsigned long  s_workq_items;
+static unsigned long  s_workq_errors;
+static unsigned long  s_workq_handled;
+static unsigned long  s_workq_full;
+static double         s_workq_post_ns;
+static uint64_t       s_workq_posted_at[HOST_WORKQ_STAMPS];
+static uint32_t       *s_workq_latency;
+static r_workq_t      s_workq;
+static r_workq_item_t s_workq_storage[HOST_WORKQ_SIZE];
+
+static unsigned long s_sched_ticks;
+static unsigned long s_sched_errors;
+static uint32_t      s_sched_last;
+static uint64_t      s_sched_dispatched;
+static uint64_t      s_sched_posted_at;
+static unsigned long s_sched_posts;
+static unsigned long s_sched_probes;
+static uint64_t      s_sched_latency_min;
+static uint64_t      s_sched_latency_max;
+static uint64_t      s_sched_latency_sum;
+static r_timer_t     s_sched_timer;
+
+static unsigned long s_power_ticks;
+static unsigned long s_power_errors;
+static unsigned long s_power_runs;
+static uint64_t      s_power_work;
+static uint64_t      s_power_cycles;
+static uint64_t      s_power_sleep;
+static uint32_t      s_power_nop_cycles;
+static unsigned long s_power_irqs;
+static r_timer_t     s_power_timer;
+
+static unsigned long s_latency_samples;
+static unsigned long s_latency_errors;
+static uint32_t      *s_latency_sorted;
+
+static unsigned long  s_profile_scopes;
+static unsigned long  s_profile_errors;
+static uint32_t       s_profile_now;
+static profile_site_t s_profile_expected[HOST_PROFILE_SITES];
+
+extern volatile bool     g_host_port_direct;
+extern volatile bool     g_host_port_led1;
+extern volatile uint32_t g_host_port_lost;
+extern volatile uint32_t g_host_port_irqs;
+extern volatile uint32_t g_host_port_spacing;
+extern void host_port_toggle_leds(void);
+extern void host_port_toggle_led0(void);
+
+static unsigned long s_port_updates;
+static unsigned long s_port_errors;
+
+static unsigned long s_elc_periods;
+static unsigned long s_elc_errors;
+
+/* Sequence tables are read by the DTC model through 32-bit addresses, so they are static. */
+static unsigned long s_dtcseq_wraps;
+static unsigned long s_dtcseq_errors;
+static uint8_t       s_dtcseq_podr[DTCSEQ_STEPS_MAX];
+static uint16_t      s_dtcseq_cmcor[DTCSEQ_STEPS_MAX];
+
+extern volatile uint8_t g_host_pin_level;
+extern void host_pin_set(void);
+extern void host_pin_clear(void);
+extern void host_pin_write(void);
+extern void host_pin_toggle(void);
+extern void host_pin_read(void);
+extern void host_pin_output(void);
+extern void host_pin_input(void);
+extern void host_pin_peripheral(void);
+extern void host_pin_drive(void);
+extern void host_pin_group_set(void);
+extern void host_pin_group_clear(void);
+extern void host_pin_group_write(void);
+extern void host_pin_group_toggle(void);
+extern void host_pin_group_output(void);
+extern void host_pin_group_input(void);
+extern void host_pin_group_peripheral(void);
+extern void host_pin_group_drive(void);
+extern void host_pin_full_output(void);
+extern void host_pin_full_toggle(void);
+
+static bool          s_pin_check;
+static unsigned long s_pin_errors;
+
+extern void host_non_existent_port_init_100(void);
+extern void host_non_existent_port_init_64(void);
+extern void host_non_existent_port_init_48(void);
+
+static unsigned long s_ne_trials;
+static unsigned long s_ne_errors;
+
+static bool          s_boot_check;
+static unsigned long s_boot_errors;
+
+static bool          s_initsct_check;
+static unsigned long s_initsct_errors;
+
+/* Retained data of the check, in the firmware's RETAIN section. */
+static uint8_t       s_retained[HOST_RETAIN_SIZE] __attribute__((section("rx_retain")));
+static uint8_t       s_retained_expected[HOST_RETAIN_SIZE];
+
+/* Its BRETAIN_1, which the host has no section for. */
+static uint8_t       s_retained_1[HOST_RETAIN_1_SIZE];
+static uint8_t       s_retained_1_expected[HOST_RETAIN_1_SIZE];
+
+extern uint32_t get_iclk_freq_hz(void);
+
+static unsigned long      s_clock_trials;
+static unsigned long      s_clock_errors;
+static unsigned long      s_clock_notified[2];
+static uint32_t           s_clock_changed[2];
+static uint32_t           s_clock_before[2];    /* Mask of the call before the switch */
+static unsigned long      s_clock_order;        /* Subscriber numbers in call order, as bits after a 1 */
+static clock_subscriber_t s_clock_subscribers[2];
+
+/* Clock source settings of the -C and -D checks: CKSEL, HOCOCR2.HCFRQ and PLLCR.PLIDIV; the PLL also takes every
+   multiplier from HOST_CLOCK_STC_MIN to HOST_CLOCK_STC_MAX. */
+static const uint8_t s_clock_sources[][3] =
+{
+    { 0U, 0U, 0U }, { 1U, 0U, 0U }, { 1U, 3U, 0U }, { 2U, 0U, 0U }, { 3U, 0U, 0U }, { 4U, 0U, 0U },
+    { 4U, 0U, 1U }, { 4U, 0U, 2U }
+};
+
+static unsigned long      s_deadline_trials;
+static unsigned long      s_deadline_errors;
+static uint32_t           s_deadline_now;
+static uint32_t           s_deadline_hz;
+static uint32_t           s_deadline_poll;      /* Clock of the previous R_DEADLINE_Poll() */
+static uint32_t           s_deadline_rearms;       /* Delays the callbacks may still start */
+static uint32_t           s_deadline_pending;
+static uint32_t           s_deadline_armed[HOST_DEADLINE_DELAYS];
+static uint32_t           s_deadline_start[HOST_DEADLINE_DELAYS];
+static uint32_t           s_deadline_expected[HOST_DEADLINE_DELAYS];
+static uint32_t           s_deadline_ran[HOST_DEADLINE_DELAYS];
+static deadline_delay_t   s_deadline_delays[HOST_DEADLINE_PENDING];
+
+static unsigned long      s_perf_trials;
+static unsigned long      s_perf_errors;
+
+static unsigned long      s_delay_trials;
+static unsigned long      s_delay_errors;
+static unsigned long      s_delay_exact;
+static unsigned long      s_delay_short;
+
+extern void             host_clkstage_pll_start(void);
+extern clkstage_state_t host_clkstage_pll_poll(void);
+extern void             host_clkstage_pll_finish(void);
+extern void             host_clkstage_main_start(void);
+extern clkstage_state_t host_clkstage_main_poll(void);
+extern void             host_clkstage_main_finish(void);
+
+/* One clock source of the -k check, with the r_clkstage.c built for it. */
+typedef struct
+{
+    const char       *name;
+    void             (*start)(void);
+    clkstage_state_t (*poll)(void);
+    void             (*finish)(void);
+    uint32_t         cksel;
+    uint32_t         iclk_hz;
+} host_clkstage_t;
+
+static unsigned long         s_clkstage_trials;
+static unsigned long         s_clkstage_errors;
+static const host_clkstage_t *s_clkstage;
+static bool                  s_clkstage_staged;
+static uint32_t              s_clkstage_work;
+static uint64_t              s_clkstage_start_ns;
+static uint64_t              s_clkstage_switch_ns;
+static uint64_t              s_clkstage_work_ns;
+
+static unsigned long s_retain_trials;
+static unsigned long s_retain_errors;
+
+static bool          s_zsect_check;
+static unsigned long s_zsect_errors;
+
+static unsigned long s_idle_ticks;
+static unsigned long s_idle_errors;
+static uint64_t      s_idle_time_error;
+static uint64_t      s_idle_expiry_error;
+
+static void usage(const char *name)
+{
+    fprintf(stderr, "usage: %s [-r resets] [-t cycles] [-q nop_cycles] [-a access_cycles] [-T ring_entries] "
+            "[-s samples] [-b ticks] [-l ticks] [-p] [-w items] [-d ticks] [-i ticks] [-H samples] [-f scopes] "
+            "[-o updates] [-e periods] [-S wraps] [-g] [-n trials] [-B] [-C trials] [-D trials] [-u trials] "
+            "[-m trials] [-k trials] [-R trials] [-z] [-c]\n", name);
+    exit(EXIT_FAILURE);
+}
+
+/* Exact count clocks to nanoseconds, the reference for R_Config_CMT0_GetTimeNs() (which may be 1 ns lower). */
+static uint64_t ticks_to_ns(uint64_t ticks)
+{
+    return (uint64_t)(((unsigned __int128)ticks * 1000000000U * CMT0_COUNT_CLOCK_DIVISOR) /
+                      rx_host_clock_hz(RX_HOST_CLOCK_PCLKB));
+}
+
+static void check_timestamps(void)
+{
+    uint64_t      last = 0;
+    uint64_t      before;
+    uint64_t      after;
+    uint64_t      ticks;
+    uint64_t      ns;
+    uint64_t      to_match;
+    uint64_t      lead;
+    uint32_t      window = (64U * g_rx_host_access_cycles) + 64U;
+    unsigned long i;
+
+    srand(1);
+    for (i = 0; i < s_samples; i++)
+    {
+        /* Mask interrupts in half of the samples so that a compare match stays pending during the call. */
+        if (0 != (rand() & 1))
+        {
+            clrpsw_i();
+        }
+
+        /* Place the next compare match a random number of cycles before or into the call. */
+        to_match = rx_host_cmt_cycles_to_match(0);
+        lead = (uint64_t)rand() % window;
+        while (to_match > (lead + UINT32_MAX))
+        {
+            rx_host_advance(UINT32_MAX);
+            to_match -= UINT32_MAX;
+        }
+        rx_host_advance((uint32_t)((to_match > lead) ? (to_match - lead) : 0));
+        if (1 == IR(CMT0, CMI0))
+        {
+            s_sample_pending++;
+        }
+
+        before = rx_host_cmt_counts(0);
+        ticks = R_Config_CMT0_GetTicks64();
+        after = rx_host_cmt_counts(0);
+        if ((ticks < before) || (ticks > after) || (ticks < last))
+        {
+            s_sample_errors++;
+        }
+        last = ticks;
+
+        before = rx_host_cmt_counts(0);
+        ns = R_Config_CMT0_GetTimeNs();
+        after = rx_host_cmt_counts(0);
+        if (((ns + 1U) < ticks_to_ns(before)) || (ns > ticks_to_ns(after)))
+        {
+            s_sample_errors++;
+        }
+
+        setpsw_i();
+    }
+}
+
+/* Counts an expiry and checks that it came on the tick it was due. */
+static void bench_expired(void *p_context)
+{
+    uint32_t index = (uint32_t)(uintptr_t)p_context;
+    uint32_t late = R_TIMER_GetTicks() - s_bench_due[index];
+
+    if (0U != late)
+    {
+        s_bench_errors++;
+    }
+    s_bench_due[index] += s_bench_timers[index].period;
+    s_bench_expiries++;
+}
+
+/* Counts the expiries of a one-shot timer. */
+static void bench_once(void *p_context)
+{
+    (*(uint32_t *)p_context)++;
+}
+
+static void bench_timers(void)
+{
+    static const uint32_t s_counts[] = {10U, 100U, 1000U, HOST_BENCH_TIMERS_MAX};
+    r_timer_t             timer;
+    uint32_t              once = 0U;
+    struct timespec       t0;
+    struct timespec       t1;
+    double                elapsed;
+    uint32_t              period;
+    uint32_t              n;
+    uint32_t              i;
+    unsigned long         tick;
+
+    /* The wheel is ticked here rather than from the CMT0 interrupt, so delays count from R_TIMER_GetTicks(). */
+    clrpsw_i();
+    R_TIMER_SetIdleHook(NULL);
+    srand(1);
+
+    for (n = 0; n < (sizeof(s_counts) / sizeof(s_counts[0])); n++)
+    {
+        R_TIMER_Open();
+        for (i = 0; i < s_counts[n]; i++)
+        {
+            period = s_counts[n] + ((uint32_t)rand() % (3U * s_counts[n]));
+            s_bench_due[i] = 1U + ((uint32_t)rand() % period);
+            (void)R_TIMER_Init(&s_bench_timers[i]);
+            R_TIMER_Start(&s_bench_timers[i], s_bench_due[i], period, bench_expired, (void *)(uintptr_t)i);
+        }
+
+        s_bench_expiries = 0;
+        clock_gettime(CLOCK_MONOTONIC, &t0);
+        for (tick = 0; tick < s_bench_ticks; tick++)
+        {
+            R_TIMER_Tick();
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        elapsed = (double)(t1.tv_sec - t0.tv_sec) + ((double)(t1.tv_nsec - t0.tv_nsec) / 1e9);
+
+        printf("timer wheel     : %5lu timers, %6.1f ns/tick, %.3f expiries/tick\n", (unsigned long)s_counts[n],
+               (elapsed * 1e9) / s_bench_ticks, (double)s_bench_expiries / s_bench_ticks);
+    }
+
+    /* A timer on the stack that was never zeroed, with links that point anywhere until R_TIMER_Init(). */
+    memset(&timer, 0xA5, sizeof(timer));
+    if ((TIMER_SUCCESS != R_TIMER_Init(&timer)) || (true == R_TIMER_IsActive(&timer)) ||
+        (TIMER_ERR_NOT_ACTIVE != R_TIMER_Cancel(&timer)) ||
+        (TIMER_SUCCESS != R_TIMER_Start(&timer, 3U, 0U, bench_once, &once)))
+    {
+        s_bench_errors++;
+    }
+    for (tick = 0; tick < 3U; tick++)
+    {
+        R_TIMER_Tick();
+    }
+    if ((1U != once) || (true == R_TIMER_IsActive(&timer)))
+    {
+        s_bench_errors++;
+    }
+    R_TIMER_Open();
+}
+
+/* Checks that a timer callback runs on its tick, and records how long after the tick boundary it ran. */
+static void idle_expired(void *p_context)
+{
+    uint32_t index = (uint32_t)(uintptr_t)p_context;
+    uint64_t late = R_Config_CMT0_GetTicks64() - ((uint64_t)s_bench_due[index] * (CMT0_CMCOR_VALUE + 1U));
+
+    if (R_TIMER_GetTicks() != s_bench_due[index])
+    {
+        s_idle_errors++;
+    }
+    s_idle_expiry_error = (late > s_idle_expiry_error) ? late : s_idle_expiry_error;
+    s_bench_due[index] += s_bench_timers[index].period;
+
+    /* Timer 0 is a one-shot restarted with a varying delay from its callback; the last one is restarted by
+       check_idle(). */
+    if (0 == index)
+    {
+        s_bench_due[0] = R_TIMER_GetTicks() + 1U + (s_bench_due[0] % 11U);
+        R_TIMER_Start(&s_bench_timers[0], s_bench_due[0] - R_TIMER_GetTicks(), 0, idle_expired, p_context);
+    }
+}
+
+static void check_idle(bool tickless)
+{
+    static const uint32_t s_periods[] = {0U, 3U, 7U, 50U, 1000U, 0U};
+    uint32_t              wakeups = rx_host_vector_accepted(VECT_CMT0_CMI0);
+    uint32_t              start;
+    uint64_t              ticks;
+    uint64_t              counts;
+    uint64_t              lead;
+    uint64_t              to_match;
+    r_timer_t             spare;
+    uint32_t              behind;
+    timer_err_t           err;
+    uint32_t              i;
+
+    R_Config_CMT0_SetTickless(tickless);
+    (void)R_TIMER_Init(&spare);
+    srand(1);
+    start = R_TIMER_GetTicks();
+    for (i = 0; i < (sizeof(s_periods) / sizeof(s_periods[0])); i++)
+    {
+        s_bench_due[i] = start + 1U + i;
+        (void)R_TIMER_Init(&s_bench_timers[i]);
+        R_TIMER_Start(&s_bench_timers[i], 1U + i, s_periods[i], idle_expired, (void *)(uintptr_t)i);
+    }
+
+    while ((R_TIMER_GetTicks() - start) < s_idle_ticks)
+    {
+        wait();
+
+        /* Let a random part of the next interval pass, so that the thread restarts its timer mid-interval. */
+        lead = (uint64_t)rand() % HOST_IDLE_SPREAD_CYCLES;
+        to_match = rx_host_cmt_cycles_to_match(0);
+        rx_host_advance((uint32_t)((lead < to_match) ? lead : (to_match - 1U)));
+
+        /* Timekeeping against the CMT0 model, in count clocks. */
+        clrpsw_i();
+        ticks = R_Config_CMT0_GetTicks64();
+        counts = rx_host_cmt_pclkb(0) / CMT0_COUNT_CLOCK_DIVISOR;
+        if (false == R_TIMER_IsActive(&s_bench_timers[i - 1U]))
+        {
+            /* The delay counts from the current tick, which the wheel may not have reached while tickless. */
+            s_bench_due[i - 1U] = (uint32_t)(ticks / (CMT0_CMCOR_VALUE + 1U)) + 1U + ((uint32_t)ticks % 5U);
+            R_TIMER_Start(&s_bench_timers[i - 1U], 1U + ((uint32_t)ticks % 5U), 0, idle_expired,
+                          (void *)(uintptr_t)(i - 1U));
+        }
+
+        /* The longest delay is refused once the ticks the wheel is behind would take it past 2^31 - 1. */
+        behind = (uint32_t)(ticks / (CMT0_CMCOR_VALUE + 1U)) - R_TIMER_GetTicks();
+        err = R_TIMER_Start(&spare, INT32_MAX, 0, idle_expired, NULL);
+        if ((0U != behind) ? ((TIMER_ERR_INVALID_ARG != err) || (true == R_TIMER_IsActive(&spare))) :
+            ((TIMER_SUCCESS != err) || (TIMER_SUCCESS != R_TIMER_Cancel(&spare))))
+        {
+            s_idle_errors++;
+        }
+        setpsw_i();
+        counts = (ticks > counts) ? (ticks - counts) : (counts - ticks);
+        s_idle_time_error = (counts > s_idle_time_error) ? counts : s_idle_time_error;
+    }
+
+    for (i = 0; i < (sizeof(s_periods) / sizeof(s_periods[0])); i++)
+    {
+        R_TIMER_Cancel(&s_bench_timers[i]);
+    }
+    R_Config_CMT0_SetTickless(false);
+
+    wakeups = rx_host_vector_accepted(VECT_CMT0_CMI0) - wakeups;
+    printf("%-16s: %lu ticks, %lu interrupts (%.3f per tick), timekeeping error %llu, expiry error %llu counts\n",
+           (true == tickless) ? "tickless" : "periodic", s_idle_ticks, (unsigned long)wakeups,
+           (double)wakeups / s_idle_ticks, (unsigned long long)s_idle_time_error,
+           (unsigned long long)s_idle_expiry_error);
+}
+
+static void check_periodic(void)
+{
+    check_idle(false);
+}
+
+static void check_tickless(void)
+{
+    check_idle(true);
+}
+
+/* Best CKS and count clocks for a period by trying both roundings at every CKS; false if none fits. */
+static bool period_reference(uint64_t us, uint64_t hz, uint32_t *p_cks, uint64_t *p_counts, uint64_t *p_error)
+{
+    uint64_t target = us * hz;
+    uint64_t scale;
+    uint64_t counts;
+    uint64_t actual;
+    uint64_t error;
+    uint32_t cks;
+    uint32_t k;
+    bool     found = false;
+
+    for (cks = 0; cks < 4; cks++)
+    {
+        scale = (8ULL << (2U * cks)) * 1000000ULL;
+        for (k = 0; k < 2; k++)
+        {
+            counts = (target / scale) + k;
+            actual = counts * scale;
+            error = (actual > target) ? (actual - target) : (target - actual);
+            /* Equal errors go to the faster clock, and to the larger count at one clock (rounding half up). */
+            if ((counts < 1) || (counts > 0x10000) ||
+                ((true == found) && ((error > *p_error) || ((error == *p_error) && (cks != *p_cks)))))
+            {
+                continue;
+            }
+            *p_cks = cks;
+            *p_counts = counts;
+            *p_error = error;
+            found = true;
+        }
+    }
+    return found;
+}
+
+static void check_period_solver(void)
+{
+    static const uint64_t s_mantissa[] = {1U, 2U, 3U, 5U, 7U};
+    static const uint32_t s_pll_div[] = {1U, 2U, 4U};
+    static uint64_t       s_sources[1300];
+    uint32_t              source_count = 0;
+    uint64_t              hz;
+    uint64_t              pll;
+    uint64_t              us;
+    uint64_t              counts = 0;
+    uint64_t              error = 0;
+    uint32_t              cks = 0;
+    uint32_t              div;
+    uint32_t              mul;
+    uint32_t              i;
+    uint32_t              k;
+    uint32_t              exponent;
+    bool                  valid;
+    unsigned long         clocks = 0;
+    unsigned long         periods = 0;
+    unsigned long         valid_count = 0;
+    unsigned long         errors = 0;
+
+    /* Sub-clock, LOCO, HOCO, main clock at 1 to 20 MHz, and the PLL from it at x4 to x13.5 within 24 to 54 MHz. */
+    s_sources[source_count++] = 32768U;
+    s_sources[source_count++] = 4000000U;
+    s_sources[source_count++] = 32000000U;
+    s_sources[source_count++] = 54000000U;
+    for (hz = 1000000U; hz <= 20000000U; hz += 1000000U)
+    {
+        s_sources[source_count++] = hz;
+        for (div = 0; div < (sizeof(s_pll_div) / sizeof(s_pll_div[0])); div++)
+        {
+            for (mul = 8U; mul <= 27U; mul++)
+            {
+                /* mul is twice the multiplier. */
+                pll = ((hz / s_pll_div[div]) * mul) / 2U;
+                if ((pll >= 24000000U) && (pll <= 54000000U))
+                {
+                    s_sources[source_count++] = pll;
+                }
+            }
+        }
+    }
+
+    srand(1);
+    for (i = 0; i < source_count; i++)
+    {
+        for (div = 1U; div <= 64U; div <<= 1)
+        {
+            hz = s_sources[i] / div;
+            if (hz > HOST_PCLKB_MAX_HZ)
+            {
+                continue;
+            }
+            clocks++;
+
+            /* 1, 2, 3, 5 and 7 times each power of ten from 1 us to 10 s, and as many random periods up to 10 s. */
+            for (k = 0; k < (2U * HOST_PERIOD_STEPS); k++)
+            {
+                if (k < HOST_PERIOD_STEPS)
+                {
+                    us = s_mantissa[k % 5U];
+                    for (exponent = 0; exponent < (k / 5U); exponent++)
+                    {
+                        us *= 10U;
+                    }
+                }
+                else
+                {
+                    us = 1U + ((uint64_t)rand() % 10000000U);
+                }
+
+                valid = period_reference(us, hz, &cks, &counts, &error) &&
+                        ((error * 1000000U) <= (us * hz * HOST_PERIOD_PPM));
+                periods++;
+                if (valid != CMT_PERIOD_VALID(us, hz, HOST_PERIOD_PPM))
+                {
+                    errors++;
+                }
+                else if (true == valid)
+                {
+                    valid_count++;
+                    if ((cks != CMT_PERIOD_CKS(us, hz)) || ((counts - 1U) != CMT_PERIOD_CMCOR(us, hz)))
+                    {
+                        errors++;
+                    }
+                }
+            }
+        }
+    }
+
+    printf("period solver   : %lu PCLKB frequencies, %lu periods, %lu within %u ppm, %lu errors\n", clocks, periods,
+           valid_count, HOST_PERIOD_PPM, errors);
+    s_period_errors = errors;
+}
+
+static uint64_t host_ns(void)
+{
+    struct timespec t;
+
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return ((uint64_t)t.tv_sec * 1000000000U) + (uint64_t)t.tv_nsec;
+}
+
+/* Checks that items arrive in order and records how long each one waited. */
+static void workq_handler(void *p_context)
+{
+    uintptr_t sequence = (uintptr_t)p_context;
+    uint64_t  waited = host_ns() - s_workq_posted_at[sequence % HOST_WORKQ_STAMPS];
+
+    if (sequence != s_workq_handled)
+    {
+        s_workq_errors++;
+    }
+    s_workq_latency[s_workq_handled] = (waited > UINT32_MAX) ? UINT32_MAX : (uint32_t)waited;
+    s_workq_handled++;
+}
+
+/* Posts the items numbered 0 to s_workq_items - 1, retrying while the queue is full. */
+static void *workq_producer(void *p_arg)
+{
+    uintptr_t     sequence;
+    uint64_t      t0;
+    uint64_t      busy = 0;
+
+    (void)p_arg;
+    for (sequence = 0; sequence < s_workq_items; sequence++)
+    {
+        /* The post of the item publishes its stamp to the consumer. The item a queue and one behind, whose stamp this
+           replaces, has been handled: its slot was freed before the item after it was taken. */
+        s_workq_posted_at[sequence % HOST_WORKQ_STAMPS] = host_ns();
+        for (;;)
+        {
+            t0 = host_ns();
+            if (WORKQ_SUCCESS == R_WORKQ_Post(&s_workq, workq_handler, (void *)sequence))
+            {
+                break;
+            }
+            s_workq_full++;
+            sched_yield();
+        }
+        busy += host_ns() - t0;
+    }
+    s_workq_post_ns = (double)busy / s_workq_items;
+    return NULL;
+}
+
+static int compare_latency(const void *p_a, const void *p_b)
+{
+    uint32_t a = *(const uint32_t *)p_a;
+    uint32_t b = *(const uint32_t *)p_b;
+
+    return (a > b) - (a < b);
+}
+
+static void bench_workq(void)
+{
+    pthread_t producer;
+    uint64_t  t0;
+    double    elapsed;
+
+    s_workq_latency = malloc(s_workq_items * sizeof(*s_workq_latency));
+    if ((NULL == s_workq_latency) || (WORKQ_SUCCESS != R_WORKQ_Open(&s_workq, s_workq_storage, HOST_WORKQ_SIZE)))
+    {
+        s_workq_errors++;
+        return;
+    }
+
+    t0 = host_ns();
+    pthread_create(&producer, NULL, workq_producer, NULL);
+    while (s_workq_handled < s_workq_items)
+    {
+        if (0U == R_WORKQ_Drain(&s_workq, HOST_WORKQ_BATCH))
+        {
+            sched_yield();
+        }
+    }
+    pthread_join(producer, NULL);
+    elapsed = (double)(host_ns() - t0);
+
+    qsort(s_workq_latency, s_workq_items, sizeof(*s_workq_latency), compare_latency);
+    printf("work queue      : %lu items, %.1f M items/s, post %.1f ns, %lu posts found the queue full\n",
+           s_workq_items, (s_workq_items * 1e3) / elapsed, s_workq_post_ns, s_workq_full);
+    printf("work queue      : latency p50 %lu ns, p99 %lu ns, max %lu ns, %lu errors\n",
+           (unsigned long)s_workq_latency[s_workq_items / 2U], (unsigned long)s_workq_latency[(s_workq_items * 99U) / 100U],
+           (unsigned long)s_workq_latency[s_workq_items - 1U], s_workq_errors);
+    free(s_workq_latency);
+}
+
+/* Checks that the tasks of one round run from the highest priority down. */
+static void sched_ordered(void *p_context)
+{
+    uint32_t priority = (uint32_t)(uintptr_t)p_context;
+
+    if (priority <= s_sched_last)
+    {
+        s_sched_errors++;
+    }
+    s_sched_last = priority;
+    s_sched_dispatched++;
+}
+
+/* Timer callback, in the CMT0 interrupt: posts the probe task. */
+static void sched_probe_post(void *p_context)
+{
+    (void)p_context;
+    s_sched_posted_at = rx_host_cycles();
+    s_sched_posts++;
+    (void)R_SCHED_Post(HOST_SCHED_PROBE);
+}
+
+/* Records how long after its post the probe task started. */
+static void sched_probe(void *p_context)
+{
+    uint64_t latency = rx_host_cycles() - s_sched_posted_at;
+
+    (void)p_context;
+    s_sched_probes++;
+    s_sched_latency_min = (latency < s_sched_latency_min) ? latency : s_sched_latency_min;
+    s_sched_latency_max = (latency > s_sched_latency_max) ? latency : s_sched_latency_max;
+    s_sched_latency_sum += latency;
+}
+
+/* Always ready: runs for a random number of nops and posts itself again. */
+static void sched_load(void *p_context)
+{
+    uint32_t nops = (uint32_t)rand() % (HOST_SCHED_LOAD_NOPS + 1U);
+
+    while (0U != nops--)
+    {
+        nop();
+    }
+    (void)R_SCHED_Post((uint32_t)(uintptr_t)p_context);
+}
+
+static void bench_sched(void)
+{
+    uint32_t        nop_cycles = g_rx_host_nop_cycles;
+    uint32_t        posted;
+    uint32_t        bits;
+    uint32_t        priority;
+    uint32_t        round;
+    uint64_t        expected = 0;
+    uint64_t        t0;
+    double          elapsed;
+    double          iclk_us = rx_host_clock_hz(RX_HOST_CLOCK_ICLK) / 1e6;
+
+    /* Dispatch order and cost, with interrupts masked so that the CMT0 work task stays out of the rounds. */
+    clrpsw_i();
+    srand(1);
+    for (priority = 1U; priority < SCHED_PRIORITIES; priority++)
+    {
+        (void)R_SCHED_Create(priority, sched_ordered, (void *)(uintptr_t)priority);
+    }
+
+    t0 = host_ns();
+    for (round = 0; round < HOST_SCHED_ROUNDS; round++)
+    {
+        posted = ((uint32_t)rand() ^ ((uint32_t)rand() << 16)) & ~1U;
+        for (bits = posted; 0U != bits; bits &= bits - 1U)
+        {
+            expected++;
+            (void)R_SCHED_Post((uint32_t)__builtin_ctz(bits));
+        }
+        s_sched_last = 0U;
+        while (true == R_SCHED_RunOnce())
+        {
+            /* Run the round */
+        }
+    }
+    elapsed = (double)(host_ns() - t0);
+
+    if (expected != s_sched_dispatched)
+    {
+        s_sched_errors++;
+    }
+    printf("scheduler       : %llu tasks, %.1f ns per post and dispatch, %lu order errors\n",
+           (unsigned long long)s_sched_dispatched, elapsed / (double)s_sched_dispatched, s_sched_errors);
+
+    /* Start latency of the probe, posted from each CMT0 tick, behind always-ready load tasks. */
+    for (priority = 1U; priority < SCHED_PRIORITIES; priority++)
+    {
+        (void)R_SCHED_Delete(priority);
+    }
+    (void)R_SCHED_Create(HOST_SCHED_PROBE, sched_probe, NULL);
+    for (priority = HOST_SCHED_LOAD_FIRST; priority < (HOST_SCHED_LOAD_FIRST + HOST_SCHED_LOADS); priority++)
+    {
+        (void)R_SCHED_Create(priority, sched_load, (void *)(uintptr_t)priority);
+        (void)R_SCHED_Post(priority);
+    }
+    g_rx_host_nop_cycles = HOST_SCHED_NOP_CYCLES;
+    s_sched_latency_min = UINT64_MAX;
+    (void)R_TIMER_Init(&s_sched_timer);
+    R_TIMER_Start(&s_sched_timer, 1U, 1U, sched_probe_post, NULL);
+    setpsw_i();
+
+    while (s_sched_probes < s_sched_ticks)
+    {
+        (void)R_SCHED_RunOnce();
+    }
+
+    clrpsw_i();
+    R_TIMER_Cancel(&s_sched_timer);
+    for (priority = 1U; priority < SCHED_PRIORITIES; priority++)
+    {
+        (void)R_SCHED_Delete(priority);
+    }
+    g_rx_host_nop_cycles = nop_cycles;
+    setpsw_i();
+
+    /* A load task run is never preempted by a task, so it bounds the latency; every post must have run once. */
+    if ((s_sched_latency_max > ((uint64_t)HOST_SCHED_LOAD_NOPS * HOST_SCHED_NOP_CYCLES)) ||
+        (s_sched_posts != s_sched_probes))
+    {
+        s_sched_errors++;
+    }
+    printf("scheduler       : %lu ticks under load, probe latency min %.1f us, mean %.1f us, max %.1f us "
+           "(bound %.1f us)\n", s_sched_ticks, s_sched_latency_min / iclk_us,
+           (s_sched_latency_sum / (double)s_sched_probes) / iclk_us, s_sched_latency_max / iclk_us,
+           (HOST_SCHED_LOAD_NOPS * HOST_SCHED_NOP_CYCLES) / iclk_us);
+}
+
+static void host_irq0_isr(void)
+{
+    s_power_irqs++;
+}
+RX_HOST_INTERRUPT(ICU, IRQ0, host_irq0_isr)
+
+/* Checks the mode selection, and a software standby that the CMT cannot wake but IRQ0 can. */
+static void check_power_modes(void)
+{
+    idle_stats_t stats;
+    uint64_t     standby = rx_host_sleep_cycles(true);
+    uint64_t     pclkb;
+    uint64_t     slept;
+    bool         profiling = (1 == CMT.CMSTR0.BIT.STR1);
+
+    R_IDLE_Open(rx_host_cycles);
+    if (IDLE_MODE_SLEEP != R_IDLE_SelectMode())
+    {
+        s_power_errors++;
+    }
+    R_IDLE_AllowStandby(true);
+    if (IDLE_MODE_SLEEP != R_IDLE_SelectMode())
+    {
+        s_power_errors++;
+    }
+
+    R_Config_CMT0_Stop();
+    R_Config_CMT1_Stop();
+    if (IDLE_MODE_SLEEP != R_IDLE_SelectMode())
+    {
+        s_power_errors++;
+    }
+    R_Config_TMR0_Stop();
+    if (IDLE_MODE_STANDBY != R_IDLE_SelectMode())
+    {
+        s_power_errors++;
+    }
+
+    ICU.IPR[IPR_ICU_IRQ0].BYTE = 1;
+    IEN(ICU, IRQ0) = 1;
+    pclkb = rx_host_cmt_pclkb(0);
+    rx_host_wake_source(VECT_ICU_IRQ0, HOST_STANDBY_CYCLES);
+    clrpsw_i();
+    R_IDLE_Enter();
+    setpsw_i();
+    IEN(ICU, IRQ0) = 0;
+
+    R_IDLE_GetStats(&stats);
+    slept = rx_host_sleep_cycles(true) - standby;
+    if ((1U != s_power_irqs) || (1U != stats.entries[IDLE_MODE_STANDBY]) || (0U != stats.entries[IDLE_MODE_SLEEP]) ||
+        (1 != SYSTEM.SBYCR.BIT.SSBY) || (pclkb != rx_host_cmt_pclkb(0)) || ((slept + HOST_IDLE_SLACK) < HOST_STANDBY_CYCLES) ||
+        ((stats.asleep[IDLE_MODE_STANDBY] - slept) > HOST_IDLE_SLACK))
+    {
+        s_power_errors++;
+    }
+
+    R_IDLE_AllowStandby(false);
+    R_Config_TMR0_Start();
+    R_Config_CMT0_Start();
+    if (true == profiling)
+    {
+        R_Config_CMT1_Start();
+    }
+    printf("idle modes      : standby %llu cycles, %llu accounted, %lu errors\n", (unsigned long long)slept,
+           (unsigned long long)stats.asleep[IDLE_MODE_STANDBY], s_power_errors);
+}
+
+/* Timer callback, in the CMT0 interrupt: posts the work task. */
+static void power_tick(void *p_context)
+{
+    (void)p_context;
+    (void)R_SCHED_Post(HOST_IDLE_TASK);
+}
+
+/* Runs for a random number of nops; ends the run after s_power_ticks ticks. */
+static void power_task(void *p_context)
+{
+    uint32_t nops = 1U + ((uint32_t)rand() % HOST_SCHED_LOAD_NOPS);
+
+    (void)p_context;
+    s_power_work += (uint64_t)nops * g_rx_host_nop_cycles;
+    while (0U != nops--)
+    {
+        nop();
+    }
+
+    s_power_runs++;
+    if (s_power_runs >= s_power_ticks)
+    {
+        rx_host_stop();
+    }
+}
+
+/* Runs the scheduler with its r_idle idle hook; ended by power_task(). */
+static void check_power_load(void)
+{
+    srand(1);
+    s_power_work = 0;
+    s_power_runs = 0;
+    s_power_cycles = rx_host_cycles();
+    s_power_sleep = rx_host_sleep_cycles(false);
+    s_power_nop_cycles = g_rx_host_nop_cycles;
+    g_rx_host_nop_cycles = HOST_SCHED_NOP_CYCLES;
+    R_IDLE_Open(rx_host_cycles);
+    (void)R_SCHED_Create(HOST_IDLE_TASK, power_task, NULL);
+    (void)R_TIMER_Init(&s_power_timer);
+    R_TIMER_Start(&s_power_timer, 1U, 1U, power_tick, NULL);
+    R_SCHED_SetIdleHook(R_IDLE_Enter);
+    R_SCHED_Run();
+}
+
+/* Compares the accounting of the check_power_load() run with the model. */
+static void report_power_load(void)
+{
+    idle_stats_t stats;
+    uint64_t     slept = rx_host_sleep_cycles(false) - s_power_sleep;
+    uint64_t     total = rx_host_cycles() - s_power_cycles;
+    uint64_t     wakes;
+    double       iclk_us = rx_host_clock_hz(RX_HOST_CLOCK_ICLK) / 1e6;
+
+    R_IDLE_GetStats(&stats);
+    R_TIMER_Cancel(&s_power_timer);
+    (void)R_SCHED_Delete(HOST_IDLE_TASK);
+    g_rx_host_nop_cycles = s_power_nop_cycles;
+
+    /* Interrupts taken in WAIT count as asleep, others as awake. */
+    wakes = stats.entries[IDLE_MODE_SLEEP];
+    if ((s_power_runs != s_power_ticks) || (0U != stats.entries[IDLE_MODE_STANDBY]) || (0 != SYSTEM.SBYCR.BIT.SSBY) ||
+        ((stats.awake + stats.asleep[IDLE_MODE_SLEEP]) != total) || (stats.asleep[IDLE_MODE_SLEEP] < slept) ||
+        ((stats.asleep[IDLE_MODE_SLEEP] - slept) > (wakes * HOST_IDLE_SLACK)) || (stats.awake < s_power_work) ||
+        ((stats.awake - s_power_work) > ((wakes + s_power_runs) * HOST_IDLE_SLACK)))
+    {
+        s_power_errors++;
+    }
+
+    printf("idle            : %lu ticks, %llu wakes, asleep %.4f %%, awake %.1f us per task (work %.1f us)\n",
+           s_power_ticks, (unsigned long long)wakes, (100.0 * stats.asleep[IDLE_MODE_SLEEP]) / total,
+           (stats.awake / iclk_us) / s_power_runs, (s_power_work / iclk_us) / s_power_runs);
+}
+
+static int compare_sample(const void *p_a, const void *p_b)
+{
+    uint32_t a = *(const uint32_t *)p_a;
+    uint32_t b = *(const uint32_t *)p_b;
+
+    return (a > b) - (a < b);
+}
+
+/* Histogram math against a sorted copy of the same samples. */
+static void check_latency_math(void)
+{
+    static const uint32_t s_percents[] = {0U, 1U, 50U, 90U, 99U, 100U};
+    r_lathist_t           hist;
+    uint32_t              bins[LATHIST_BINS] = {0};
+    uint32_t              sample;
+    uint32_t              exact;
+    uint32_t              bound;
+    uint32_t              i;
+    uint64_t              t0;
+    double                elapsed;
+
+    s_latency_sorted = malloc(HOST_LATENCY_SAMPLES * sizeof(*s_latency_sorted));
+    if (NULL == s_latency_sorted)
+    {
+        s_latency_errors++;
+        return;
+    }
+
+    /* Magnitudes spread over every bin. */
+    srand(1);
+    for (i = 0; i < HOST_LATENCY_SAMPLES; i++)
+    {
+        sample = ((uint32_t)rand() ^ ((uint32_t)rand() << 16)) >> ((uint32_t)rand() % 33U);
+        s_latency_sorted[i] = sample;
+        bins[(0U == sample) ? 0U : (32U - (uint32_t)__builtin_clz(sample))]++;
+    }
+
+    R_LATHIST_Clear(&hist);
+    t0 = host_ns();
+    for (i = 0; i < HOST_LATENCY_SAMPLES; i++)
+    {
+        R_LATHIST_Record(&hist, s_latency_sorted[i]);
+    }
+    elapsed = (double)(host_ns() - t0);
+
+    qsort(s_latency_sorted, HOST_LATENCY_SAMPLES, sizeof(*s_latency_sorted), compare_sample);
+    for (i = 0; i < LATHIST_BINS; i++)
+    {
+        s_latency_errors += (bins[i] != hist.bins[i]) ? 1U : 0U;
+    }
+    if ((HOST_LATENCY_SAMPLES != hist.count) || (s_latency_sorted[0] != hist.min) ||
+        (s_latency_sorted[HOST_LATENCY_SAMPLES - 1U] != hist.max))
+    {
+        s_latency_errors++;
+    }
+
+    /* The bound must be in the same bin as the nearest-rank sample, and not below it. */
+    for (i = 0; i < (sizeof(s_percents) / sizeof(s_percents[0])); i++)
+    {
+        exact = s_latency_sorted[(0U == s_percents[i]) ? 0U :
+                                 ((((uint64_t)HOST_LATENCY_SAMPLES * s_percents[i]) + 99U) / 100U) - 1U];
+        bound = R_LATHIST_Percentile(&hist, s_percents[i]);
+        if ((bound < exact) || (R_LATHIST_Bin(bound) != R_LATHIST_Bin(exact)))
+        {
+            s_latency_errors++;
+        }
+    }
+    free(s_latency_sorted);
+
+    printf("latency math    : %u samples, %.1f ns per sample, %lu errors\n", HOST_LATENCY_SAMPLES,
+           elapsed / HOST_LATENCY_SAMPLES, s_latency_errors);
+}
+
+/* Takes CMT0 latency samples from WAIT, or from a loop of nops of the given length, and checks them against the
+   longest delay the model can give: the nop that the compare match falls in, plus interrupt acceptance. */
+static void check_latency_cmt0(bool busy, uint32_t nop_cycles)
+{
+    r_lathist_t hist;
+    uint32_t    start = rx_host_vector_accepted(VECT_CMT0_CMI0);
+    uint32_t    saved = g_rx_host_nop_cycles;
+    uint64_t    fine_hz = rx_host_clock_hz(RX_HOST_CLOCK_PCLKB) / 8U;
+    uint64_t    iclk = rx_host_clock_hz(RX_HOST_CLOCK_ICLK);
+    uint64_t    limit = ((busy ? nop_cycles : 0U) + RX_HOST_INT_ENTRY_CYCLES + (256U * g_rx_host_access_cycles));
+    double      fine_us = 1e6 / (double)fine_hz;
+
+    limit = ((limit * fine_hz) + iclk - 1U) / iclk;
+    R_LATHIST_Clear(&g_cmt0_latency);
+    g_rx_host_nop_cycles = nop_cycles;
+    setpsw_i();
+    while ((rx_host_vector_accepted(VECT_CMT0_CMI0) - start) < s_latency_samples)
+    {
+        if (true == busy)
+        {
+            nop();
+        }
+        else
+        {
+            wait();
+        }
+    }
+    g_rx_host_nop_cycles = saved;
+    R_LATHIST_Snapshot(&g_cmt0_latency, &hist);
+
+    if ((hist.count != s_latency_samples) || (hist.max > limit))
+    {
+        s_latency_errors++;
+    }
+    printf("CMT0 latency    : %-4s %lu samples, min %.2f us, p50 <= %.2f us, p99 <= %.2f us, max %.2f us "
+           "(limit %.2f us)\n", busy ? "busy" : "wait", s_latency_samples, hist.min * fine_us,
+           R_LATHIST_Percentile(&hist, 50U) * fine_us, R_LATHIST_Percentile(&hist, 99U) * fine_us,
+           hist.max * fine_us, limit * fine_us);
+}
+
+static void check_latency(void)
+{
+    check_latency_math();
+    check_latency_cmt0(false, g_rx_host_nop_cycles);
+    check_latency_cmt0(true, HOST_LATENCY_NOP_CYCLES);
+}
+
+/* Simulated profiling clock. */
+static uint32_t profile_clock(void)
+{
+    return s_profile_now;
+}
+
+static void profile_expect(uint32_t site, uint32_t elapsed)
+{
+    s_profile_expected[site].calls++;
+    s_profile_expected[site].total += elapsed;
+    s_profile_expected[site].max = (elapsed > s_profile_expected[site].max) ? elapsed : s_profile_expected[site].max;
+}
+
+static void profile_compare(void)
+{
+    profile_site_t site;
+    uint32_t       i;
+
+    for (i = 0; i < HOST_PROFILE_SITES; i++)
+    {
+        if ((false == R_PROFILE_GetSite(i, &site)) || (site.calls != s_profile_expected[i].calls) ||
+            (site.total != s_profile_expected[i].total) || (site.max != s_profile_expected[i].max))
+        {
+            s_profile_errors++;
+        }
+        s_profile_expected[i].calls = 0U;
+        s_profile_expected[i].total = 0U;
+        s_profile_expected[i].max = 0U;
+    }
+}
+
+/* Aggregation with a simulated clock: random scopes, each with a nested scope at the last site, starting anywhere in
+   the clock's range so that some of them wrap. */
+static void check_profile_table(void)
+{
+    profile_site_t site;
+    uint32_t       outer;
+    uint32_t       inner;
+    uint32_t       before;
+    uint32_t       outer_site;
+    uint32_t const inner_site = HOST_PROFILE_SITES - 1U;
+    unsigned long  i;
+    uint64_t       t0;
+    double         elapsed;
+
+    R_PROFILE_Open(profile_clock);
+    srand(1);
+    for (i = 0; i < s_profile_scopes; i++)
+    {
+        s_profile_now = (uint32_t)rand() ^ ((uint32_t)rand() << 16);
+        outer = s_profile_now;
+        outer_site = i % (HOST_PROFILE_SITES - 1U);
+        PROFILE_BEGIN(outer_site)
+        before = (uint32_t)rand() >> ((uint32_t)rand() % 31U);
+        s_profile_now += before;
+        PROFILE_BEGIN(inner_site)
+        inner = (uint32_t)rand() >> ((uint32_t)rand() % 31U);
+        s_profile_now += inner;
+        PROFILE_END(inner_site)
+        s_profile_now += (uint32_t)rand() >> ((uint32_t)rand() % 31U);
+        PROFILE_END(outer_site)
+        profile_expect(inner_site, inner);
+        profile_expect(outer_site, s_profile_now - outer);
+    }
+    profile_compare();
+
+    /* Sites outside the table are ignored. */
+    R_PROFILE_Record(PROFILE_CFG_SITES, 1U);
+    if (true == R_PROFILE_GetSite(PROFILE_CFG_SITES, &site))
+    {
+        s_profile_errors++;
+    }
+
+    R_PROFILE_Open(profile_clock);
+    outer_site = 0U;
+    t0 = host_ns();
+    for (i = 0; i < s_profile_scopes; i++)
+    {
+        PROFILE_BEGIN(outer_site)
+        PROFILE_END(outer_site)
+    }
+    elapsed = (double)(host_ns() - t0);
+    printf("profile table   : %lu scopes, %.1f ns per scope, %lu errors\n", s_profile_scopes,
+           elapsed / s_profile_scopes, s_profile_errors);
+}
+
+/* CMT1 counts against the model, over loops that span several wraps and with interrupts masked across wraps. The
+   scope reads the counter a few register accesses inside the model's readings, hence the slack. */
+static void check_profile_cmt1(void)
+{
+    profile_site_t site;
+    uint32_t       saved = g_rx_host_nop_cycles;
+    uint32_t       wraps = rx_host_vector_accepted(VECT_CMT1_CMI1);
+    uint32_t       nops;
+    uint32_t       run;
+    uint32_t const site_no = 1U;
+    uint64_t       before;
+    uint64_t       expected;
+    unsigned long  mismatches = 0;
+
+    if (1 != CMT.CMSTR0.BIT.STR1)
+    {
+        R_Config_CMT1_Start();
+    }
+    g_rx_host_nop_cycles = 100U;
+    setpsw_i();
+    for (run = 0; run < HOST_PROFILE_CMT1_RUNS; run++)
+    {
+        nops = 1U + ((uint32_t)rand() % ((0U == (run & 1U)) ? HOST_PROFILE_MASKED_NOPS : HOST_PROFILE_NOPS));
+        R_PROFILE_Open(R_Config_CMT1_GetCount32);
+        if (0U == (run & 1U))
+        {
+            clrpsw_i();
+        }
+
+        before = rx_host_cmt_counts(1);
+        PROFILE_BEGIN(site_no)
+        while (0U != nops--)
+        {
+            nop();
+        }
+        PROFILE_END(site_no)
+        expected = rx_host_cmt_counts(1) - before;
+        setpsw_i();
+
+        if ((false == R_PROFILE_GetSite(site_no, &site)) || (1U != site.calls) || (site.max > expected) ||
+            ((site.max + HOST_PROFILE_SLACK) < expected))
+        {
+            mismatches++;
+        }
+    }
+    g_rx_host_nop_cycles = saved;
+    R_PROFILE_Open(R_Config_CMT1_GetCount32);
+    s_profile_errors += mismatches;
+
+    printf("profile CMT1    : %u scopes over %lu wraps, %lu mismatches\n", HOST_PROFILE_CMT1_RUNS,
+           (unsigned long)(rx_host_vector_accepted(VECT_CMT1_CMI1) - wraps), mismatches);
+}
+
+static void check_profile(void)
+{
+    check_profile_table();
+    check_profile_cmt1();
+}
+
+/* PORTD accesses traced since the last call. */
+static void port_accesses(uint64_t *p_reads, uint64_t *p_writes)
+{
+    static uint64_t             s_reads;
+    static uint64_t             s_writes;
+    const rx_host_trace_count_t *p_count;
+    uint32_t                    i;
+
+    *p_reads = 0;
+    *p_writes = 0;
+    for (i = 0; i < rx_host_trace_peripheral_count(); i++)
+    {
+        if (0 == strcmp(rx_host_trace_peripheral_name(i), "PORTD"))
+        {
+            p_count = rx_host_trace_peripheral_counts(i);
+            *p_reads = p_count->reads - s_reads;
+            *p_writes = p_count->writes - s_writes;
+            s_reads = p_count->reads;
+            s_writes = p_count->writes;
+        }
+    }
+}
+
+/* Update semantics, and the PORTD accesses of one update against the bitfield toggles it replaces. */
+static void check_port_writes(void)
+{
+    static const port_update_t s_batch[] =
+    {
+        { PORT_ID_D, LED0_PIN | LED1_PIN, LED1_PIN, 0U },
+        { PORT_ID_B, 0U, 0U, PORT_PIN(0) },
+        { PORT_ID_D, 0U, 0U, LED0_PIN | LED1_PIN }
+    };
+    static const port_update_t s_bad[] =
+    {
+        { PORT_ID_D, 0U, 0U, LED0_PIN },
+        { 0x06U, 0U, 0U, PORT_PIN(0) }
+    };
+    uint64_t bitfield[2];
+    uint64_t single[2];
+    uint64_t batch[2];
+    uint8_t  portb;
+
+    R_PORT_Open();
+    (void)R_PORT_Clear(LED_PORT, 0xFFU);
+    (void)R_PORT_Modify(LED_PORT, LED0_PIN, LED0_PIN | LED1_PIN, LED1_PIN);
+    if ((LED0_PIN != PORTD.PODR.BYTE) || (LED0_PIN != R_PORT_Read(LED_PORT)) ||
+        (true == R_PORT_Modify(0x06U, 0U, PORT_PIN(0), 0U)) || (true == R_PORT_Modify(PORT_IDS, 0U, 0U, 0U)) ||
+        (true == R_PORT_ModifyMany(s_bad, 2U)) || (LED0_PIN != PORTD.PODR.BYTE) ||
+        (true == R_PORT_ModifyMany(NULL, 1U)) || (false == R_PORT_ModifyMany(NULL, 0U)))
+    {
+        s_port_errors++;
+    }
+
+    portb = PORTB.PODR.BYTE;
+    port_accesses(&bitfield[0], &bitfield[1]);
+    g_host_port_direct = true;
+    host_port_toggle_leds();
+    port_accesses(&bitfield[0], &bitfield[1]);
+    R_PORT_Open();
+    port_accesses(&single[0], &single[1]);
+    g_host_port_direct = false;
+    host_port_toggle_leds();
+    port_accesses(&single[0], &single[1]);
+    (void)R_PORT_ModifyMany(s_batch, 3U);
+    port_accesses(&batch[0], &batch[1]);
+    if ((LED0_PIN != PORTD.PODR.BYTE) || ((portb ^ PORT_PIN(0)) != PORTB.PODR.BYTE) ||
+        ((true == rx_host_trace_available()) && ((0U != single[0]) || (1U != single[1]) || (0U != batch[0]) ||
+                                                 (2U != batch[1]))))
+    {
+        s_port_errors++;
+    }
+    (void)R_PORT_Toggle(PORT_ID_B, PORT_PIN(0));
+
+    if (true == rx_host_trace_available())
+    {
+        printf("port accesses   : bitfield toggle of 2 LEDs %llu R %llu W, r_port %llu R %llu W, "
+               "batch of 2 PORTD updates %llu R %llu W\n", (unsigned long long)bitfield[0],
+               (unsigned long long)bitfield[1], (unsigned long long)single[0], (unsigned long long)single[1],
+               (unsigned long long)batch[0], (unsigned long long)batch[1]);
+    }
+}
+
+/* LED0 updates from the main loop racing LED1 updates from IRQ1; returns the updates lost on either side. */
+static unsigned long port_race(bool direct)
+{
+    unsigned long i;
+    unsigned long lost = 0;
+    bool          led0;
+
+    R_PORT_Open();
+    g_host_port_direct = direct;
+    g_host_port_led1 = (0U != (PORTD.PODR.BYTE & LED1_PIN));
+    g_host_port_lost = 0;
+    g_host_port_spacing = HOST_PORT_IRQ_SPACING;
+    led0 = (0U != (PORTD.PODR.BYTE & LED0_PIN));
+
+    ICU.IPR[IPR_ICU_IRQ1].BYTE = 1;
+    IEN(ICU, IRQ1) = 1;
+    rx_host_wake_source(VECT_ICU_IRQ1, 1U);
+    setpsw_i();
+    for (i = 0; i < s_port_updates; i++)
+    {
+        host_port_toggle_led0();
+        led0 = !led0;
+        if ((0U != (PORTD.PODR.BYTE & LED0_PIN)) != led0)
+        {
+            lost++;
+            led0 = !led0;
+        }
+        nop();
+    }
+    IEN(ICU, IRQ1) = 0;
+    rx_host_wake_source(0U, 0U);
+    R_PORT_Open();
+
+    return lost + g_host_port_lost;
+}
+
+static void check_port(void)
+{
+    unsigned long i;
+    unsigned long lost;
+    unsigned long direct;
+    uint32_t      saved = g_rx_host_nop_cycles;
+    uint64_t      t0;
+    double        elapsed;
+
+    check_port_writes();
+
+    g_rx_host_nop_cycles = 1U;
+    lost = port_race(false);
+    direct = port_race(true);
+    g_rx_host_nop_cycles = saved;
+    s_port_errors += lost;
+
+    t0 = host_ns();
+    for (i = 0; i < s_port_updates; i++)
+    {
+        (void)R_PORT_Toggle(LED_PORT, LED0_PIN | LED1_PIN);
+    }
+    elapsed = (double)(host_ns() - t0);
+    printf("port race       : %lu updates, %lu interrupts, r_port %lu lost, byte read-modify-write %lu lost, %.1f ns per update\n",
+           s_port_updates, (unsigned long)g_host_port_irqs, lost, direct, elapsed / s_port_updates);
+}
+
+/* PB0 transitions over the given cycles, sampled every nop; the shortest and longest time between two of them. */
+static unsigned long elc_toggles(uint64_t cycles, uint64_t *p_min, uint64_t *p_max)
+{
+    uint64_t      start = rx_host_cycles();
+    uint64_t      last = 0;
+    unsigned long toggles = 0;
+    uint8_t       level = PORTB.PODR.BYTE & ELC_BLINK_PIN;
+
+    *p_min = UINT64_MAX;
+    *p_max = 0;
+    while ((rx_host_cycles() - start) < cycles)
+    {
+        nop();
+        if ((PORTB.PODR.BYTE & ELC_BLINK_PIN) != level)
+        {
+            level ^= ELC_BLINK_PIN;
+            if (0 != toggles)
+            {
+                *p_min = ((rx_host_cycles() - last) < *p_min) ? (rx_host_cycles() - last) : *p_min;
+                *p_max = ((rx_host_cycles() - last) > *p_max) ? (rx_host_cycles() - last) : *p_max;
+            }
+            last = rx_host_cycles();
+            toggles++;
+        }
+    }
+
+    return toggles;
+}
+
+static void check_elc(void)
+{
+    uint32_t      saved = g_rx_host_nop_cycles;
+    uint64_t      period = HOST_ELC_PERIOD_CYCLES;
+    uint64_t      events = rx_host_elc_events(0);
+    uint64_t      min;
+    uint64_t      max;
+    unsigned long toggles;
+    unsigned long stopped;
+    double        iclk_us = rx_host_clock_hz(RX_HOST_CLOCK_ICLK) / 1e6;
+    double        count_us;
+    double        error_us;
+
+    /* The link as Config_ELC and Config_TMR0 set it up. */
+    if ((1 != ELC.ELCR.BIT.ELCON) || (_22_ELC_EVENT_TMR0_CMIA0 != ELC.ELSR[ELC_ELSR_SINGLE_PORT0].BYTE) ||
+        ((_08_ELC_PSP_PORTB | _00_ELC_PSB_0 | _40_ELC_PSM_OUTPUT_TOGGLE) != ELC.PEL0.BYTE) ||
+        (0 == (PORTB.PDR.BYTE & ELC_BLINK_PIN)) || (0 != (PORTB.PMR.BYTE & ELC_BLINK_PIN)) ||
+        (0 != MSTP(ELC)) || (0 != MSTP(TMR01)) || (3 != TMR0.TCCR.BIT.CSS) || (1 != TMR0.TCR.BIT.CCLR) ||
+        (0 != TMR0.TCR.BIT.CMIEA))
+    {
+        s_elc_errors++;
+    }
+
+    /* Within one count of the requested period. */
+    count_us = (1e6 * TMR01_COUNT_CLOCK_DIVISOR) / rx_host_clock_hz(RX_HOST_CLOCK_PCLKB);
+    error_us = (period / iclk_us) - TMR01_PERIOD_US;
+    if ((error_us > count_us) || (error_us < -count_us))
+    {
+        s_elc_errors++;
+    }
+
+    g_rx_host_nop_cycles = HOST_ELC_NOP_CYCLES;
+    clrpsw_i();
+    toggles = elc_toggles(s_elc_periods * period, &min, &max);
+    events = rx_host_elc_events(0) - events;
+    if ((toggles != events) || ((toggles + 1U) < s_elc_periods) || (toggles > s_elc_periods) ||
+        ((toggles > 1U) && ((min + HOST_ELC_NOP_CYCLES + 1U) < period)) ||
+        ((toggles > 1U) && (max > (period + HOST_ELC_NOP_CYCLES + 1U))))
+    {
+        s_elc_errors++;
+    }
+
+    R_Config_ELC_Stop();
+    stopped = elc_toggles(2U * period, &min, &max);
+    R_Config_ELC_Start();
+    setpsw_i();
+    g_rx_host_nop_cycles = saved;
+    if (0 != stopped)
+    {
+        s_elc_errors++;
+    }
+
+    printf("elc blink       : %lu periods of %.1f us with interrupts masked, %lu toggles of PB0 (%llu events), "
+           "%lu with the link disabled\n", s_elc_periods, period / iclk_us, toggles, (unsigned long long)events,
+           stopped);
+}
+
+/* Builder argument checks and the transfer information of a three-step sequence. */
+static void check_dtcseq_build(void)
+{
+    dtcseq_transfer_t chain[DTCSEQ_TRANSFERS];
+    uint32_t          i;
+
+    for (i = 0; i < DTCSEQ_STEPS_MAX; i++)
+    {
+        s_dtcseq_podr[i] = (uint8_t)i;
+        s_dtcseq_cmcor[i] = DTCSEQ_CMCOR_MIN;
+    }
+
+    if (R_DTCSEQ_Build(NULL, s_dtcseq_podr, s_dtcseq_cmcor, 1U) ||
+        R_DTCSEQ_Build(chain, NULL, s_dtcseq_cmcor, 1U) || R_DTCSEQ_Build(chain, s_dtcseq_podr, NULL, 1U) ||
+        R_DTCSEQ_Build(chain, s_dtcseq_podr, s_dtcseq_cmcor, 0U) ||
+        R_DTCSEQ_Build(chain, s_dtcseq_podr, s_dtcseq_cmcor, DTCSEQ_STEPS_MAX + 1U))
+    {
+        s_dtcseq_errors++;
+    }
+
+    /* A step shorter than DTCSEQ_CMCOR_MIN is rejected only when it is part of the sequence. */
+    s_dtcseq_cmcor[5] = DTCSEQ_CMCOR_MIN - 1U;
+    if (R_DTCSEQ_Build(chain, s_dtcseq_podr, s_dtcseq_cmcor, 6U) ||
+        !R_DTCSEQ_Build(chain, s_dtcseq_podr, s_dtcseq_cmcor, 5U))
+    {
+        s_dtcseq_errors++;
+    }
+    s_dtcseq_cmcor[5] = DTCSEQ_CMCOR_MIN;
+
+    /* 256 steps are written as repeat size and counter 0. */
+    if (!R_DTCSEQ_Build(chain, s_dtcseq_podr, s_dtcseq_cmcor, DTCSEQ_STEPS_MAX) || (0U != chain[0].count) ||
+        (0U != chain[1].count))
+    {
+        s_dtcseq_errors++;
+    }
+
+    if (!R_DTCSEQ_Build(chain, s_dtcseq_podr, s_dtcseq_cmcor, 3U) || (0x48900000UL != chain[0].mode) ||
+        ((uint32_t)(uintptr_t)s_dtcseq_podr != chain[0].sar) ||
+        ((uint32_t)(uintptr_t)&PORTD.PODR.BYTE != chain[0].dar) || (0x03030000UL != chain[0].count) ||
+        (0x58100000UL != chain[1].mode) || ((uint32_t)(uintptr_t)s_dtcseq_cmcor != chain[1].sar) ||
+        ((uint32_t)(uintptr_t)&CMT2.CMCOR != chain[1].dar) || (0x03030000UL != chain[1].count))
+    {
+        s_dtcseq_errors++;
+    }
+}
+
+/* Replays a random sequence for s_dtcseq_wraps table wraps, sampling PORTD every nop. */
+static void check_dtcseq_replay(uint32_t steps)
+{
+    uint64_t      activations = rx_host_dtc_activations();
+    uint32_t      cmi2 = rx_host_vector_accepted(VECT_CMT2_CMI2);
+    uint64_t      wrap = 0;
+    uint64_t      start;
+    uint64_t      last = 0;
+    uint64_t      expected;
+    uint64_t      elapsed;
+    uint64_t      error;
+    uint64_t      worst = 0;
+    uint64_t      k = 0;
+    unsigned long moved = 0;
+    uint32_t      i;
+    uint8_t       level;
+
+    /* Neighbouring steps differ, so that every step boundary shows on PORTD. */
+    for (i = 0; i < steps; i++)
+    {
+        do
+        {
+            s_dtcseq_podr[i] = (uint8_t)rand();
+        } while (((0U != i) && (s_dtcseq_podr[i] == s_dtcseq_podr[i - 1U])) ||
+                 (((steps - 1U) == i) && (s_dtcseq_podr[i] == s_dtcseq_podr[0])));
+        s_dtcseq_cmcor[i] = (uint16_t)(DTCSEQ_CMCOR_MIN +
+                                       ((uint32_t)rand() % ((HOST_DTCSEQ_CMCOR_MAX - DTCSEQ_CMCOR_MIN) + 1U)));
+        wrap += HOST_DTCSEQ_STEP_CYCLES(s_dtcseq_cmcor[i]);
+    }
+
+    PORTD.PODR.BYTE = (uint8_t)~s_dtcseq_podr[0];
+    level = PORTD.PODR.BYTE;
+    if (false == R_DTCSEQ_Start(s_dtcseq_podr, s_dtcseq_cmcor, steps))
+    {
+        s_dtcseq_errors++;
+        return;
+    }
+
+    /* Give up after twice the expected time if the steps stop showing. */
+    start = rx_host_cycles();
+    wrap *= 2U * (s_dtcseq_wraps + 1U);
+    while ((k < ((uint64_t)steps * s_dtcseq_wraps)) && ((rx_host_cycles() - start) < wrap))
+    {
+        nop();
+        if (PORTD.PODR.BYTE != level)
+        {
+            level = PORTD.PODR.BYTE;
+            if (level != s_dtcseq_podr[k % steps])
+            {
+                s_dtcseq_errors++;
+            }
+            if (0U != k)
+            {
+                elapsed = rx_host_cycles() - last;
+                expected = HOST_DTCSEQ_STEP_CYCLES(s_dtcseq_cmcor[(k - 1U) % steps]);
+                error = (elapsed > expected) ? (elapsed - expected) : (expected - elapsed);
+                worst = (error > worst) ? error : worst;
+                if (error > (HOST_DTCSEQ_NOP_CYCLES + 1U))
+                {
+                    s_dtcseq_errors++;
+                }
+            }
+            last = rx_host_cycles();
+            k++;
+        }
+    }
+    R_DTCSEQ_Stop();
+    activations = rx_host_dtc_activations() - activations;
+    cmi2 = rx_host_vector_accepted(VECT_CMT2_CMI2) - cmi2;
+
+    /* Stopped: PORTD holds the last step for longer than any step lasts. */
+    start = rx_host_cycles();
+    while ((rx_host_cycles() - start) < (2U * HOST_DTCSEQ_STEP_CYCLES(HOST_DTCSEQ_CMCOR_MAX)))
+    {
+        nop();
+        moved += (PORTD.PODR.BYTE != level) ? 1U : 0U;
+    }
+
+    if ((k != ((uint64_t)steps * s_dtcseq_wraps)) || (activations != k) || (0U != cmi2) || (0U != IR(CMT2,CMI2)) ||
+        (0U != moved))
+    {
+        s_dtcseq_errors++;
+    }
+
+    printf("dtc sequencer   : %3lu steps x %lu wraps, %llu steps seen, %llu DTC activations, %lu CMI2 interrupts, "
+           "worst step error %llu cycles, %lu changes after stop\n", (unsigned long)steps, s_dtcseq_wraps,
+           (unsigned long long)k, (unsigned long long)activations, (unsigned long)cmi2, (unsigned long long)worst,
+           moved);
+}
+
+static void check_dtcseq(void)
+{
+    static const uint32_t s_steps[] = { 2U, 37U, DTCSEQ_STEPS_MAX };
+    uint32_t              saved = g_rx_host_nop_cycles;
+    uint8_t               podr = PORTD.PODR.BYTE;
+    uint32_t              i;
+
+    check_dtcseq_build();
+
+    /* Interrupts stay masked, so the CMT0 LED task cannot write PORTD and the DTC replays on its own. */
+    srand(1);
+    g_rx_host_nop_cycles = HOST_DTCSEQ_NOP_CYCLES;
+    clrpsw_i();
+    for (i = 0; i < (sizeof(s_steps) / sizeof(s_steps[0])); i++)
+    {
+        check_dtcseq_replay(s_steps[i]);
+    }
+    setpsw_i();
+    g_rx_host_nop_cycles = saved;
+
+    PORTD.PODR.BYTE = podr;
+    R_PORT_Open();
+}
+
+/* One r_pin operation: the level it is given or reads, the PORTA registers after it and its register accesses. */
+typedef struct
+{
+    const char  *name;
+    void        (*op)(void);
+    uint8_t     level;
+    uint8_t     podr;
+    uint8_t     pmr;
+    uint8_t     pdr;
+    uint8_t     dscr;
+    const char  *accesses;
+} host_pin_op_t;
+
+/* Register accesses of the last operation, as 'R1 PORTA.PODR W1 PORTA.PODR'. */
+static void pin_accesses(uint64_t since, char *p_text, size_t size)
+{
+    rx_host_trace_entry_t entries[HOST_PIN_ACCESSES_MAX];
+    uint64_t              count = rx_host_trace_total() - since;
+    const char            *name;
+    size_t                used = 0;
+    uint32_t              i;
+
+    p_text[0] = '\0';
+    if (count > HOST_PIN_ACCESSES_MAX)
+    {
+        (void)snprintf(p_text, size, "%llu accesses", (unsigned long long)count);
+        return;
+    }
+    count = rx_host_trace_ring_read(entries, (uint32_t)count);
+    for (i = 0; (i < count) && (used < size); i++)
+    {
+        name = rx_host_trace_register_name(entries[i].peripheral, entries[i].offset);
+        used += (size_t)snprintf(&p_text[used], size - used, "%s%c%u %s.%s", (0U == i) ? "" : " ",
+                                 (0 != (entries[i].access & RX_HOST_TRACE_WRITE)) ? 'W' : 'R',
+                                 (unsigned)(entries[i].access & RX_HOST_TRACE_WIDTH_MASK),
+                                 rx_host_trace_peripheral_name(entries[i].peripheral), (NULL == name) ? "?" : name);
+    }
+}
+
+/* Each operation from the same PORTA state; pins are PA1, groups PA2 to PA5 and all of PORTA. The trace shows a
+   one-bit field write as the single byte write of its BSET or BCLR, and a toggle as the read and write of BNOT. */
+static void check_pins(void)
+{
+    static const host_pin_op_t s_ops[] =
+    {
+        { "pin set",          host_pin_set,              0U,    0xA7U, 0x5AU, 0xA5U, 0xA5U,
+          "W1 PORTA.PODR" },
+        { "pin clear",        host_pin_clear,            0U,    0xA5U, 0x5AU, 0xA5U, 0xA5U,
+          "W1 PORTA.PODR" },
+        { "pin write",        host_pin_write,            1U,    0xA7U, 0x5AU, 0xA5U, 0xA5U,
+          "W1 PORTA.PODR" },
+        { "pin toggle",       host_pin_toggle,           0U,    0xA7U, 0x5AU, 0xA5U, 0xA5U,
+          "R1 PORTA.PODR W1 PORTA.PODR" },
+        { "pin read",         host_pin_read,             1U,    0xA5U, 0x5AU, 0xA5U, 0xA5U,
+          "R1 PORTA.PIDR" },
+        { "pin output",       host_pin_output,           0U,    0xA7U, 0x58U, 0xA7U, 0xA5U,
+          "W1 PORTA.PODR W1 PORTA.PMR W1 PORTA.PDR" },
+        { "pin input",        host_pin_input,            0U,    0xA5U, 0x58U, 0xA5U, 0xA5U,
+          "W1 PORTA.PMR W1 PORTA.PDR" },
+        { "pin peripheral",   host_pin_peripheral,       0U,    0xA5U, 0x5AU, 0xA5U, 0xA5U,
+          "W1 PORTA.PMR" },
+        { "pin drive",        host_pin_drive,            0U,    0xA5U, 0x5AU, 0xA5U, 0xA7U,
+          "W1 PORTA.DSCR" },
+        { "group set",        host_pin_group_set,        0U,    0xBDU, 0x5AU, 0xA5U, 0xA5U,
+          "R1 PORTA.PODR W1 PORTA.PODR" },
+        { "group clear",      host_pin_group_clear,      0U,    0x81U, 0x5AU, 0xA5U, 0xA5U,
+          "R1 PORTA.PODR W1 PORTA.PODR" },
+        { "group write",      host_pin_group_write,      0x0FU, 0x8DU, 0x5AU, 0xA5U, 0xA5U,
+          "R1 PORTA.PODR W1 PORTA.PODR" },
+        { "group toggle",     host_pin_group_toggle,     0U,    0x99U, 0x5AU, 0xA5U, 0xA5U,
+          "R1 PORTA.PODR W1 PORTA.PODR" },
+        { "group output",     host_pin_group_output,     0U,    0x8DU, 0x42U, 0xBDU, 0xA5U,
+          "R1 PORTA.PODR W1 PORTA.PODR R1 PORTA.PMR W1 PORTA.PMR R1 PORTA.PDR W1 PORTA.PDR" },
+        { "group input",      host_pin_group_input,      0U,    0xA5U, 0x42U, 0x81U, 0xA5U,
+          "R1 PORTA.PMR W1 PORTA.PMR R1 PORTA.PDR W1 PORTA.PDR" },
+        { "group peripheral", host_pin_group_peripheral, 0U,    0xA5U, 0x7EU, 0xA5U, 0xA5U,
+          "R1 PORTA.PMR W1 PORTA.PMR" },
+        { "group drive",      host_pin_group_drive,      0U,    0xA5U, 0x5AU, 0xA5U, 0xBDU,
+          "R1 PORTA.DSCR W1 PORTA.DSCR" },
+        { "full output",      host_pin_full_output,      0U,    0x3CU, 0x00U, 0xFFU, 0xA5U,
+          "W1 PORTA.PODR W1 PORTA.PMR W1 PORTA.PDR" },
+        { "full toggle",      host_pin_full_toggle,      0U,    0x5AU, 0x5AU, 0xA5U, 0xA5U,
+          "R1 PORTA.PODR W1 PORTA.PODR" }
+    };
+    char     accesses[128];
+    uint8_t  saved[5];
+    uint64_t since;
+    uint32_t i;
+
+    saved[0] = PORTA.PODR.BYTE;
+    saved[1] = PORTA.PMR.BYTE;
+    saved[2] = PORTA.PDR.BYTE;
+    saved[3] = PORTA.DSCR.BYTE;
+    saved[4] = PORTA.PIDR.BYTE;
+
+    /* Interrupts stay masked, so that the trace holds the operation's accesses only. */
+    clrpsw_i();
+    for (i = 0; i < (sizeof(s_ops) / sizeof(s_ops[0])); i++)
+    {
+        PORTA.PODR.BYTE = HOST_PIN_PODR;
+        PORTA.PMR.BYTE = HOST_PIN_PMR;
+        PORTA.PDR.BYTE = HOST_PIN_PDR;
+        PORTA.DSCR.BYTE = HOST_PIN_DSCR;
+        PORTA.PIDR.BYTE = HOST_PIN_PIDR;
+        g_host_pin_level = (host_pin_read == s_ops[i].op) ? 0U : s_ops[i].level;
+
+        since = rx_host_trace_total();
+        s_ops[i].op();
+        pin_accesses(since, accesses, sizeof(accesses));
+
+        if ((s_ops[i].podr != PORTA.PODR.BYTE) || (s_ops[i].pmr != PORTA.PMR.BYTE) ||
+            (s_ops[i].pdr != PORTA.PDR.BYTE) || (s_ops[i].dscr != PORTA.DSCR.BYTE) ||
+            ((host_pin_read == s_ops[i].op) && (s_ops[i].level != g_host_pin_level)))
+        {
+            printf("pin %-16s: PODR 0x%02x PMR 0x%02x PDR 0x%02x DSCR 0x%02x level %u\n", s_ops[i].name,
+                   (unsigned)PORTA.PODR.BYTE, (unsigned)PORTA.PMR.BYTE, (unsigned)PORTA.PDR.BYTE,
+                   (unsigned)PORTA.DSCR.BYTE, (unsigned)g_host_pin_level);
+            s_pin_errors++;
+        }
+        if ((true == rx_host_trace_available()) && (0 != strcmp(s_ops[i].accesses, accesses)))
+        {
+            printf("pin %-16s: %s, expected %s\n", s_ops[i].name, accesses, s_ops[i].accesses);
+            s_pin_errors++;
+        }
+    }
+    setpsw_i();
+
+    PORTA.PODR.BYTE = saved[0];
+    PORTA.PMR.BYTE = saved[1];
+    PORTA.PDR.BYTE = saved[2];
+    PORTA.DSCR.BYTE = saved[3];
+    PORTA.PIDR.BYTE = saved[4];
+
+    printf("pins            : %lu operations, register accesses %s\n", (unsigned long)i,
+           (true == rx_host_trace_available()) ? "checked" : "not traced, build with 'make TRACE=1'");
+}
+
+/* Runs one package's bsp_non_existent_port_init() from random PDR states against the pins missing from the package
+   (HW Manual Tables 21.4 and 21.5); the 100-pin package has all its pins and is left alone. */
+static void check_non_existent_ports(void)
+{
+    static const uint8_t s_ports[HOST_NE_PORTS] =
+    {
+        0x00U, 0x01U, 0x02U, 0x03U, 0x04U, 0x05U, 0x0AU, 0x0BU, 0x0CU, 0x0DU, 0x0EU, 0x12U
+    };
+    static const struct
+    {
+        uint32_t    pins;
+        void        (*init)(void);
+        uint8_t     masks[HOST_NE_PORTS];
+    } s_packages[] =
+    {
+        { 100U, host_non_existent_port_init_100,
+          { 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U } },
+        { 64U,  host_non_existent_port_init_64,
+          { 0xD7U, 0x0FU, 0x3FU, 0x1CU, 0xA0U, 0xCFU, 0xA4U, 0x14U, 0x03U, 0xFFU, 0xC0U, 0xFFU } },
+        { 48U,  host_non_existent_port_init_48,
+          { 0xFFU, 0x0FU, 0x3FU, 0x1CU, 0xB8U, 0xFFU, 0xA5U, 0xD4U, 0x0FU, 0xFFU, 0xE1U, 0xFFU } }
+    };
+    volatile uint8_t      *p_pdr = &PORT0.PDR.BYTE;
+    rx_host_trace_entry_t entries[HOST_NE_PORTS * 2U];
+    uint8_t               saved[HOST_NE_PDRS];
+    uint8_t               expected[HOST_NE_PDRS];
+    uint64_t              since;
+    uint32_t              count;
+    uint32_t              writes;
+    unsigned long         trial;
+    uint32_t              p;
+    uint32_t              i;
+
+    for (i = 0; i < HOST_NE_PDRS; i++)
+    {
+        saved[i] = p_pdr[i];
+    }
+
+    srand(1);
+    clrpsw_i();
+    for (p = 0; p < (sizeof(s_packages) / sizeof(s_packages[0])); p++)
+    {
+        count = 0;
+        writes = 0;
+        for (trial = 0; trial < s_ne_trials; trial++)
+        {
+            for (i = 0; i < HOST_NE_PDRS; i++)
+            {
+                p_pdr[i] = (uint8_t)rand();
+                expected[i] = p_pdr[i];
+            }
+            for (i = 0; i < HOST_NE_PORTS; i++)
+            {
+                expected[s_ports[i]] |= s_packages[p].masks[i];
+            }
+
+            since = rx_host_trace_total();
+            s_packages[p].init();
+            count = (uint32_t)(rx_host_trace_total() - since);
+            if (count <= (HOST_NE_PORTS * 2U))
+            {
+                count = rx_host_trace_ring_read(entries, count);
+                for (i = 0, writes = 0; i < count; i++)
+                {
+                    writes += (0 != (entries[i].access & RX_HOST_TRACE_WRITE)) ? 1U : 0U;
+
+                    /* PDR is an 8-bit register. */
+                    if (1U != (entries[i].access & RX_HOST_TRACE_WIDTH_MASK))
+                    {
+                        printf("non-existent    : %lu-pin package, %u-byte access at +0x%04x\n",
+                               (unsigned long)s_packages[p].pins,
+                               (unsigned)(entries[i].access & RX_HOST_TRACE_WIDTH_MASK), (unsigned)entries[i].offset);
+                        s_ne_errors++;
+                    }
+                }
+            }
+
+            for (i = 0; i < HOST_NE_PDRS; i++)
+            {
+                if (expected[i] != p_pdr[i])
+                {
+                    printf("non-existent    : %lu-pin package, PDR +0x%02lx is 0x%02x, expected 0x%02x\n",
+                           (unsigned long)s_packages[p].pins, (unsigned long)i, (unsigned)p_pdr[i],
+                           (unsigned)expected[i]);
+                    s_ne_errors++;
+                }
+            }
+        }
+
+        if (true == rx_host_trace_available())
+        {
+            printf("non-existent    : %3lu-pin package, %lu trials, %lu R %lu W per call\n",
+                   (unsigned long)s_packages[p].pins, s_ne_trials, (unsigned long)(count - writes),
+                   (unsigned long)writes);
+        }
+    }
+    setpsw_i();
+
+    for (i = 0; i < HOST_NE_PDRS; i++)
+    {
+        p_pdr[i] = saved[i];
+    }
+}
+
+/* The boot timeline of a boot with the given HOCO stabilization time against the model; the final mark stops CMT3,
+   so no count is missing. The HOCO wait is the one stage that takes time without -a. */
+static void check_boottime_boot(uint32_t hoco_us)
+{
+    boottime_span_t span;
+    uint64_t        counts = 0;
+    uint64_t        model;
+    uint32_t        saturated = 0;
+    uint32_t        stage;
+
+    rx_host_osc_delay(RX_HOST_OSC_HOCO, hoco_us);
+    rx_host_reset();
+    rx_host_run(PowerON_Reset_PC, HOST_BOOT_CYCLES);
+    model = rx_host_cmt_counts(3);
+
+    R_BOOTTIME_Print();
+    for (stage = 0; stage < BOOTTIME_STAGES; stage++)
+    {
+        if (false == R_BOOTTIME_GetStage((boottime_stage_t)stage, &span))
+        {
+            printf("boot %-10s: not marked\n", R_BOOTTIME_StageName((boottime_stage_t)stage));
+            s_boot_errors++;
+            continue;
+        }
+        counts += span.counts;
+        saturated += (true == span.saturated) ? 1U : 0U;
+
+        /* The stages up to the clock switch start at the reset clock; every later stage runs at the configured
+           PCLKB. The host builds with CLKSTAGE_CFG_ENABLE, which adds the switch stage. */
+        if ((stage > BOOTTIME_STAGE_SWITCH) ? (rx_host_clock_hz(RX_HOST_CLOCK_PCLKB) != span.pclkb_hz) :
+            (span.pclkb_hz >= BSP_PCLKB_HZ))
+        {
+            s_boot_errors++;
+        }
+    }
+
+    /* Up to a turn the record is exact. Past one, a stage that turned over is saturated and may miss whole turns. */
+    if ((0U == counts) || (counts > model) || (0U != ((model - counts) % HOST_BOOT_TURN)) ||
+        ((model < HOST_BOOT_TURN) ? (0U != saturated) : (0U == saturated)))
+    {
+        s_boot_errors++;
+    }
+    if ((0 != (CMT.CMSTR1.WORD & 0x0002U)) || (0 != CMT3.CMCR.BIT.CMIE) || (0 != IR(CMT3,CMI3)) ||
+        (R_BOOTTIME_GetStage(BOOTTIME_STAGES, &span)) || (R_BOOTTIME_GetStage(BOOTTIME_STAGE_CLOCK, NULL)))
+    {
+        s_boot_errors++;
+    }
+    printf("boot counts     : %llu in the record, %llu counted by the CMT3 model, %lu stages saturated\n",
+           (unsigned long long)counts, (unsigned long long)model, (unsigned long)saturated);
+}
+
+/* A boot within one CMT3 turn, then one that runs over two. */
+static void check_boottime(void)
+{
+    check_boottime_boot(HOST_BOOT_HOCO_US);
+    check_boottime_boot(HOST_BOOT_LONG_HOCO_US);
+    rx_host_osc_delay(RX_HOST_OSC_HOCO, 0U);
+}
+
+/* Every destination and source alignment against the byte-by-byte reference, with the bytes around the area. */
+static void check_initsct_areas(void)
+{
+    static uint8_t s_src[HOST_INITSCT_ALIGNS + HOST_INITSCT_LENGTHS];
+    static uint8_t s_dst[(2U * HOST_INITSCT_GUARD) + HOST_INITSCT_ALIGNS + HOST_INITSCT_LENGTHS];
+    uint8_t        *p_dst;
+    uint8_t        expected;
+    uint32_t       d;
+    uint32_t       so;
+    uint32_t       n;
+    uint32_t       i;
+
+    for (i = 0; i < sizeof(s_src); i++)
+    {
+        s_src[i] = (uint8_t)(rand() | 1);
+    }
+
+    for (d = 0; d < HOST_INITSCT_ALIGNS; d++)
+    {
+        p_dst = &s_dst[HOST_INITSCT_GUARD + d];
+        for (n = 0; n < HOST_INITSCT_LENGTHS; n++)
+        {
+            /* The source alignment HOST_INITSCT_ALIGNS stands for the clear. */
+            for (so = 0; so <= HOST_INITSCT_ALIGNS; so++)
+            {
+                memset(s_dst, HOST_INITSCT_FILL, sizeof(s_dst));
+                if (so < HOST_INITSCT_ALIGNS)
+                {
+                    R_INITSCT_Copy(p_dst, &s_src[so], n);
+                }
+                else
+                {
+                    R_INITSCT_Zero(p_dst, n);
+                }
+                for (i = 0; i < sizeof(s_dst); i++)
+                {
+                    expected = HOST_INITSCT_FILL;
+                    if ((&s_dst[i] >= p_dst) && (&s_dst[i] < (p_dst + n)))
+                    {
+                        expected = (so < HOST_INITSCT_ALIGNS) ? s_src[so + (uint32_t)(&s_dst[i] - p_dst)] : 0U;
+                    }
+                    if (expected != s_dst[i])
+                    {
+                        s_initsct_errors++;
+                    }
+                }
+            }
+        }
+    }
+}
+
+/* Host time per Kbyte of R_INITSCT_Copy()/Zero() and of byte loops like the toolchain's, best of a few runs. */
+static void bench_initsct(void)
+{
+    static uint8_t    s_src[HOST_INITSCT_BENCH + 1U];
+    static uint8_t    s_dst[HOST_INITSCT_BENCH + 1U];
+    volatile uint8_t  *p_dst = &s_dst[1];
+    uint64_t          t[5];
+    double            kbytes = (double)HOST_INITSCT_BENCH / 1024.0;
+    double            ns[4] = { 0.0, 0.0, 0.0, 0.0 };
+    uint32_t          run;
+    uint32_t          i;
+    uint32_t          k;
+
+    memset(s_src, 0x5A, sizeof(s_src));
+    memset(s_dst, 0, sizeof(s_dst));
+    for (run = 0; run < HOST_INITSCT_RUNS; run++)
+    {
+        t[0] = host_ns();
+        R_INITSCT_Copy(&s_dst[1], &s_src[1], HOST_INITSCT_BENCH);
+        t[1] = host_ns();
+        R_INITSCT_Zero(&s_dst[1], HOST_INITSCT_BENCH);
+        t[2] = host_ns();
+        for (i = 0; i < HOST_INITSCT_BENCH; i++)
+        {
+            p_dst[i] = s_src[i + 1U];
+        }
+        t[3] = host_ns();
+        for (i = 0; i < HOST_INITSCT_BENCH; i++)
+        {
+            p_dst[i] = 0U;
+        }
+        t[4] = host_ns();
+        for (k = 0; k < 4U; k++)
+        {
+            if ((0 == run) || ((double)(t[k + 1U] - t[k]) < ns[k]))
+            {
+                ns[k] = (double)(t[k + 1U] - t[k]);
+            }
+        }
+    }
+
+    printf("initsct speed   : copy %.1f ns/KB (byte loop %.1f), clear %.1f ns/KB (byte loop %.1f)\n",
+           ns[0] / kbytes, ns[2] / kbytes, ns[1] / kbytes, ns[3] / kbytes);
+}
+
+/* The section tables: R_INITSCT_Run() must restore the firmware's uninitialized data to zero. */
+static void check_initsct(void)
+{
+    srand(1);
+    check_initsct_areas();
+    bench_initsct();
+
+    g_host_pin_level = 0x55U;
+    clrpsw_i();
+    R_INITSCT_Run();
+    if (0U != g_host_pin_level)
+    {
+        s_initsct_errors++;
+    }
+    printf("initsct areas   : %u alignments x %u alignments x %u lengths, copy and clear\n",
+           (unsigned)HOST_INITSCT_ALIGNS, (unsigned)HOST_INITSCT_ALIGNS, (unsigned)HOST_INITSCT_LENGTHS);
+}
+
+/* Packs and unpacks data between guard bytes; returns the packed size. */
+static size_t zsect_round_trip(const uint8_t *p_data, uint32_t size)
+{
+    static uint8_t s_packed[HOST_ZSECT_MAX + (HOST_ZSECT_MAX / 255U) + 16U];
+    static uint8_t s_dst[(2U * HOST_INITSCT_GUARD) + HOST_ZSECT_MAX + 1U];
+    uint8_t        *p_dst = &s_dst[HOST_INITSCT_GUARD];
+    size_t         packed;
+    uint32_t       i;
+
+    packed = lz4_pack(p_data, size, s_packed, sizeof(s_packed));
+    memset(s_dst, HOST_INITSCT_FILL, sizeof(s_dst));
+    if ((0U == packed) || (packed > lz4_pack_bound(size)) ||
+        (false == R_INITSCT_Unpack(p_dst, size, s_packed, (uint32_t)packed)) || (0 != memcmp(p_dst, p_data, size)))
+    {
+        s_zsect_errors++;
+    }
+    for (i = 0; i < HOST_INITSCT_GUARD; i++)
+    {
+        if ((HOST_INITSCT_FILL != s_dst[i]) || (HOST_INITSCT_FILL != p_dst[size + i]))
+        {
+            s_zsect_errors++;
+        }
+    }
+
+    /* The area must be filled exactly, and a stream cut short anywhere is incomplete. */
+    if ((R_INITSCT_Unpack(p_dst, size + 1U, s_packed, (uint32_t)packed)) ||
+        ((0U != size) && (R_INITSCT_Unpack(p_dst, size - 1U, s_packed, (uint32_t)packed))) ||
+        ((0U != size) && (R_INITSCT_Unpack(p_dst, size, s_packed, (uint32_t)packed - 1U))))
+    {
+        s_zsect_errors++;
+    }
+
+    return packed;
+}
+
+/* Damaged streams: whatever they unpack to, nothing outside the area may be written. */
+static void check_zsect_damaged(const uint8_t *p_data, uint32_t size)
+{
+    static uint8_t       s_packed[HOST_ZSECT_MAX + (HOST_ZSECT_MAX / 255U) + 16U];
+    static uint8_t       s_dst[(2U * HOST_INITSCT_GUARD) + HOST_ZSECT_MAX];
+    static const uint8_t s_offset_0[] = { 0x10U, 0x41U, 0x00U, 0x00U, 0x00U };
+    static const uint8_t s_offset_far[] = { 0x10U, 0x41U, 0x02U, 0x00U, 0x00U };
+    static const uint8_t s_count_cut[] = { 0xF0U, 0xFFU, 0xFFU };
+    uint8_t              *p_dst = &s_dst[HOST_INITSCT_GUARD];
+    size_t               packed = lz4_pack(p_data, size, s_packed, sizeof(s_packed));
+    uint32_t             trial;
+    uint32_t             at;
+    uint32_t             i;
+
+    if ((R_INITSCT_Unpack(p_dst, 5U, s_offset_0, sizeof(s_offset_0))) ||
+        (R_INITSCT_Unpack(p_dst, 5U, s_offset_far, sizeof(s_offset_far))) ||
+        (R_INITSCT_Unpack(p_dst, 600U, s_count_cut, sizeof(s_count_cut))))
+    {
+        s_zsect_errors++;
+    }
+
+    for (trial = 0; trial < HOST_ZSECT_DAMAGED; trial++)
+    {
+        at = (uint32_t)rand() % (uint32_t)packed;
+        s_packed[at] ^= (uint8_t)(1U << (rand() & 7));
+        memset(s_dst, HOST_INITSCT_FILL, sizeof(s_dst));
+        (void)R_INITSCT_Unpack(p_dst, size, s_packed, (uint32_t)packed);
+        for (i = 0; i < HOST_INITSCT_GUARD; i++)
+        {
+            if ((HOST_INITSCT_FILL != s_dst[i]) || (HOST_INITSCT_FILL != p_dst[size + i]))
+            {
+                s_zsect_errors++;
+            }
+        }
+        s_packed[at] ^= (uint8_t)(1U << (rand() & 7));
+        (void)lz4_pack(p_data, size, s_packed, sizeof(s_packed));
+    }
+}
+
+/* Ratio, and host time per unpacked Kbyte of packing and unpacking against a plain copy, best of a few runs. */
+static void bench_zsect(const char *name, const uint8_t *p_data, uint32_t size)
+{
+    static uint8_t s_packed[HOST_ZSECT_MAX + (HOST_ZSECT_MAX / 255U) + 16U];
+    static uint8_t s_dst[HOST_ZSECT_MAX];
+    uint64_t       t[4];
+    double         kbytes = (double)size / 1024.0;
+    double         ns[3] = { 0.0, 0.0, 0.0 };
+    size_t         packed = 0U;
+    uint32_t       run;
+    uint32_t       k;
+
+    memset(s_dst, 0, sizeof(s_dst));
+    for (run = 0; run < HOST_INITSCT_RUNS; run++)
+    {
+        t[0] = host_ns();
+        packed = lz4_pack(p_data, size, s_packed, sizeof(s_packed));
+        t[1] = host_ns();
+        (void)R_INITSCT_Unpack(s_dst, size, s_packed, (uint32_t)packed);
+        t[2] = host_ns();
+        R_INITSCT_Copy(s_dst, p_data, size);
+        t[3] = host_ns();
+        for (k = 0; k < 3U; k++)
+        {
+            if ((0 == run) || ((double)(t[k + 1U] - t[k]) < ns[k]))
+            {
+                ns[k] = (double)(t[k + 1U] - t[k]);
+            }
+        }
+    }
+
+    printf("zsect %-10s: %6lu -> %6lu bytes (%5.1f %%), pack %.1f ns/KB, unpack %.1f ns/KB (copy %.1f)\n", name,
+           (unsigned long)size, (unsigned long)packed, (100.0 * (double)packed) / (double)size, ns[0] / kbytes,
+           ns[1] / kbytes, ns[2] / kbytes);
+}
+
+/* R_INITSCT_Run() on a C$ZSEC table like zsect writes; the damaged area must be left cleared. A C$DSEC entry for a
+   packed area must not be copied, as its ROM image is left unprogrammed; another one must. */
+static void check_zsect_run(const uint8_t *p_data, uint32_t size)
+{
+    static uint8_t s_packed[2][HOST_ZSECT_MAX + (HOST_ZSECT_MAX / 255U) + 16U];
+    static uint8_t s_area[3][HOST_ZSECT_MAX];
+    static uint8_t s_copied[HOST_ZSECT_MAX];
+    static struct
+    {
+        uint8_t *packed_s;
+        uint8_t *packed_e;
+        uint8_t *ram_s;
+        uint8_t *ram_e;
+    } s_ztbl[3];
+    static struct
+    {
+        uint8_t *rom_s;
+        uint8_t *rom_e;
+        uint8_t *ram_s;
+    } s_dtbl[2];
+    size_t         packed[2];
+    uint32_t       i;
+
+    packed[0] = lz4_pack(p_data, size, s_packed[0], sizeof(s_packed[0]));
+    packed[1] = lz4_pack(p_data + 1, size - 1U, s_packed[1], sizeof(s_packed[1]));
+    for (i = 0; i < 3U; i++)
+    {
+        s_ztbl[i].packed_s = s_packed[(i < 2U) ? i : 0U];
+        s_ztbl[i].packed_e = s_ztbl[i].packed_s + packed[(i < 2U) ? i : 0U];
+        s_ztbl[i].ram_s = &s_area[i][i];
+        s_ztbl[i].ram_e = s_ztbl[i].ram_s + (size - ((i < 2U) ? i : 0U));
+    }
+    s_ztbl[2].packed_e -= 1;
+
+    /* An address the host does not map, so a copy from it faults. */
+    s_dtbl[0].rom_s = (uint8_t *)(uintptr_t)HOST_ZSECT_UNMAPPED;
+    s_dtbl[0].rom_e = s_dtbl[0].rom_s + size;
+    s_dtbl[0].ram_s = s_ztbl[0].ram_s;
+    s_dtbl[1].rom_s = (uint8_t *)p_data;
+    s_dtbl[1].rom_e = s_dtbl[1].rom_s + size;
+    s_dtbl[1].ram_s = s_copied;
+
+    memset(s_area, HOST_INITSCT_FILL, sizeof(s_area));
+    memset(s_copied, HOST_INITSCT_FILL, sizeof(s_copied));
+    rx_host_section_set("C$ZSEC", &s_ztbl[0], &s_ztbl[3]);
+    rx_host_section_set("C$DSEC", &s_dtbl[0], &s_dtbl[2]);
+    clrpsw_i();
+    R_INITSCT_Run();
+    rx_host_section_set(NULL, NULL, NULL);
+
+    if ((0 != memcmp(s_ztbl[0].ram_s, p_data, size)) || (0 != memcmp(s_ztbl[1].ram_s, p_data + 1, size - 1U)) ||
+        (0 != memcmp(s_copied, p_data, size)))
+    {
+        s_zsect_errors++;
+    }
+    for (i = 0; i < size; i++)
+    {
+        if (0U != s_ztbl[2].ram_s[i])
+        {
+            s_zsect_errors++;
+        }
+    }
+    if ((HOST_INITSCT_FILL != s_area[1][0]) || (HOST_INITSCT_FILL != s_area[2][1]) ||
+        (HOST_INITSCT_FILL != s_area[2][size + 2U]))
+    {
+        s_zsect_errors++;
+    }
+}
+
+static void check_zsect(void)
+{
+    static uint8_t s_data[HOST_ZSECT_MAX];
+    uint32_t       n;
+    uint32_t       i;
+
+    srand(1);
+
+    /* Short data from a small alphabet, so that some of it has matches. */
+    for (n = 0; n <= HOST_ZSECT_SMALL; n++)
+    {
+        for (i = 0; i < n; i++)
+        {
+            s_data[i] = (uint8_t)('a' + (rand() % 3));
+        }
+        (void)zsect_round_trip(s_data, n);
+    }
+
+    /* Zeros, a short repeat (overlapping matches) and random bytes (no matches) */
+    memset(s_data, 0, sizeof(s_data));
+    (void)zsect_round_trip(s_data, HOST_ZSECT_MAX);
+    bench_zsect("zeros", s_data, HOST_ZSECT_MAX);
+    for (i = 0; i < HOST_ZSECT_MAX; i++)
+    {
+        s_data[i] = (uint8_t)("RX231 "[i % 6U]);
+    }
+    (void)zsect_round_trip(s_data, HOST_ZSECT_MAX);
+    bench_zsect("repeat", s_data, HOST_ZSECT_MAX);
+    for (i = 0; i < HOST_ZSECT_MAX; i++)
+    {
+        s_data[i] = (uint8_t)rand();
+    }
+    (void)zsect_round_trip(s_data, HOST_ZSECT_MAX);
+    bench_zsect("random", s_data, HOST_ZSECT_MAX);
+
+    /* Initial data like an application's (the firmware itself has none): tables of small values with gaps of zeros,
+       and strings */
+    memset(s_data, 0, sizeof(s_data));
+    for (i = 0; i < HOST_ZSECT_MAX; i += 4U)
+    {
+        if (0 != (rand() % 3))
+        {
+            s_data[i] = (uint8_t)(rand() % 32);
+        }
+        if (0U == (i % 512U))
+        {
+            i += (uint32_t)sprintf((char *)&s_data[i], "table %lu: gain %d, limit %d", (unsigned long)(i / 512U),
+                                   rand() % 100, rand() % 1000);
+        }
+    }
+    (void)zsect_round_trip(s_data, HOST_ZSECT_MAX);
+    bench_zsect("tables", s_data, HOST_ZSECT_MAX);
+    check_zsect_damaged(s_data, HOST_ZSECT_RUN);
+    check_zsect_run(s_data, HOST_ZSECT_RUN);
+}
+
+/* The registry after R_CLOCK_Refresh() against the model and, for ICLK, the BSP's decoder. */
+static void check_clock_decode(uint32_t sckcr)
+{
+    uint32_t i;
+
+    SYSTEM.SCKCR.LONG = sckcr;
+    R_CLOCK_Refresh();
+    for (i = 0; i < CLOCKS; i++)
+    {
+        if (R_CLOCK_GetHz((clock_id_t)i) != rx_host_clock_hz((rx_host_clock_t)i))
+        {
+            s_clock_errors++;
+        }
+    }
+    if (R_CLOCK_GetHz(CLOCK_ICLK) != get_iclk_freq_hz())
+    {
+        s_clock_errors++;
+    }
+}
+
+/* SCKCR with the divider fields ICK, PCKA, PCKB, PCKD, FCK and BCK set to field values 0 to 6. */
+static uint32_t clock_sckcr(const uint32_t *p_fields)
+{
+    return (p_fields[4] << 28) | (p_fields[0] << 24) | (p_fields[5] << 16) | (p_fields[1] << 12) |
+           (p_fields[2] << 8) | p_fields[3];
+}
+
+/* Every source setting: field i of combination (v, r) is v + i * r mod 7, so any two fields take every pair of
+   values; the LOCO also takes every combination. */
+static unsigned long check_clock_sources(void)
+{
+    uint32_t      fields[CLOCKS];
+    uint32_t      combination;
+    unsigned long checked = 0;
+    uint32_t      stc;
+    uint32_t      src;
+    uint32_t      v;
+    uint32_t      r;
+    uint32_t      i;
+
+    for (combination = 0; combination < (HOST_CLOCK_DIVS * HOST_CLOCK_DIVS * HOST_CLOCK_DIVS * HOST_CLOCK_DIVS *
+                                         HOST_CLOCK_DIVS * HOST_CLOCK_DIVS); combination++)
+    {
+        for (i = 0, v = combination; i < CLOCKS; i++, v /= HOST_CLOCK_DIVS)
+        {
+            fields[i] = v % HOST_CLOCK_DIVS;
+        }
+        SYSTEM.SCKCR3.WORD = 0x0000U;
+        check_clock_decode(clock_sckcr(fields));
+        checked++;
+    }
+
+    for (src = 0; src < (sizeof(s_clock_sources) / sizeof(s_clock_sources[0])); src++)
+    {
+        for (stc = HOST_CLOCK_STC_MIN; stc <= HOST_CLOCK_STC_MAX; stc++)
+        {
+            SYSTEM.SCKCR3.WORD = (uint16_t)(s_clock_sources[src][0] << 8);
+            SYSTEM.HOCOCR2.BIT.HCFRQ = s_clock_sources[src][1];
+            SYSTEM.PLLCR.BIT.PLIDIV = s_clock_sources[src][2];
+            SYSTEM.PLLCR.BIT.STC = stc;
+            for (v = 0; v < HOST_CLOCK_DIVS; v++)
+            {
+                for (r = 0; r < HOST_CLOCK_DIVS; r++)
+                {
+                    for (i = 0; i < CLOCKS; i++)
+                    {
+                        fields[i] = (v + (i * r)) % HOST_CLOCK_DIVS;
+                    }
+                    check_clock_decode(clock_sckcr(fields));
+                    checked++;
+                }
+            }
+
+            /* Only the PLL depends on STC. */
+            if (4U != s_clock_sources[src][0])
+            {
+                break;
+            }
+        }
+    }
+
+    return checked;
+}
+
+static void clock_notify(uint32_t changed, void *p_context)
+{
+    uint32_t n = (uint32_t)(uintptr_t)p_context;
+
+    s_clock_notified[n]++;
+    if (0U != (changed & CLOCK_BEFORE))
+    {
+        s_clock_before[n] = changed;
+    }
+    else
+    {
+        s_clock_changed[n] = changed;
+    }
+    s_clock_order = (s_clock_order * 2U) + n;
+}
+
+/* One switch: its result against a decoder of its own, and the registry, the clock registers and the calls. */
+static void check_clock_switch(const clock_setting_t *p_setting, clock_err_t expected)
+{
+    uint32_t    before[CLOCKS];
+    uint32_t    sckcr = SYSTEM.SCKCR.LONG;
+    uint16_t    sckcr3 = SYSTEM.SCKCR3.WORD;
+    uint32_t    changed = 0U;
+    uint32_t    i;
+    clock_err_t err;
+
+    for (i = 0; i < CLOCKS; i++)
+    {
+        before[i] = R_CLOCK_GetHz((clock_id_t)i);
+    }
+    s_clock_notified[0] = 0;
+    s_clock_notified[1] = 0;
+    s_clock_order = 1U;
+
+    err = R_CLOCK_Switch(p_setting);
+    if (err != expected)
+    {
+        printf("clock switch    : source %u gave %d, expected %d\n", (unsigned)p_setting->source, (int)err,
+               (int)expected);
+        s_clock_errors++;
+    }
+    if (CLOCK_SUCCESS != err)
+    {
+        if ((sckcr != SYSTEM.SCKCR.LONG) || (sckcr3 != SYSTEM.SCKCR3.WORD) || (0 != s_clock_notified[0]) ||
+            (0 != s_clock_notified[1]))
+        {
+            s_clock_errors++;
+        }
+        return;
+    }
+
+    for (i = 0; i < CLOCKS; i++)
+    {
+        if (R_CLOCK_GetHz((clock_id_t)i) != rx_host_clock_hz((rx_host_clock_t)i))
+        {
+            s_clock_errors++;
+        }
+        if (R_CLOCK_GetHz((clock_id_t)i) != before[i])
+        {
+            changed |= CLOCK_BIT(i);
+        }
+    }
+    if ((R_CLOCK_GetHz(CLOCK_ICLK) != get_iclk_freq_hz()) || ((uint32_t)p_setting->source != SYSTEM.SCKCR3.BIT.CKSEL))
+    {
+        s_clock_errors++;
+    }
+
+    /* Both subscribers before and after the switch, in the order they subscribed, with the clocks that changed;
+       neither if none did. */
+    if ((0U == changed) ? ((0 != s_clock_notified[0]) || (0 != s_clock_notified[1])) :
+        ((2 != s_clock_notified[0]) || (2 != s_clock_notified[1]) || (changed != s_clock_changed[0]) ||
+         (changed != s_clock_changed[1]) || ((CLOCK_BEFORE | changed) != s_clock_before[0]) ||
+         ((CLOCK_BEFORE | changed) != s_clock_before[1]) || (0x15U != s_clock_order)))
+    {
+        s_clock_errors++;
+    }
+}
+
+/* A software delay at the clock of the last switch, timed by the model. */
+static void check_clock_delay(void)
+{
+    uint64_t t0 = rx_host_time_ns();
+    uint64_t elapsed;
+    uint64_t slack = ((uint64_t)HOST_CLOCK_DELAY_SLACK * 1000000000ULL) / R_CLOCK_GetHz(CLOCK_ICLK);
+
+    (void)R_BSP_SoftwareDelay(HOST_CLOCK_DELAY_US, BSP_DELAY_MICROSECS);
+    elapsed = rx_host_time_ns() - t0;
+    if ((elapsed + slack < (HOST_CLOCK_DELAY_US * 1000ULL)) || (elapsed > (HOST_CLOCK_DELAY_US * 1000ULL) + slack))
+    {
+        printf("clock delay     : %llu ns at ICLK %lu Hz\n", (unsigned long long)elapsed,
+               (unsigned long)R_CLOCK_GetHz(CLOCK_ICLK));
+        s_clock_errors++;
+    }
+}
+
+/* Random switches between every source with every source running, some of them stopped for the call. */
+static void check_clock_switches(void)
+{
+    clock_setting_t setting;
+    clock_err_t     expected;
+    uint32_t        shift[CLOCKS];
+    unsigned long   results[CLOCK_ERR_MODE + 1] = { 0 };
+    unsigned long   n;
+    uint32_t        i;
+    bool            stop;
+
+    srand(1);
+    for (n = 0; n < s_clock_trials; n++)
+    {
+        setting.source = (clock_source_t)((uint32_t)rand() % (CLOCK_SOURCE_PLL + 1U));
+        for (i = 0; i < CLOCKS; i++)
+        {
+            shift[i] = (uint32_t)rand() % HOST_CLOCK_DIVS;
+            setting.div[i] = (uint8_t)(1U << shift[i]);
+        }
+        stop = ((setting.source != (clock_source_t)SYSTEM.SCKCR3.BIT.CKSEL) && (0 == (rand() % 8)));
+
+        expected = CLOCK_SUCCESS;
+        if ((shift[CLOCK_ICLK] > shift[CLOCK_FCLK]) || (shift[CLOCK_ICLK] > shift[CLOCK_PCLKB]) ||
+            (shift[CLOCK_ICLK] > shift[CLOCK_BCLK]))
+        {
+            expected = CLOCK_ERR_INVALID_ARG;
+        }
+        else if (true == stop)
+        {
+            expected = CLOCK_ERR_NOT_STABLE;
+        }
+
+        if (true == stop)
+        {
+            switch (setting.source)
+            {
+                case CLOCK_SOURCE_HOCO: SYSTEM.HOCOCR.BYTE = 0x01U; break;
+                case CLOCK_SOURCE_MAIN: SYSTEM.MOSCCR.BYTE = 0x01U; break;
+                case CLOCK_SOURCE_SUB:  SYSTEM.SOSCCR.BYTE = 0x01U; break;
+                case CLOCK_SOURCE_PLL:  SYSTEM.PLLCR2.BYTE = 0x01U; break;
+                default:                SYSTEM.LOCOCR.BYTE = 0x01U; break;
+            }
+        }
+        check_clock_switch(&setting, expected);
+        results[expected]++;
+        SYSTEM.HOCOCR.BYTE = 0x00U;
+        SYSTEM.MOSCCR.BYTE = 0x00U;
+        SYSTEM.SOSCCR.BYTE = 0x00U;
+        SYSTEM.PLLCR2.BYTE = 0x00U;
+        SYSTEM.LOCOCR.BYTE = 0x00U;
+
+        if ((CLOCK_SUCCESS == expected) && (0 == (n % 16U)))
+        {
+            check_clock_delay();
+        }
+    }
+    printf("clock switches  : %lu switched, %lu refused as invalid, %lu with the source stopped\n",
+           results[CLOCK_SUCCESS], results[CLOCK_ERR_INVALID_ARG], results[CLOCK_ERR_NOT_STABLE]);
+}
+
+/* The argument, mode and subscriber checks. */
+static void check_clock_refusals(void)
+{
+    clock_setting_t setting = { CLOCK_SOURCE_HOCO, { 1U, 1U, 2U, 2U, 2U, 2U } };
+
+    check_clock_switch(NULL, CLOCK_ERR_NULL_PTR);
+    setting.source = (clock_source_t)5;
+    check_clock_switch(&setting, CLOCK_ERR_INVALID_ARG);
+    setting.source = CLOCK_SOURCE_HOCO;
+    setting.div[CLOCK_PCLKD] = 3U;
+    check_clock_switch(&setting, CLOCK_ERR_INVALID_ARG);
+    setting.div[CLOCK_PCLKD] = 128U;
+    check_clock_switch(&setting, CLOCK_ERR_INVALID_ARG);
+    setting.div[CLOCK_PCLKD] = 0U;
+    check_clock_switch(&setting, CLOCK_ERR_INVALID_ARG);
+    setting.div[CLOCK_PCLKD] = 2U;
+
+    /* 54 MHz is too fast for middle-speed operation, for no flash wait states and for low-speed operation. */
+    SYSTEM.OPCCR.BYTE = 0x02U;
+    check_clock_switch(&setting, CLOCK_ERR_MODE);
+    setting.source = CLOCK_SOURCE_LOCO;
+    check_clock_switch(&setting, CLOCK_SUCCESS);
+    SYSTEM.OPCCR.BYTE = 0x00U;
+    SYSTEM.MEMWAIT.BYTE = 0x00U;
+    setting.source = CLOCK_SOURCE_HOCO;
+    check_clock_switch(&setting, CLOCK_ERR_MODE);
+    SYSTEM.MEMWAIT.BYTE = 0x01U;
+    SYSTEM.SOPCCR.BYTE = 0x01U;
+    setting.source = CLOCK_SOURCE_LOCO;
+    check_clock_switch(&setting, CLOCK_ERR_MODE);
+    SYSTEM.SOPCCR.BYTE = 0x00U;
+
+    /* A subscriber once only; once removed, it is not called. */
+    if ((CLOCK_ERR_INVALID_ARG != R_CLOCK_Subscribe(&s_clock_subscribers[0], clock_notify, (void *)0)) ||
+        (CLOCK_ERR_NULL_PTR != R_CLOCK_Subscribe(NULL, clock_notify, NULL)) ||
+        (CLOCK_ERR_NULL_PTR != R_CLOCK_Subscribe(&s_clock_subscribers[0], NULL, NULL)) ||
+        (CLOCK_SUCCESS != R_CLOCK_Unsubscribe(&s_clock_subscribers[0])) ||
+        (CLOCK_ERR_INVALID_ARG != R_CLOCK_Unsubscribe(&s_clock_subscribers[0])))
+    {
+        s_clock_errors++;
+    }
+    setting.source = CLOCK_SOURCE_HOCO;
+    s_clock_notified[0] = 0;
+    s_clock_notified[1] = 0;
+    if ((CLOCK_SUCCESS != R_CLOCK_Switch(&setting)) || (0 != s_clock_notified[0]) || (2 != s_clock_notified[1]))
+    {
+        s_clock_errors++;
+    }
+    (void)R_CLOCK_Unsubscribe(&s_clock_subscribers[1]);
+}
+
+/* Host time of an ICLK read from the registry and from the register decoder. */
+static void bench_clock(void)
+{
+    volatile uint32_t sink = 0;
+    unsigned long     i;
+    uint64_t          t0;
+    uint64_t          t1;
+    uint64_t          t2;
+
+    t0 = host_ns();
+    for (i = 0; i < HOST_CLOCK_READS; i++)
+    {
+        sink += R_BSP_GetIClkFreqHz();
+    }
+    t1 = host_ns();
+    for (i = 0; i < HOST_CLOCK_READS; i++)
+    {
+        sink += get_iclk_freq_hz();
+    }
+    t2 = host_ns();
+    printf("clock read      : %.1f ns from the registry, %.1f ns decoding the registers\n",
+           (double)(t1 - t0) / HOST_CLOCK_READS, (double)(t2 - t1) / HOST_CLOCK_READS);
+    (void)sink;
+}
+
+/* The setting a pair of SCKCR and SCKCR3 values select. */
+static void clock_setting_of(uint32_t sckcr, uint16_t sckcr3, clock_setting_t *p_setting)
+{
+    static const uint8_t s_shift[CLOCKS] = { 24U, 12U, 8U, 0U, 28U, 16U };
+    uint32_t i;
+
+    p_setting->source = (clock_source_t)((sckcr3 >> 8) & 0x7U);
+    for (i = 0; i < CLOCKS; i++)
+    {
+        p_setting->div[i] = (uint8_t)(1U << ((sckcr >> s_shift[i]) & 0xFU));
+    }
+}
+
+/* Firmware side of the -C check; the clock registers are put back at the end, the clock itself by a switch so that
+   the subscribers (CMT0) follow. */
+static void check_clock(void)
+{
+    uint32_t sckcr = SYSTEM.SCKCR.LONG;
+    uint16_t sckcr3 = SYSTEM.SCKCR3.WORD;
+    uint8_t  hococr = SYSTEM.HOCOCR.BYTE;
+    uint8_t  hococr2 = SYSTEM.HOCOCR2.BYTE;
+    uint8_t  mosccr = SYSTEM.MOSCCR.BYTE;
+    uint8_t  sosccr = SYSTEM.SOSCCR.BYTE;
+    uint8_t  lococr = SYSTEM.LOCOCR.BYTE;
+    uint16_t pllcr = SYSTEM.PLLCR.WORD;
+    uint8_t  pllcr2 = SYSTEM.PLLCR2.BYTE;
+    uint8_t  opccr = SYSTEM.OPCCR.BYTE;
+    uint8_t  sopccr = SYSTEM.SOPCCR.BYTE;
+    uint8_t  memwait = SYSTEM.MEMWAIT.BYTE;
+    clock_setting_t setting;
+    unsigned long checked;
+
+    bench_clock();
+    checked = check_clock_sources();
+    printf("clock decode    : %lu source and divider settings\n", checked);
+
+    /* Every source running, the PLL at 54 MHz from the 8 MHz main clock. */
+    SYSTEM.SCKCR3.WORD = sckcr3;
+    SYSTEM.HOCOCR2.BYTE = hococr2;
+    SYSTEM.PLLCR.WORD = pllcr;
+    SYSTEM.PLLCR.BIT.PLIDIV = 1U;
+    SYSTEM.PLLCR.BIT.STC = 26U;
+    SYSTEM.SCKCR.LONG = sckcr;
+    R_CLOCK_Refresh();
+    (void)R_CLOCK_Subscribe(&s_clock_subscribers[0], clock_notify, (void *)0);
+    (void)R_CLOCK_Subscribe(&s_clock_subscribers[1], clock_notify, (void *)1);
+    check_clock_switches();
+    check_clock_refusals();
+
+    SYSTEM.HOCOCR.BYTE = 0x00U;
+    SYSTEM.MOSCCR.BYTE = 0x00U;
+    SYSTEM.LOCOCR.BYTE = 0x00U;
+    SYSTEM.PLLCR.WORD = pllcr;
+    SYSTEM.PLLCR2.BYTE = 0x00U;
+    SYSTEM.OPCCR.BYTE = opccr;
+    SYSTEM.SOPCCR.BYTE = sopccr;
+    SYSTEM.MEMWAIT.BYTE = memwait;
+    clock_setting_of(sckcr, sckcr3, &setting);
+    if ((CLOCK_SUCCESS != R_CLOCK_Switch(&setting)) || (sckcr != SYSTEM.SCKCR.LONG))
+    {
+        s_clock_errors++;
+    }
+    SYSTEM.HOCOCR.BYTE = hococr;
+    SYSTEM.MOSCCR.BYTE = mosccr;
+    SYSTEM.SOSCCR.BYTE = sosccr;
+    SYSTEM.LOCOCR.BYTE = lococr;
+    SYSTEM.PLLCR2.BYTE = pllcr2;
+}
+
+/* Loop count of R_BSP_SoftwareDelay() before the delay rates, for any ICLK: the 32- and 64-bit paths come to the
+   same, (ICLK * delay / units - overhead) / cycles per loop, here without the 32-bit limit. 0 below one loop. */
+static uint64_t delay_reference_loops(uint32_t iclk_hz, uint32_t delay, uint32_t units)
+{
+    uint64_t cycles = ((uint64_t)iclk_hz * delay) / units;
+
+    return (cycles > BSP_DELAY_OVERHEAD_CYCLES) ? ((cycles - BSP_DELAY_OVERHEAD_CYCLES) / BSP_DELAY_LOOP_CYCLES) : 0U;
+}
+
+/* One delay against the reference: the same loops and result, or one loop short of it. */
+static void check_delay_one(uint32_t iclk_hz, uint32_t delay, bsp_delay_units_t units)
+{
+    uint64_t expected = delay_reference_loops(iclk_hz, delay, (uint32_t)units);
+    bool     expected_done = (0U != expected) && (expected <= 0xFFFFFFFFULL);
+    uint64_t cycles;
+    uint64_t loops;
+    bool     done;
+
+    (void)rx_host_delay_cycles();
+    done = R_BSP_SoftwareDelay(delay, units);
+    cycles = rx_host_delay_cycles();
+    loops = cycles / BSP_DELAY_LOOP_CYCLES;
+
+    if ((0U == (cycles % BSP_DELAY_LOOP_CYCLES)) && (done == (0U != loops)))
+    {
+        if ((done == expected_done) && ((false == done) || (loops == expected)))
+        {
+            s_delay_exact++;
+            return;
+        }
+        if ((loops + 1U) == expected)
+        {
+            s_delay_short++;
+            return;
+        }
+    }
+    if (s_delay_errors < 8U)
+    {
+        printf("delay           : %lu / %lu s at ICLK %lu Hz ran %llu loops (%s), expected %llu\n",
+               (unsigned long)delay, (unsigned long)units, (unsigned long)iclk_hz, (unsigned long long)loops,
+               (true == done) ? "true" : "false", (unsigned long long)expected);
+    }
+    s_delay_errors++;
+}
+
+/* Delays either side of a loop count, as far as they fit 32 bits. */
+static void check_delay_edge(uint32_t iclk_hz, bsp_delay_units_t units, uint64_t loops)
+{
+    uint64_t cycles = (loops * BSP_DELAY_LOOP_CYCLES) + BSP_DELAY_OVERHEAD_CYCLES;
+    uint64_t delay = ((cycles * (uint32_t)units) + iclk_hz - 1U) / iclk_hz;
+    uint64_t d;
+
+    for (d = (delay > HOST_DELAY_EDGE) ? (delay - HOST_DELAY_EDGE) : 0U;
+         (d <= (delay + HOST_DELAY_EDGE)) && (d <= 0xFFFFFFFFULL); d++)
+    {
+        check_delay_one(iclk_hz, (uint32_t)d, units);
+    }
+}
+
+/* Every unit at the clock in the registers: the edges, the longest delay and random delays of every magnitude. */
+static void check_delay_clock(void)
+{
+    static const bsp_delay_units_t s_units[] = { BSP_DELAY_MICROSECS, BSP_DELAY_MILLISECS, BSP_DELAY_SECS };
+    uint32_t      iclk_hz;
+    uint32_t      u;
+    uint32_t      r;
+    unsigned long n;
+
+    R_CLOCK_Refresh();
+    iclk_hz = rx_host_clock_hz(RX_HOST_CLOCK_ICLK);
+    if (R_CLOCK_GetHz(CLOCK_ICLK) != iclk_hz)
+    {
+        s_delay_errors++;
+    }
+    for (u = 0; u < (sizeof(s_units) / sizeof(s_units[0])); u++)
+    {
+        check_delay_edge(iclk_hz, s_units[u], 0U);
+        check_delay_edge(iclk_hz, s_units[u], 1U);
+        check_delay_edge(iclk_hz, s_units[u], 0x100000000ULL);
+        check_delay_one(iclk_hz, 0xFFFFFFFFUL, s_units[u]);
+        for (n = 0; n < s_delay_trials; n++)
+        {
+            r = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+            check_delay_one(iclk_hz, r >> ((uint32_t)rand() % 32U), s_units[u]);
+        }
+    }
+}
+
+/* The compile-time path: a constant loop count at BSP_ICLK_HZ, R_BSP_SoftwareDelay() at any other ICLK. */
+static void check_delay_constant(void)
+{
+    /* Static initializers, so the counts must be worked out by the compiler. */
+    static const uint32_t s_loops = BSP_DELAY_LOOPS(HOST_DELAY_CONST_US, BSP_DELAY_MICROSECS);
+    static const uint32_t s_loops_none = BSP_DELAY_LOOPS(0, BSP_DELAY_MICROSECS);
+    static const uint32_t s_loops_over = BSP_DELAY_LOOPS(0xFFFFFFFFUL, BSP_DELAY_SECS);
+    uint64_t runtime;
+    uint64_t cycles;
+
+    if ((s_loops != delay_reference_loops((uint32_t)BSP_ICLK_HZ, HOST_DELAY_CONST_US, BSP_DELAY_MICROSECS)) ||
+        (0U != s_loops_none) || (0U != s_loops_over))
+    {
+        s_delay_errors++;
+    }
+
+    R_CLOCK_Refresh();
+    if ((uint32_t)BSP_ICLK_HZ != R_CLOCK_GetHz(CLOCK_ICLK))
+    {
+        printf("delay constant  : ICLK is %lu Hz, not BSP_ICLK_HZ\n", (unsigned long)R_CLOCK_GetHz(CLOCK_ICLK));
+        s_delay_errors++;
+    }
+    (void)rx_host_delay_cycles();
+    if ((true != R_BSP_SOFTWARE_DELAY(HOST_DELAY_CONST_US, BSP_DELAY_MICROSECS)) ||
+        (((uint64_t)s_loops * BSP_DELAY_LOOP_CYCLES) != rx_host_delay_cycles()))
+    {
+        s_delay_errors++;
+    }
+
+    /* ICLK at half of BSP_ICLK_HZ. */
+    SYSTEM.SCKCR.LONG += 1UL << 24;
+    R_CLOCK_Refresh();
+    (void)R_BSP_SoftwareDelay(HOST_DELAY_CONST_US, BSP_DELAY_MICROSECS);
+    runtime = rx_host_delay_cycles();
+    (void)R_BSP_SOFTWARE_DELAY(HOST_DELAY_CONST_US, BSP_DELAY_MICROSECS);
+    cycles = rx_host_delay_cycles();
+    if ((runtime != cycles) || (cycles >= ((uint64_t)s_loops * BSP_DELAY_LOOP_CYCLES)))
+    {
+        s_delay_errors++;
+    }
+    SYSTEM.SCKCR.LONG -= 1UL << 24;
+    R_CLOCK_Refresh();
+}
+
+/* Firmware side of the -D check: every source setting with every ICLK divider, counted with the delays skipped. */
+static void check_delay(void)
+{
+    uint32_t sckcr = SYSTEM.SCKCR.LONG;
+    uint16_t sckcr3 = SYSTEM.SCKCR3.WORD;
+    uint8_t  hococr2 = SYSTEM.HOCOCR2.BYTE;
+    uint16_t pllcr = SYSTEM.PLLCR.WORD;
+    unsigned long clocks = 0;
+    uint32_t stc;
+    uint32_t src;
+    uint32_t ick;
+
+    check_delay_constant();
+
+    srand(1);
+    rx_host_delay_skip(true);
+    for (src = 0; src < (sizeof(s_clock_sources) / sizeof(s_clock_sources[0])); src++)
+    {
+        for (stc = HOST_CLOCK_STC_MIN; stc <= HOST_CLOCK_STC_MAX; stc++)
+        {
+            SYSTEM.SCKCR3.WORD = (uint16_t)(s_clock_sources[src][0] << 8);
+            SYSTEM.HOCOCR2.BIT.HCFRQ = s_clock_sources[src][1];
+            SYSTEM.PLLCR.BIT.PLIDIV = s_clock_sources[src][2];
+            SYSTEM.PLLCR.BIT.STC = stc;
+            for (ick = 0; ick < HOST_CLOCK_DIVS; ick++)
+            {
+                SYSTEM.SCKCR.LONG = (sckcr & ~(0x0FUL << 24)) | (ick << 24);
+                check_delay_clock();
+                clocks++;
+            }
+
+            /* Only the PLL depends on STC. */
+            if (4U != s_clock_sources[src][0])
+            {
+                break;
+            }
+        }
+    }
+    rx_host_delay_skip(false);
+    printf("delay loops     : %lu ICLK settings, %lu delays as before, %lu one loop short\n", clocks, s_delay_exact,
+           s_delay_short);
+
+    SYSTEM.SCKCR.LONG = sckcr;
+    SYSTEM.SCKCR3.WORD = sckcr3;
+    SYSTEM.HOCOCR2.BYTE = hococr2;
+    SYSTEM.PLLCR.WORD = pllcr;
+    R_CLOCK_Refresh();
+}
+
+static void deadline_arm(uint32_t n, uint32_t us);
+
+static uint32_t deadline_clock(void)
+{
+    return s_deadline_now;
+}
+
+/* Counts a deadline of us microseconds must take at least: rounded up, plus the count under way. 0 for none. */
+static uint64_t deadline_counts(uint32_t hz, uint32_t us)
+{
+    return (0U == us) ? 0U : (((((uint64_t)us * hz) + 999999U) / 1000000U) + 1U);
+}
+
+/* A random delay of any magnitude. */
+static uint32_t deadline_random_us(void)
+{
+    uint32_t r = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+
+    return r >> ((uint32_t)rand() % 32U);
+}
+
+/* A random clock reading, half of them just short of the wrap-around. */
+static uint32_t deadline_random_start(void)
+{
+    return (0 != (rand() & 1)) ? (((uint32_t)rand() << 16) ^ (uint32_t)rand()) : (0U - ((uint32_t)rand() % 4096U));
+}
+
+/* Deadlines on a simulated clock across the wrap-around: never early, at most one count late, and expired from then on
+   whether or not they were polled. */
+static void check_deadline_wrap(unsigned long *p_exact, unsigned long *p_late)
+{
+    deadline_t     deadline;
+    deadline_t     unpolled;
+    deadline_err_t err;
+    uint64_t       expected;
+    uint32_t       start;
+    uint32_t       us;
+    unsigned long  n;
+
+    R_DEADLINE_Open(deadline_clock, s_deadline_hz, DEADLINE_FIXED_RATE);
+    for (n = 0; n < s_deadline_trials; n++)
+    {
+        us = deadline_random_us();
+        start = deadline_random_start();
+        expected = deadline_counts(s_deadline_hz, us);
+        s_deadline_now = start;
+        err = R_DEADLINE_Set(&deadline, us);
+        (void)R_DEADLINE_Set(&unpolled, us);
+        if (expected >= DEADLINE_MAX_COUNTS)
+        {
+            /* At the limit, the rounding of the rate may take it either way. */
+            if ((DEADLINE_ERR_INVALID_ARG != err) && (expected > DEADLINE_MAX_COUNTS))
+            {
+                s_deadline_errors++;
+            }
+            continue;
+        }
+        if (DEADLINE_SUCCESS != err)
+        {
+            s_deadline_errors++;
+            continue;
+        }
+        if (0U == expected)
+        {
+            if (true != R_DEADLINE_Expired(&deadline))
+            {
+                s_deadline_errors++;
+            }
+            continue;
+        }
+
+        s_deadline_now = start + (uint32_t)expected - 1U;
+        if (true == R_DEADLINE_Expired(&deadline))
+        {
+            printf("deadline        : %lu us at %lu Hz expired after %lu counts\n", (unsigned long)us,
+                   (unsigned long)s_deadline_hz, (unsigned long)(expected - 1U));
+            s_deadline_errors++;
+            continue;
+        }
+        s_deadline_now++;
+        if (true == R_DEADLINE_Expired(&deadline))
+        {
+            (*p_exact)++;
+        }
+        else
+        {
+            s_deadline_now++;
+            if (true == R_DEADLINE_Expired(&deadline))
+            {
+                (*p_late)++;
+            }
+            else
+            {
+                s_deadline_errors++;
+            }
+        }
+
+        /* Seen to expire, it stays expired; not seen, it stays expired for half a turn and to the end of the turn. */
+        s_deadline_now = start + (uint32_t)expected + 0x80000000UL + ((uint32_t)rand() % 0x10000U);
+        if (true != R_DEADLINE_Expired(&deadline))
+        {
+            s_deadline_errors++;
+        }
+        s_deadline_now = start + (uint32_t)expected + 0x7FFFFFFFUL;
+        if (true != R_DEADLINE_Expired(&unpolled))
+        {
+            s_deadline_errors++;
+        }
+        s_deadline_now = start;
+        (void)R_DEADLINE_Set(&unpolled, us);
+        s_deadline_now = start + 0xFFFFFFFFUL;
+        if (true != R_DEADLINE_Expired(&unpolled))
+        {
+            s_deadline_errors++;
+        }
+    }
+}
+
+/* Runs in R_DEADLINE_Poll(): no earlier than the deadline, and not left over by a poll one count after it, if that
+   poll came after the delay started. A quarter of the delays start again from here, as long as the budget lasts. */
+static void deadline_ran(void *p_context)
+{
+    uint32_t n = (uint32_t)(uintptr_t)p_context;
+    uint32_t us;
+
+    s_deadline_ran[n]++;
+    s_deadline_pending--;
+    if (((s_deadline_now - s_deadline_start[n]) < s_deadline_expected[n]) ||
+        (((s_deadline_now - s_deadline_poll) < (s_deadline_now - s_deadline_start[n])) &&
+         ((s_deadline_poll - s_deadline_start[n]) > s_deadline_expected[n])))
+    {
+        s_deadline_errors++;
+    }
+
+    if ((0U != s_deadline_rearms) && (0U == (n % 4U)))
+    {
+        s_deadline_rearms--;
+        us = deadline_random_us() >> 8;
+        deadline_arm(n, us);
+    }
+}
+
+/* Starts delay n and records when it must run. */
+static void deadline_arm(uint32_t n, uint32_t us)
+{
+    s_deadline_start[n] = s_deadline_now;
+    s_deadline_expected[n] = (uint32_t)deadline_counts(s_deadline_hz, us);
+    if (DEADLINE_SUCCESS != R_DEADLINE_DelayAsync(&s_deadline_delays[n], us, deadline_ran, (void *)(uintptr_t)n))
+    {
+        s_deadline_errors++;
+        return;
+    }
+    s_deadline_armed[n]++;
+    s_deadline_pending++;
+}
+
+/* Delays started together and from their callbacks, some cancelled, polled at random intervals across the
+   wrap-around: each runs once per start, on time, and a cancelled one never. */
+static void check_deadline_async(void)
+{
+    uint64_t      us;
+    uint32_t      r;
+    uint32_t      n;
+    unsigned long polls = 0;
+
+    R_DEADLINE_Open(deadline_clock, s_deadline_hz, DEADLINE_FIXED_RATE);
+    s_deadline_now = deadline_random_start();
+    s_deadline_poll = s_deadline_now;
+    s_deadline_rearms = HOST_DEADLINE_DELAYS;
+    s_deadline_pending = 0U;
+    for (n = 0; n < HOST_DEADLINE_DELAYS; n++)
+    {
+        /* Up to a quarter turn, so that a poll a quarter turn late still runs them in time. */
+        r = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+        us = ((uint64_t)(r >> (2U + ((uint32_t)rand() % 30U))) * 1000000U) / s_deadline_hz;
+        s_deadline_ran[n] = 0U;
+        s_deadline_armed[n] = 0U;
+        deadline_arm(n, (us > 0xFFFFFFFFULL) ? 0xFFFFFFFFUL : (uint32_t)us);
+    }
+    for (n = 0; n < HOST_DEADLINE_DELAYS; n += 1U + ((uint32_t)rand() % 8U))
+    {
+        if (DEADLINE_SUCCESS != R_DEADLINE_Cancel(&s_deadline_delays[n]))
+        {
+            s_deadline_errors++;
+        }
+        s_deadline_armed[n]--;
+        s_deadline_pending--;
+    }
+
+    /* Polls at random intervals, most of them short and a few up to a quarter turn apart. */
+    while ((0U != s_deadline_pending) && (polls < HOST_DEADLINE_POLLS))
+    {
+        s_deadline_poll = s_deadline_now;
+        r = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+        s_deadline_now += 1U + (r >> (2U + ((uint32_t)rand() % 30U)));
+        (void)R_DEADLINE_Poll();
+        polls++;
+    }
+    for (n = 0; n < HOST_DEADLINE_DELAYS; n++)
+    {
+        if (s_deadline_ran[n] != s_deadline_armed[n])
+        {
+            s_deadline_errors++;
+        }
+    }
+    if (0U != s_deadline_pending)
+    {
+        s_deadline_errors++;
+    }
+}
+
+/* Moves the simulated clock on, reading it through r_deadline at least once per quarter turn. */
+static void deadline_advance(uint64_t counts)
+{
+    deadline_t reader;
+
+    while (counts > HOST_DEADLINE_STEP)
+    {
+        s_deadline_now += HOST_DEADLINE_STEP;
+        (void)R_DEADLINE_Set(&reader, 1U);
+        counts -= HOST_DEADLINE_STEP;
+    }
+    s_deadline_now += (uint32_t)counts;
+}
+
+/* Checks a deadline at the last count before the given one and at a few counts after it: not expired, then expired. */
+static void deadline_check_at(deadline_t *p_deadline, uint64_t first, uint64_t late, uint32_t us, uint32_t hz0,
+                              uint32_t hz1)
+{
+    if (first > 0U)
+    {
+        deadline_advance(first - 1U);
+        if (true == R_DEADLINE_Expired(p_deadline))
+        {
+            printf("deadline rate   : %lu us from %lu to %lu Hz expired early\n", (unsigned long)us,
+                   (unsigned long)hz0, (unsigned long)hz1);
+            s_deadline_errors++;
+        }
+        first = 1U;
+    }
+    deadline_advance(first + late);
+    if (false == R_DEADLINE_Expired(p_deadline))
+    {
+        printf("deadline rate   : %lu us from %lu to %lu Hz not expired %lu counts late\n", (unsigned long)us,
+               (unsigned long)hz0, (unsigned long)hz1, (unsigned long)late);
+        s_deadline_errors++;
+    }
+}
+
+/* Deadlines on a simulated clock whose rate changes from hz0 to hz1 with R_DEADLINE_SetRate(): one set before the
+   change and one set after up to two turns at the new rate, each never early and late by at most four counts of the
+   first rate (the rounding of the deadline, of the time and of the scale). */
+static void check_deadline_rate(uint32_t hz0, uint32_t hz1, unsigned long *p_checked)
+{
+    deadline_t        before;
+    deadline_t        after;
+    unsigned __int128 need;
+    unsigned __int128 done;
+    uint64_t          late = (((4ULL * hz1) + hz0 - 1U) / hz0) + 1U;
+    uint64_t          changed;
+    uint64_t          first;
+    uint32_t          us;
+    unsigned long     n;
+
+    for (n = 0; n < s_deadline_trials; n++)
+    {
+        R_DEADLINE_Open(deadline_clock, hz0, DEADLINE_FIXED_RATE);
+        s_deadline_now = deadline_random_start();
+        us = deadline_random_us();
+        if ((0U == us) || (DEADLINE_SUCCESS != R_DEADLINE_Set(&before, us)))
+        {
+            continue;
+        }
+
+        /* The rest of the us after the counts at hz0, at hz1. */
+        changed = (uint64_t)((((uint32_t)rand() << 16) ^ (uint32_t)rand()) % deadline_counts(hz0, us));
+        deadline_advance(changed);
+        if (DEADLINE_SUCCESS != R_DEADLINE_SetRate(hz1))
+        {
+            s_deadline_errors++;
+        }
+        need = (unsigned __int128)us * hz0;
+        done = (unsigned __int128)changed * 1000000U;
+        first = (done >= need) ? 0U :
+                (uint64_t)((((need - done) * hz1) + ((uint64_t)hz0 * 1000000U) - 1U) / ((uint64_t)hz0 * 1000000U));
+        deadline_check_at(&before, first, late, us, hz0, hz1);
+
+        deadline_advance((uint64_t)((uint32_t)rand() % 9U) * HOST_DEADLINE_STEP);
+        (void)R_DEADLINE_Set(&after, us);
+        deadline_check_at(&after, (((uint64_t)us * hz1) + 999999U) / 1000000U, late, us, hz0, hz1);
+        (*p_checked)++;
+    }
+}
+
+/* The argument checks and the pending-delay errors. */
+static void check_deadline_refusals(void)
+{
+    deadline_delay_t delay;
+    deadline_t       deadline;
+
+    R_DEADLINE_Open(NULL, 0U, DEADLINE_FIXED_RATE);
+    if ((DEADLINE_ERR_NO_CLOCK != R_DEADLINE_Set(&deadline, 1U)) ||
+        (DEADLINE_ERR_NO_CLOCK != R_DEADLINE_SetRate(1000000U)))
+    {
+        s_deadline_errors++;
+    }
+
+    /* At 1 MHz, 2^31 - 1 us is 2^31 counts with the one under way. */
+    R_DEADLINE_Open(deadline_clock, 1000000U, DEADLINE_FIXED_RATE);
+    if ((DEADLINE_ERR_NULL_PTR != R_DEADLINE_Set(NULL, 1U)) ||
+        (DEADLINE_SUCCESS != R_DEADLINE_Set(&deadline, 0x7FFFFFFFUL)) ||
+        (DEADLINE_ERR_INVALID_ARG != R_DEADLINE_Set(&deadline, 0x80000000UL)) ||
+        (DEADLINE_ERR_INVALID_ARG != R_DEADLINE_Set(&deadline, 0xFFFFFFFFUL)) ||
+        (DEADLINE_ERR_NULL_PTR != R_DEADLINE_DelayAsync(NULL, 1U, deadline_ran, NULL)) ||
+        (DEADLINE_ERR_NULL_PTR != R_DEADLINE_DelayAsync(&delay, 1U, NULL, NULL)) ||
+        (DEADLINE_ERR_INVALID_ARG != R_DEADLINE_DelayAsync(&delay, 0x80000000UL, deadline_ran, NULL)) ||
+        (DEADLINE_SUCCESS != R_DEADLINE_DelayAsync(&delay, 10U, deadline_ran, NULL)) ||
+        (DEADLINE_ERR_IN_USE != R_DEADLINE_DelayAsync(&delay, 10U, deadline_ran, NULL)) ||
+        (DEADLINE_SUCCESS != R_DEADLINE_Cancel(&delay)) ||
+        (DEADLINE_ERR_NOT_ACTIVE != R_DEADLINE_Cancel(&delay)) ||
+        (DEADLINE_ERR_NULL_PTR != R_DEADLINE_Cancel(NULL)) ||
+        (DEADLINE_ERR_INVALID_ARG != R_DEADLINE_SetRate(0U)) ||
+        (0U != R_DEADLINE_Poll()))
+    {
+        s_deadline_errors++;
+    }
+}
+
+/* Host time of a poll with one delay pending and with many, none of them due, of R_DEADLINE_Expired() and of a read
+   of the clock, on the CMT1 count the firmware uses. */
+static void bench_deadline(uint32_t hz)
+{
+    volatile uint32_t sink = 0;
+    deadline_t        deadline;
+    unsigned long     i;
+    uint64_t          t[5];
+    uint64_t          far;
+
+    /* A quarter turn away, so that none is due even with slow simulated memory. */
+    far = ((uint64_t)(DEADLINE_MAX_COUNTS / 2U) * 1000000U) / hz;
+    far = (far > 0xFFFF0000ULL) ? 0xFFFF0000ULL : far;
+    R_DEADLINE_Open(R_Config_CMT1_GetCount32, hz, CLOCK_PCLKB);
+    (void)R_DEADLINE_DelayAsync(&s_deadline_delays[0], (uint32_t)far, deadline_ran, NULL);
+    t[0] = host_ns();
+    for (i = 0; i < HOST_DEADLINE_POLLS; i++)
+    {
+        sink += R_DEADLINE_Poll();
+    }
+    t[1] = host_ns();
+    for (i = 1; i < HOST_DEADLINE_PENDING; i++)
+    {
+        (void)R_DEADLINE_DelayAsync(&s_deadline_delays[i], (uint32_t)far + (uint32_t)i, deadline_ran, NULL);
+    }
+    t[2] = host_ns();
+    for (i = 0; i < HOST_DEADLINE_POLLS; i++)
+    {
+        sink += R_DEADLINE_Poll();
+    }
+    t[3] = host_ns();
+    (void)R_DEADLINE_Set(&deadline, (uint32_t)far);
+    for (i = 0; i < HOST_DEADLINE_POLLS; i++)
+    {
+        sink += (true == R_DEADLINE_Expired(&deadline)) ? 1U : 0U;
+    }
+    t[4] = host_ns();
+    for (i = 0; i < HOST_DEADLINE_POLLS; i++)
+    {
+        sink += R_Config_CMT1_GetCount32();
+    }
+    printf("deadline poll   : %.1f ns with 1 delay pending, %.1f ns with %u, %.1f ns per check of a deadline, "
+           "%.1f ns per clock read\n", (double)(t[1] - t[0]) / HOST_DEADLINE_POLLS,
+           (double)(t[3] - t[2]) / HOST_DEADLINE_POLLS, HOST_DEADLINE_PENDING,
+           (double)(t[4] - t[3]) / HOST_DEADLINE_POLLS, (double)(host_ns() - t[4]) / HOST_DEADLINE_POLLS);
+
+    /* Nothing was due, and nothing ran. */
+    for (i = 0; i < HOST_DEADLINE_PENDING; i++)
+    {
+        if (DEADLINE_SUCCESS != R_DEADLINE_Cancel(&s_deadline_delays[i]))
+        {
+            s_deadline_errors++;
+        }
+    }
+    (void)sink;
+}
+
+static void deadline_flag(void *p_context)
+{
+    *(volatile bool *)p_context = true;
+}
+
+/* Deadlines and delays on CMT1, some across its 16-bit wraps, timed by the model: no earlier than asked, and late by
+   no more than two counts and a turn of the polling loop. */
+static void check_deadline_cmt1(uint32_t hz)
+{
+    uint32_t          saved = g_rx_host_nop_cycles;
+    uint32_t          wraps = rx_host_vector_accepted(VECT_CMT1_CMI1);
+    uint64_t          slack;
+    uint64_t          t0;
+    uint64_t          elapsed;
+    uint32_t          us;
+    uint32_t          run;
+    deadline_t        deadline;
+    deadline_delay_t  delay;
+    volatile bool     done;
+    unsigned long     mismatches = 0;
+
+    if (1 != CMT.CMSTR0.BIT.STR1)
+    {
+        R_Config_CMT1_Start();
+    }
+    g_rx_host_nop_cycles = 100U;
+    slack = ((2ULL * 1000000000ULL) / hz) +
+            ((2ULL * (g_rx_host_nop_cycles + (64U * g_rx_host_access_cycles)) * 1000000000ULL) /
+             rx_host_clock_hz(RX_HOST_CLOCK_ICLK));
+    R_DEADLINE_Open(R_Config_CMT1_GetCount32, hz, CLOCK_PCLKB);
+    for (run = 0; run < HOST_DEADLINE_CMT1_RUNS; run++)
+    {
+        us = 1U + ((uint32_t)rand() % HOST_DEADLINE_CMT1_US);
+        t0 = rx_host_time_ns();
+        if (0U == (run & 1U))
+        {
+            (void)R_DEADLINE_Set(&deadline, us);
+            while (false == R_DEADLINE_Expired(&deadline))
+            {
+                nop();
+            }
+        }
+        else
+        {
+            done = false;
+            (void)R_DEADLINE_DelayAsync(&delay, us, deadline_flag, (void *)&done);
+            while (false == done)
+            {
+                (void)R_DEADLINE_Poll();
+                nop();
+            }
+        }
+        elapsed = rx_host_time_ns() - t0;
+        if ((elapsed < (us * 1000ULL)) || (elapsed > ((us * 1000ULL) + slack)))
+        {
+            printf("deadline CMT1   : %lu us took %llu ns\n", (unsigned long)us, (unsigned long long)elapsed);
+            mismatches++;
+        }
+    }
+    g_rx_host_nop_cycles = saved;
+    s_deadline_errors += mismatches;
+
+    printf("deadline CMT1   : %u deadlines and delays over %lu wraps, %lu mismatches\n", HOST_DEADLINE_CMT1_RUNS,
+           (unsigned long)(rx_host_vector_accepted(VECT_CMT1_CMI1) - wraps), mismatches);
+}
+
+/* Firmware side of the -u check; r_deadline is left on CMT1 as UserInit() opens it. */
+static void check_deadline(void)
+{
+    /* A sub-clock count, PCLKB/8 at the LOCO, 27, 32 and 54 MHz, and rates that are not whole counts per us. */
+    static const uint32_t s_hz[] = { 32768U, 500000U, 1000000U, 2999999U, 3375000U, 4000000U, 6750000U };
+    uint32_t      hz = rx_host_clock_hz(RX_HOST_CLOCK_PCLKB) / CMT1_COUNT_CLOCK_DIVISOR;
+    unsigned long exact = 0;
+    unsigned long late = 0;
+    unsigned long rated = 0;
+    uint32_t      count = (uint32_t)(sizeof(s_hz) / sizeof(s_hz[0]));
+    uint32_t      i;
+
+    check_deadline_refusals();
+    srand(1);
+    for (i = 0; i < (sizeof(s_hz) / sizeof(s_hz[0])); i++)
+    {
+        s_deadline_hz = s_hz[i];
+        check_deadline_wrap(&exact, &late);
+        check_deadline_async();
+        check_deadline_rate(s_hz[i], s_hz[(i + 1U + ((uint32_t)rand() % (count - 1U))) % count], &rated);
+    }
+    printf("deadline wrap   : %u clock rates, %lu deadlines on the count, %lu one count late\n", (unsigned)count,
+           exact, late);
+    printf("deadline rate   : %lu deadlines across a change of rate\n", rated);
+
+    /* CMT1 counts its wraps in CMI1, which earlier checks may have left masked. */
+    setpsw_i();
+    bench_deadline(hz);
+    check_deadline_cmt1(hz);
+    R_DEADLINE_Open(R_Config_CMT1_GetCount32, hz, CLOCK_PCLKB);
+}
+
+/* Time one CMT0 restart may gain or lose: a count clock at the CKS the tick is solved at. */
+static uint64_t perf_count_ns(uint32_t pclkb_hz)
+{
+    return ((uint64_t)CMT_PERIOD_DIVISOR(CMT_PERIOD_CKS(CMT0_PERIOD_US, pclkb_hz)) * 1000000000ULL) / pclkb_hz;
+}
+
+/* Time of a CMT1 count, the clock of r_deadline. */
+static uint64_t perf_cmt1_count_ns(uint32_t pclkb_hz)
+{
+    return ((uint64_t)CMT1_COUNT_CLOCK_DIVISOR * 1000000000ULL) / pclkb_hz;
+}
+
+/* One call: a refusal leaves every register alone, a switch lands in the slowest operating mode and the fewest
+   wait states the clock allows with the PLL stopped unless it is the source. */
+static void check_perf_one(const clock_setting_t *p_setting, clock_err_t expected)
+{
+    uint32_t    sckcr = SYSTEM.SCKCR.LONG;
+    uint16_t    sckcr3 = SYSTEM.SCKCR3.WORD;
+    uint8_t     opccr = SYSTEM.OPCCR.BYTE;
+    uint8_t     sopccr = SYSTEM.SOPCCR.BYTE;
+    uint8_t     memwait = SYSTEM.MEMWAIT.BYTE;
+    uint8_t     pllcr2 = SYSTEM.PLLCR2.BYTE;
+    uint16_t    prcr = SYSTEM.PRCR.WORD;
+    uint32_t    fastest = 0U;
+    uint32_t    i;
+    clock_err_t err;
+
+    err = R_CLOCK_SetPerformance(p_setting);
+    if ((err != expected) || (prcr != SYSTEM.PRCR.WORD))
+    {
+        printf("perf            : source %u gave %d, expected %d\n",
+               (NULL != p_setting) ? (unsigned)p_setting->source : 0U, (int)err, (int)expected);
+        s_perf_errors++;
+        return;
+    }
+    if (CLOCK_SUCCESS != err)
+    {
+        if ((sckcr != SYSTEM.SCKCR.LONG) || (sckcr3 != SYSTEM.SCKCR3.WORD) || (opccr != SYSTEM.OPCCR.BYTE) ||
+            (sopccr != SYSTEM.SOPCCR.BYTE) || (memwait != SYSTEM.MEMWAIT.BYTE) || (pllcr2 != SYSTEM.PLLCR2.BYTE))
+        {
+            s_perf_errors++;
+        }
+        return;
+    }
+
+    for (i = 0; i < CLOCKS; i++)
+    {
+        if (R_CLOCK_GetHz((clock_id_t)i) != rx_host_clock_hz((rx_host_clock_t)i))
+        {
+            s_perf_errors++;
+        }
+        fastest = (rx_host_clock_hz((rx_host_clock_t)i) > fastest) ? rx_host_clock_hz((rx_host_clock_t)i) : fastest;
+    }
+    opccr = (fastest > BSP_MIDDLE_SPEED_MAX_FREQUENCY) ? 0U : 2U;
+    sopccr = ((0U != opccr) && (CLOCK_SOURCE_SUB == p_setting->source)) ? 1U : 0U;
+    memwait = (rx_host_clock_hz(RX_HOST_CLOCK_ICLK) > BSP_MEMORY_NO_WAIT_MAX_FREQUENCY) ? 1U : 0U;
+    if (((uint32_t)p_setting->source != SYSTEM.SCKCR3.BIT.CKSEL) || (opccr != SYSTEM.OPCCR.BIT.OPCM) ||
+        (sopccr != SYSTEM.SOPCCR.BIT.SOPCM) || (memwait != SYSTEM.MEMWAIT.BYTE) ||
+        ((CLOCK_SOURCE_PLL == p_setting->source) == (1U == SYSTEM.PLLCR2.BIT.PLLEN)))
+    {
+        printf("perf            : source %u at %lu Hz left OPCM %u SOPCM %u MEMWAIT %u PLLEN %u\n",
+               (unsigned)p_setting->source, (unsigned long)fastest, (unsigned)SYSTEM.OPCCR.BIT.OPCM,
+               (unsigned)SYSTEM.SOPCCR.BIT.SOPCM, (unsigned)SYSTEM.MEMWAIT.BYTE, (unsigned)SYSTEM.PLLCR2.BIT.PLLEN);
+        s_perf_errors++;
+    }
+}
+
+/* After two compare matches at a PCLKB, CMT0 runs the tick the solver gives for it. */
+static void check_perf_cmt0(uint32_t pclkb_hz)
+{
+    uint32_t cks = (uint32_t)CMT_PERIOD_CKS(CMT0_PERIOD_US, pclkb_hz);
+    uint32_t cmcor = (uint32_t)CMT_PERIOD_CMCOR(CMT0_PERIOD_US, pclkb_hz);
+
+    if ((cks != CMT0.CMCR.BIT.CKS) || ((CMT0.CMCOR + 1U) < cmcor) || (CMT0.CMCOR > (cmcor + 1U)))
+    {
+        printf("perf CMT0       : PCLKB %lu Hz runs CKS %u CMCOR %u, expected CKS %lu CMCOR %lu\n",
+               (unsigned long)pclkb_hz, (unsigned)CMT0.CMCR.BIT.CKS, (unsigned)CMT0.CMCOR, (unsigned long)cks,
+               (unsigned long)cmcor);
+        s_perf_errors++;
+    }
+}
+
+/* Firmware side of the -m check; the boot clock is put back at the end by R_CLOCK_SetPerformance(). */
+static void check_perf(void)
+{
+    uint32_t        sckcr = SYSTEM.SCKCR.LONG;
+    uint16_t        sckcr3 = SYSTEM.SCKCR3.WORD;
+    uint8_t         opccr = SYSTEM.OPCCR.BYTE;
+    uint8_t         memwait = SYSTEM.MEMWAIT.BYTE;
+    uint16_t        pllcr = SYSTEM.PLLCR.WORD;
+    uint32_t        nop_cycles = g_rx_host_nop_cycles;
+    uint32_t        clock_violations = rx_host_clock_violations();
+    uint32_t        mode_violations = rx_host_mode_violations();
+    uint32_t        transitions = rx_host_mode_transitions();
+    uint32_t        pclkb_hz = rx_host_clock_hz(RX_HOST_CLOCK_PCLKB);
+    uint64_t        bound_ns = HOST_PERF_SLACK_NS;
+    uint64_t        t0;
+    uint64_t        ns0;
+    uint64_t        elapsed;
+    uint64_t        measured;
+    uint64_t        end;
+    uint32_t        ticks0;
+    uint32_t        ticks;
+    uint32_t        matches;
+    uint32_t        shift[CLOCKS];
+    unsigned long   results[CLOCK_ERR_MODE + 1] = { 0 };
+    unsigned long   n;
+    uint32_t        i;
+    clock_setting_t setting;
+    clock_err_t     expected;
+    uint8_t         current;
+    bool            stop;
+    deadline_t      deadline;
+    uint64_t        set_ns;
+    uint64_t        switched_ns;
+    uint64_t        expired_ns;
+    uint64_t        count_ns;
+    uint64_t        due_ns;
+    uint32_t        us;
+    unsigned long   deadlines = 0;
+
+    /* A tick per compare match, the sub-clock running and the PLL at 54 MHz, stopped. */
+    R_Config_CMT0_SetTickless(false);
+    setpsw_i();
+    SYSTEM.SOSCCR.BYTE = 0x00U;
+    SYSTEM.PLLCR2.BYTE = 0x01U;
+    SYSTEM.PLLCR.BIT.PLIDIV = 1U;
+    SYSTEM.PLLCR.BIT.STC = 31U;
+
+    /* 64 MHz from the PLL is beyond high-speed operation. */
+    setting.source = CLOCK_SOURCE_PLL;
+    for (i = 0; i < CLOCKS; i++)
+    {
+        setting.div[i] = 1U;
+    }
+    check_perf_one(&setting, CLOCK_ERR_MODE);
+    check_perf_one(NULL, CLOCK_ERR_NULL_PTR);
+    SYSTEM.PLLCR.BIT.STC = 26U;
+
+    /* r_deadline on CMT1 as UserInit() opens it, a deadline set before each call. */
+    if (1 != CMT.CMSTR0.BIT.STR1)
+    {
+        R_Config_CMT1_Start();
+    }
+    R_DEADLINE_Open(R_Config_CMT1_GetCount32, pclkb_hz / CMT1_COUNT_CLOCK_DIVISOR, CLOCK_PCLKB);
+
+    srand(1);
+    t0 = rx_host_time_ns();
+    ns0 = R_Config_CMT0_GetTimeNs();
+    ticks0 = R_TIMER_GetTicks();
+    for (n = 0; n < s_perf_trials; n++)
+    {
+        setting.source = (clock_source_t)((uint32_t)rand() % (CLOCK_SOURCE_PLL + 1U));
+        shift[CLOCK_ICLK] = (uint32_t)rand() % HOST_CLOCK_DIVS;
+        for (i = 0; i < CLOCKS; i++)
+        {
+            /* Mostly no slower an ICLK than the others need, so that most calls switch. */
+            if (CLOCK_ICLK == i)
+            {
+                /* Drawn first. */
+            }
+            else if (0 != (rand() % 8))
+            {
+                shift[i] = shift[CLOCK_ICLK] + ((uint32_t)rand() % (HOST_CLOCK_DIVS - shift[CLOCK_ICLK]));
+            }
+            else
+            {
+                shift[i] = (uint32_t)rand() % HOST_CLOCK_DIVS;
+            }
+            setting.div[i] = (uint8_t)(1U << shift[i]);
+        }
+
+        /* Never the source in use, nor the main clock under the PLL in use. */
+        current = SYSTEM.SCKCR3.BIT.CKSEL;
+        stop = ((setting.source != (clock_source_t)current) &&
+                ((CLOCK_SOURCE_MAIN != setting.source) || (CLOCK_SOURCE_PLL != current)) && (0 == (rand() % 4)));
+
+        expected = CLOCK_SUCCESS;
+        if ((shift[CLOCK_ICLK] > shift[CLOCK_FCLK]) || (shift[CLOCK_ICLK] > shift[CLOCK_PCLKB]) ||
+            (shift[CLOCK_ICLK] > shift[CLOCK_BCLK]))
+        {
+            expected = CLOCK_ERR_INVALID_ARG;
+        }
+        else if ((true == stop) && (CLOCK_SOURCE_SUB == setting.source))
+        {
+            expected = CLOCK_ERR_NOT_STABLE;
+        }
+
+        /* A stopped oscillator takes its stabilization time to start again. */
+        if (true == stop)
+        {
+            switch (setting.source)
+            {
+                case CLOCK_SOURCE_HOCO:
+                    SYSTEM.HOCOCR.BYTE = 0x01U;
+                    rx_host_osc_delay(RX_HOST_OSC_HOCO, HOST_PERF_HOCO_US);
+                    break;
+                case CLOCK_SOURCE_MAIN:
+                    SYSTEM.PLLCR2.BYTE = 0x01U;
+                    SYSTEM.MOSCCR.BYTE = 0x01U;
+                    rx_host_osc_delay(RX_HOST_OSC_MAIN, HOST_PERF_MAIN_US);
+                    rx_host_osc_delay(RX_HOST_OSC_PLL, HOST_PERF_PLL_US);
+                    break;
+                case CLOCK_SOURCE_SUB:
+                    SYSTEM.SOSCCR.BYTE = 0x01U;
+                    break;
+                case CLOCK_SOURCE_PLL:
+                    SYSTEM.PLLCR2.BYTE = 0x01U;
+                    rx_host_osc_delay(RX_HOST_OSC_PLL, HOST_PERF_PLL_US);
+                    break;
+                default:
+                    SYSTEM.LOCOCR.BYTE = 0x01U;
+                    break;
+            }
+        }
+        us = 1U + ((uint32_t)rand() % HOST_PERF_DEADLINE_US);
+        count_ns = perf_cmt1_count_ns(rx_host_clock_hz(RX_HOST_CLOCK_PCLKB));
+        set_ns = rx_host_time_ns();
+        (void)R_DEADLINE_Set(&deadline, us);
+        check_perf_one(&setting, expected);
+        switched_ns = rx_host_time_ns();
+        results[expected]++;
+        SYSTEM.SOSCCR.BYTE = 0x00U;
+
+        count_ns += perf_cmt1_count_ns(rx_host_clock_hz(RX_HOST_CLOCK_PCLKB));
+        if (pclkb_hz != rx_host_clock_hz(RX_HOST_CLOCK_PCLKB))
+        {
+            bound_ns += (2U * perf_count_ns(pclkb_hz)) + (2U * perf_count_ns(rx_host_clock_hz(RX_HOST_CLOCK_PCLKB)));
+            pclkb_hz = rx_host_clock_hz(RX_HOST_CLOCK_PCLKB);
+        }
+
+        g_rx_host_nop_cycles = (rx_host_clock_hz(RX_HOST_CLOCK_ICLK) / HOST_PERF_NOPS_PER_S) + 1U;
+        matches = rx_host_vector_accepted(VECT_CMT0_CMI0);
+        end = rx_host_time_ns() + (((uint64_t)rand() % (HOST_PERF_DWELL_MS + 1U)) * 1000000ULL);
+        expired_ns = 0U;
+        while ((rx_host_time_ns() < end) || (0U == expired_ns))
+        {
+            if ((0U == expired_ns) && (true == R_DEADLINE_Expired(&deadline)))
+            {
+                expired_ns = rx_host_time_ns();
+            }
+            nop();
+        }
+
+        /* No earlier than asked but for a count at each rate, and late by no more than that, a nop and the call,
+           during which the switch counts at the slower rate. */
+        due_ns = set_ns + (us * 1000ULL);
+        if (((expired_ns + count_ns + HOST_PERF_SLACK_NS) < due_ns) ||
+            (expired_ns > (((due_ns > switched_ns) ? due_ns : switched_ns) + (switched_ns - set_ns) + count_ns +
+                           HOST_PERF_SLACK_NS +
+                           ((g_rx_host_nop_cycles * 1000000000ULL) / rx_host_clock_hz(RX_HOST_CLOCK_ICLK)))))
+        {
+            printf("perf deadline   : %lu us took %llu ns across a switch to PCLKB %lu Hz\n", (unsigned long)us,
+                   (unsigned long long)(expired_ns - set_ns), (unsigned long)rx_host_clock_hz(RX_HOST_CLOCK_PCLKB));
+            s_perf_errors++;
+        }
+        deadlines++;
+        if ((rx_host_vector_accepted(VECT_CMT0_CMI0) - matches) >= 2U)
+        {
+            check_perf_cmt0(pclkb_hz);
+        }
+    }
+
+    /* CMT0 time may gain or lose a count clock at each restart; the ticks follow it. */
+    elapsed = rx_host_time_ns() - t0;
+    measured = R_Config_CMT0_GetTimeNs() - ns0;
+    ticks = R_TIMER_GetTicks() - ticks0;
+    if ((measured > (elapsed + bound_ns)) || ((measured + bound_ns) < elapsed) ||
+        (((uint64_t)ticks * CMT0_PERIOD_US * 1000ULL) > (elapsed + (CMT0_PERIOD_US * 1000ULL) + bound_ns)) ||
+        ((((uint64_t)ticks + 1U) * CMT0_PERIOD_US * 1000ULL) + bound_ns < elapsed))
+    {
+        printf("perf time       : %llu ns and %lu ticks counted in %llu ns, %llu ns allowed\n",
+               (unsigned long long)measured, (unsigned long)ticks, (unsigned long long)elapsed,
+               (unsigned long long)bound_ns);
+        s_perf_errors++;
+    }
+    if ((clock_violations != rx_host_clock_violations()) || (mode_violations != rx_host_mode_violations()))
+    {
+        printf("perf            : %lu clock and %lu operating mode violations\n",
+               (unsigned long)(rx_host_clock_violations() - clock_violations),
+               (unsigned long)(rx_host_mode_violations() - mode_violations));
+        s_perf_errors++;
+    }
+    printf("perf deadlines  : %lu on CMT1 across the calls\n", deadlines);
+    printf("perf switches   : %lu switched, %lu refused as invalid, %lu with the sub-clock stopped, "
+           "%lu mode transitions, %llu ms\n", results[CLOCK_SUCCESS], results[CLOCK_ERR_INVALID_ARG],
+           results[CLOCK_ERR_NOT_STABLE], (unsigned long)(rx_host_mode_transitions() - transitions),
+           (unsigned long long)(elapsed / 1000000U));
+
+    /* Back to the boot clock, the PLL stopped as the boot left it. */
+    clock_setting_of(sckcr, sckcr3, &setting);
+    check_perf_one(&setting, CLOCK_SUCCESS);
+    if ((sckcr != SYSTEM.SCKCR.LONG) || (opccr != SYSTEM.OPCCR.BYTE) || (memwait != SYSTEM.MEMWAIT.BYTE))
+    {
+        s_perf_errors++;
+    }
+    SYSTEM.PLLCR.WORD = pllcr;
+    rx_host_osc_delay(RX_HOST_OSC_HOCO, 0U);
+    rx_host_osc_delay(RX_HOST_OSC_MAIN, 0U);
+    rx_host_osc_delay(RX_HOST_OSC_PLL, 0U);
+    g_rx_host_nop_cycles = nop_cycles;
+}
+
+/* One bring-up from reset: the clock switched first and the work after it, or the work polled in between. */
+static void run_clkstage(void)
+{
+    uint32_t i;
+
+    s_clkstage->start();
+    s_clkstage_start_ns = rx_host_time_ns();
+    if (false == s_clkstage_staged)
+    {
+        s_clkstage->finish();
+        s_clkstage_switch_ns = rx_host_time_ns();
+    }
+    for (i = 0; i < s_clkstage_work; i++)
+    {
+        if ((true == s_clkstage_staged) && (0U == (i % HOST_CLKSTAGE_POLL_NOPS)))
+        {
+            (void)s_clkstage->poll();
+        }
+        nop();
+    }
+    s_clkstage_work_ns = rx_host_time_ns();
+    if (true == s_clkstage_staged)
+    {
+        s_clkstage->finish();
+        s_clkstage_switch_ns = rx_host_time_ns();
+    }
+}
+
+/* After a bring-up: the clock source selected, never before it was stable nor outside the operating mode. The
+   oscillators start during R_CLKSTAGE_Start(), which takes time of its own with -a. */
+static void check_clkstage_switch(uint64_t stable_ns)
+{
+    if ((0U != rx_host_clock_violations()) || (0U != rx_host_mode_violations()) ||
+        (s_clkstage->cksel != SYSTEM.SCKCR3.BIT.CKSEL) ||
+        (s_clkstage->iclk_hz != rx_host_clock_hz(RX_HOST_CLOCK_ICLK)) ||
+        (CLKSTAGE_STATE_DONE != s_clkstage->poll()) || (s_clkstage_switch_ns < stable_ns))
+    {
+        s_clkstage_errors++;
+    }
+}
+
+/* Host-side driver of the -k check: each bring-up starts from a reset of the model. */
+static void check_clkstage(void)
+{
+    static const host_clkstage_t s_sources[] =
+    {
+        { "hoco", R_CLKSTAGE_Start, R_CLKSTAGE_Poll, R_CLKSTAGE_Finish, 1U, BSP_ICLK_HZ },
+        { "main", host_clkstage_main_start, host_clkstage_main_poll, host_clkstage_main_finish, 2U,
+          BSP_CFG_XTAL_HZ / BSP_CFG_ICK_DIV },
+        { "pll", host_clkstage_pll_start, host_clkstage_pll_poll, host_clkstage_pll_finish, 4U,
+          (uint32_t)(((BSP_CFG_XTAL_HZ / BSP_CFG_PLL_DIV) * BSP_CFG_PLL_MUL) / BSP_CFG_ICK_DIV) }
+    };
+    uint64_t      poll_ns = ((uint64_t)HOST_CLKSTAGE_POLL_NOPS * g_rx_host_nop_cycles * 1000000000ULL) /
+                            HOST_CLKSTAGE_LOCO_HZ;
+    uint64_t      staged_ns;
+    uint64_t      sequential_ns;
+    uint64_t      stable_ns;
+    uint64_t      bound_ns;
+    uint64_t      locked_ns;
+    uint64_t      work_done_ns;
+    uint32_t      hoco_us;
+    uint32_t      main_us;
+    uint32_t      pll_us;
+    unsigned long faster;
+    unsigned long i;
+    uint32_t      s;
+
+    srand(1);
+    for (s = 0; s < (sizeof(s_sources) / sizeof(s_sources[0])); s++)
+    {
+        s_clkstage = &s_sources[s];
+        staged_ns = 0;
+        sequential_ns = 0;
+        faster = 0;
+        for (i = 0; i < s_clkstage_trials; i++)
+        {
+            hoco_us = HOST_CLKSTAGE_HOCO_US * (1U + ((uint32_t)rand() % HOST_CLKSTAGE_SPREAD));
+            main_us = HOST_CLKSTAGE_MAIN_US * (1U + ((uint32_t)rand() % HOST_CLKSTAGE_SPREAD));
+            pll_us = HOST_CLKSTAGE_PLL_US * (1U + ((uint32_t)rand() % HOST_CLKSTAGE_SPREAD));
+            rx_host_osc_delay(RX_HOST_OSC_HOCO, hoco_us);
+            rx_host_osc_delay(RX_HOST_OSC_MAIN, main_us);
+            rx_host_osc_delay(RX_HOST_OSC_PLL, pll_us);
+            s_clkstage_work = (uint32_t)rand() % HOST_CLKSTAGE_WORK;
+            stable_ns = 1000ULL * ((1U == s_clkstage->cksel) ? hoco_us :
+                                   (2U == s_clkstage->cksel) ? main_us : (main_us + pll_us));
+
+            /* Switching first: the switch follows the oscillator, and the PLL its main clock, at once. */
+            rx_host_reset();
+            s_clkstage_staged = false;
+            rx_host_run(run_clkstage, HOST_CHECK_CYCLES);
+            check_clkstage_switch(stable_ns);
+            if (s_clkstage_switch_ns > (s_clkstage_start_ns + stable_ns + HOST_CLKSTAGE_SLACK_NS))
+            {
+                s_clkstage_errors++;
+            }
+            work_done_ns = s_clkstage_work_ns;
+            sequential_ns += work_done_ns;
+
+            /* Staged: the work runs at the LOCO while the oscillator stabilizes; the switch follows whichever ends
+               last, and a PLL may start up to a poll after its main clock. */
+            rx_host_reset();
+            s_clkstage_staged = true;
+            rx_host_run(run_clkstage, HOST_CHECK_CYCLES);
+            check_clkstage_switch(stable_ns);
+            locked_ns = s_clkstage_start_ns + stable_ns + ((4U == s_clkstage->cksel) ? poll_ns : 0U);
+            bound_ns = ((s_clkstage_work_ns > locked_ns) ? s_clkstage_work_ns : locked_ns) + HOST_CLKSTAGE_SLACK_NS;
+            if (s_clkstage_switch_ns > bound_ns)
+            {
+                s_clkstage_errors++;
+            }
+            staged_ns += s_clkstage_switch_ns;
+            if (s_clkstage_switch_ns < work_done_ns)
+            {
+                faster++;
+            }
+        }
+        printf("clkstage %-6s : %lu trials, clock up and work done at %llu us staged, %llu us switching first, "
+               "staged sooner in %lu\n", s_clkstage->name, s_clkstage_trials,
+               (unsigned long long)(staged_ns / s_clkstage_trials / 1000U),
+               (unsigned long long)(sequential_ns / s_clkstage_trials / 1000U), faster);
+    }
+
+    /* Through PowerON_Reset_PC with the slowest oscillators: the HOCO wait ends the boot timeline. */
+    hoco_us = HOST_CLKSTAGE_HOCO_US * HOST_CLKSTAGE_SPREAD;
+    rx_host_osc_delay(RX_HOST_OSC_HOCO, hoco_us);
+    rx_host_osc_delay(RX_HOST_OSC_MAIN, HOST_CLKSTAGE_MAIN_US * HOST_CLKSTAGE_SPREAD);
+    rx_host_osc_delay(RX_HOST_OSC_PLL, HOST_CLKSTAGE_PLL_US * HOST_CLKSTAGE_SPREAD);
+    rx_host_reset();
+    rx_host_run(PowerON_Reset_PC, HOST_CLKSTAGE_BOOT_CYCLES);
+    if ((0U != rx_host_clock_violations()) || (0U != rx_host_mode_violations()) ||
+        (1U != SYSTEM.SCKCR3.BIT.CKSEL) || (BSP_ICLK_HZ != rx_host_clock_hz(RX_HOST_CLOCK_ICLK)) ||
+        (R_BOOTTIME_TotalNs() < (1000U * hoco_us)))
+    {
+        s_clkstage_errors++;
+    }
+    printf("clkstage boot   : %lu ns to hardware_setup() with a %lu us HOCO\n", (unsigned long)R_BOOTTIME_TotalNs(),
+           (unsigned long)hoco_us);
+
+    for (s = 0; s < RX_HOST_OSCS; s++)
+    {
+        rx_host_osc_delay((rx_host_osc_t)s, 0U);
+    }
+}
+
+/* Fills the retained data with random bytes and seals it. */
+static void fill_retained(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < HOST_RETAIN_SIZE; i++)
+    {
+        s_retained[i] = (uint8_t)rand();
+    }
+    for (i = 0; i < HOST_RETAIN_1_SIZE; i++)
+    {
+        s_retained_1[i] = (uint8_t)rand();
+    }
+    R_RETAIN_Seal();
+    memcpy(s_retained_expected, s_retained, HOST_RETAIN_SIZE);
+    memcpy(s_retained_1_expected, s_retained_1, HOST_RETAIN_1_SIZE);
+}
+
+/* After a reset: the reset flags cleared for the next one and the section kept, or cleared, and sealed. */
+static void check_retained(retain_cause_t cause, retain_start_t start)
+{
+    static const uint8_t s_zeros[HOST_RETAIN_SIZE];
+
+    if ((cause != R_RETAIN_Cause()) || (start != R_RETAIN_Start()) || (0U != SYSTEM.RSTSR0.BYTE) ||
+        (0U != SYSTEM.RSTSR2.BYTE) || (1U != SYSTEM.RSTSR1.BIT.CWSF) || (false == R_RETAIN_IsSealed()) ||
+        (0 != memcmp(s_retained, (RETAIN_START_WARM == start) ? s_retained_expected : s_zeros, HOST_RETAIN_SIZE)) ||
+        (0 != memcmp(s_retained_1, (RETAIN_START_WARM == start) ? s_retained_1_expected : s_zeros,
+                     HOST_RETAIN_1_SIZE)))
+    {
+        s_retain_errors++;
+    }
+}
+
+/* Host-side driver of the -R check: each trial needs a reset of the model, so it runs the firmware itself. */
+static void check_retain(void)
+{
+    static const retain_cause_t s_causes[] =
+    {
+        RETAIN_CAUSE_POWER_ON, RETAIN_CAUSE_LVD, RETAIN_CAUSE_PIN, RETAIN_CAUSE_SOFTWARE, RETAIN_CAUSE_WDT,
+        RETAIN_CAUSE_IWDT
+    };
+    unsigned long  starts[3] = { 0, 0, 0 };
+    unsigned long  i;
+    retain_start_t start;
+    uint32_t       reset;
+    uint32_t       byte;
+    bool           changed;
+
+    rx_host_section_set("BRETAIN_1", &s_retained_1[0], &s_retained_1[HOST_RETAIN_1_SIZE]);
+    srand(1);
+    for (i = 0; i < s_retain_trials; i++)
+    {
+        /* rx_host_reset_t and retain_cause_t list the causes in the same order. */
+        reset = (uint32_t)rand() % (sizeof(s_causes) / sizeof(s_causes[0]));
+        changed = (0 == (rand() % 4));
+        fill_retained();
+        if (true == changed)
+        {
+            byte = (uint32_t)rand() % (HOST_RETAIN_SIZE + HOST_RETAIN_1_SIZE);
+            if (byte < HOST_RETAIN_SIZE)
+            {
+                s_retained[byte] ^= (uint8_t)(1U << (rand() & 7));
+            }
+            else
+            {
+                s_retained_1[byte - HOST_RETAIN_SIZE] ^= (uint8_t)(1U << (rand() & 7));
+            }
+        }
+
+        rx_host_reset_as((rx_host_reset_t)reset);
+        rx_host_run(R_RETAIN_Open, HOST_CHECK_CYCLES);
+
+        start = RETAIN_START_COLD;
+        if (s_causes[reset] >= RETAIN_CAUSE_SOFTWARE)
+        {
+            start = (true == changed) ? RETAIN_START_INVALID : RETAIN_START_WARM;
+        }
+        check_retained(s_causes[reset], start);
+        starts[start]++;
+    }
+    printf("retain starts   : %lu cold, %lu warm, %lu invalid\n", starts[RETAIN_START_COLD], starts[RETAIN_START_WARM],
+           starts[RETAIN_START_INVALID]);
+
+    /* Through PowerON_Reset_PC: a watchdog reset, then a software reset made by R_RETAIN_Reset() */
+    fill_retained();
+    rx_host_reset_as(RX_HOST_RESET_WDT);
+    rx_host_run(PowerON_Reset_PC, HOST_RETAIN_BOOT_CYCLES);
+    check_retained(RETAIN_CAUSE_WDT, RETAIN_START_WARM);
+
+    s_retained[0]++;
+    s_retained_expected[0] = s_retained[0];
+    rx_host_run(R_RETAIN_Reset, HOST_RETAIN_BOOT_CYCLES);
+    if ((0xA501U != SYSTEM.SWRR) || (false == R_RETAIN_IsSealed()))
+    {
+        s_retain_errors++;
+    }
+
+    /* The write enable went through the BSP's nesting count: a nested disable and enable leave it enabled. */
+    R_BSP_RegisterProtectDisable(BSP_REG_PROTECT_LPC_CGC_SWR);
+    R_BSP_RegisterProtectEnable(BSP_REG_PROTECT_LPC_CGC_SWR);
+    if (0U == SYSTEM.PRCR.BIT.PRC1)
+    {
+        s_retain_errors++;
+    }
+    R_BSP_RegisterProtectEnable(BSP_REG_PROTECT_LPC_CGC_SWR);
+    rx_host_reset_as(RX_HOST_RESET_SOFTWARE);
+    rx_host_run(PowerON_Reset_PC, HOST_RETAIN_BOOT_CYCLES);
+    check_retained(RETAIN_CAUSE_SOFTWARE, RETAIN_START_WARM);
+    rx_host_section_set(NULL, NULL, NULL);
+}
+
+static void print_trace(uint32_t ring_entries)
+{
+    static rx_host_trace_entry_t s_entries[RX_HOST_TRACE_RING_SIZE];
+    const rx_host_trace_count_t  *p_count;
+    const char                   *name;
+    uint32_t                     accepted;
+    uint32_t                     count;
+    uint32_t                     i;
+
+    if (false == rx_host_trace_available())
+    {
+        printf("trace           : not available, build with 'make TRACE=1'\n");
+        return;
+    }
+
+    printf("trace           : %llu register accesses\n", (unsigned long long)rx_host_trace_total());
+    for (i = 0; i < rx_host_trace_peripheral_count(); i++)
+    {
+        p_count = rx_host_trace_peripheral_counts(i);
+        if ((0 != p_count->reads) || (0 != p_count->writes))
+        {
+            printf("  %-13s : %10llu R %10llu W\n", rx_host_trace_peripheral_name(i),
+                   (unsigned long long)p_count->reads, (unsigned long long)p_count->writes);
+        }
+    }
+
+    for (i = 0; i < RX_HOST_VECTOR_COUNT; i++)
+    {
+        p_count = rx_host_trace_vector_counts(i);
+        accepted = rx_host_vector_accepted(i);
+        if (0 == i)
+        {
+            printf("  thread        : %10llu R %10llu W\n",
+                   (unsigned long long)p_count->reads, (unsigned long long)p_count->writes);
+        }
+        else if (0 != accepted)
+        {
+            printf("  vector %-6lu : %10llu R %10llu W (%.1f R %.1f W per interrupt)\n", (unsigned long)i,
+                   (unsigned long long)p_count->reads, (unsigned long long)p_count->writes,
+                   (double)p_count->reads / accepted, (double)p_count->writes / accepted);
+        }
+    }
+
+    count = rx_host_trace_ring_read(s_entries, ring_entries);
+    for (i = 0; i < count; i++)
+    {
+        name = rx_host_trace_register_name(s_entries[i].peripheral, s_entries[i].offset);
+        printf("  %c%u %s.%s +0x%04x\n", (0 != (s_entries[i].access & RX_HOST_TRACE_WRITE)) ? 'W' : 'R',
+               (unsigned)(s_entries[i].access & RX_HOST_TRACE_WIDTH_MASK),
+               rx_host_trace_peripheral_name(s_entries[i].peripheral), (NULL == name) ? "?" : name,
+               (unsigned)s_entries[i].offset);
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    unsigned long      resets = 1;
+    unsigned long long budget = HOST_DEFAULT_CYCLES;
+    unsigned long      i;
+    uint64_t           cycles = 0;
+    struct timespec    t0;
+    struct timespec    t1;
+    double             elapsed;
+    long               ring_entries = -1;
+    int                opt;
+
+    while (-1 != (opt = getopt(argc, argv, "r:t:q:a:T:s:b:l:pw:d:i:H:f:o:e:S:gn:BC:D:u:m:k:R:zc")))
+    {
+        switch (opt)
+        {
+            case 'r':
+                resets = strtoul(optarg, NULL, 0);
+                break;
+            case 't':
+                budget = strtoull(optarg, NULL, 0);
+                break;
+            case 'q':
+                g_rx_host_nop_cycles = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'a':
+                g_rx_host_access_cycles = (uint32_t)strtoul(optarg, NULL, 0);
+                break;
+            case 'T':
+                ring_entries = strtol(optarg, NULL, 0);
+                break;
+            case 's':
+                s_samples = strtoul(optarg, NULL, 0);
+                break;
+            case 'b':
+                s_bench_ticks = strtoul(optarg, NULL, 0);
+                break;
+            case 'w':
+                s_workq_items = strtoul(optarg, NULL, 0);
+                break;
+            case 'd':
+                s_sched_ticks = strtoul(optarg, NULL, 0);
+                break;
+            case 'i':
+                s_power_ticks = strtoul(optarg, NULL, 0);
+                break;
+            case 'H':
+                s_latency_samples = strtoul(optarg, NULL, 0);
+                break;
+            case 'f':
+                s_profile_scopes = strtoul(optarg, NULL, 0);
+                break;
+            case 'o':
+                s_port_updates = strtoul(optarg, NULL, 0);
+                break;
+            case 'e':
+                s_elc_periods = strtoul(optarg, NULL, 0);
+                break;
+            case 'S':
+                s_dtcseq_wraps = strtoul(optarg, NULL, 0);
+                break;
+            case 'g':
+                s_pin_check = true;
+                break;
+            case 'n':
+                s_ne_trials = strtoul(optarg, NULL, 0);
+                break;
+            case 'B':
+                s_boot_check = true;
+                break;
+            case 'C':
+                s_clock_trials = strtoul(optarg, NULL, 0);
+                break;
+            case 'D':
+                s_delay_trials = strtoul(optarg, NULL, 0);
+                break;
+            case 'u':
+                s_deadline_trials = strtoul(optarg, NULL, 0);
+                break;
+            case 'm':
+                s_perf_trials = strtoul(optarg, NULL, 0);
+                break;
+            case 'k':
+                s_clkstage_trials = strtoul(optarg, NULL, 0);
+                break;
+            case 'R':
+                s_retain_trials = strtoul(optarg, NULL, 0);
+                break;
+            case 'z':
+                s_zsect_check = true;
+                break;
+            case 'c':
+                s_initsct_check = true;
+                break;
+            case 'p':
+                s_period_check = true;
+                break;
+            case 'l':
+                s_idle_ticks = strtoul(optarg, NULL, 0);
+                break;
+            default:
+                usage(argv[0]);
+                break;
+        }
+    }
+
+    if ((0 == resets) || (0 == g_rx_host_nop_cycles))
+    {
+        usage(argv[0]);
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (i = 0; i < resets; i++)
+    {
+        rx_host_reset();
+        rx_host_trace_clear();
+        cycles = rx_host_run(PowerON_Reset_PC, budget);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    elapsed = (double)(t1.tv_sec - t0.tv_sec) + ((double)(t1.tv_nsec - t0.tv_nsec) / 1e9);
+
+    printf("resets          : %lu\n", resets);
+    printf("cycles/reset    : %llu (%.6f s at ICLK %lu Hz)\n", (unsigned long long)cycles,
+           (double)cycles / rx_host_clock_hz(RX_HOST_CLOCK_ICLK), (unsigned long)rx_host_clock_hz(RX_HOST_CLOCK_ICLK));
+    printf("PCLKB           : %lu Hz\n", (unsigned long)rx_host_clock_hz(RX_HOST_CLOCK_PCLKB));
+    printf("CMT0 CMI0       : %lu\n", (unsigned long)rx_host_vector_accepted(VECT_CMT0_CMI0));
+    printf("BSC BUSERR      : %lu\n", (unsigned long)rx_host_vector_accepted(VECT_BSC_BUSERR));
+    printf("PORTD.PODR      : 0x%02x\n", (unsigned)PORTD.PODR.BYTE);
+    printf("host time       : %.3f s (%.1f resets/s)\n", elapsed, (double)resets / elapsed);
+
+    if (ring_entries >= 0)
+    {
+        print_trace((uint32_t)ring_entries);
+    }
+
+    if (true == s_boot_check)
+    {
+        rx_host_run(check_boottime, HOST_CHECK_CYCLES);
+        printf("boot check      : %lu errors\n", s_boot_errors);
+        if (0 != s_boot_errors)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (0 != s_samples)
+    {
+        rx_host_run(check_timestamps, HOST_CHECK_CYCLES);
+        printf("timestamp check : %lu samples, %lu with a pending compare match, %lu errors\n",
+               s_samples, s_sample_pending, s_sample_errors);
+        if (0 != s_sample_errors)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (0 != s_workq_items)
+    {
+        bench_workq();
+        if (0 != s_workq_errors)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (0 != s_sched_ticks)
+    {
+        rx_host_run(bench_sched, HOST_CHECK_CYCLES);
+        printf("scheduler check : %lu errors\n", s_sched_errors);
+        if (0 != s_sched_errors)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (0 != s_power_ticks)
+    {
+        rx_host_run(check_power_modes, HOST_CHECK_CYCLES);
+        rx_host_run(check_power_load, HOST_CHECK_CYCLES);
+        report_power_load();
+        printf("idle check      : %lu errors\n", s_power_errors);
+        if (0 != s_power_errors)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (0 != s_latency_samples)
+    {
+        rx_host_run(check_latency, HOST_CHECK_CYCLES);
+        printf("latency check   : %lu errors\n", s_latency_errors);
+        if (0 != s_latency_errors)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (0 != s_profile_scopes)
+    {
+        rx_host_run(check_profile, HOST_CHECK_CYCLES);
+        printf("profile check   : %lu errors\n", s_profile_errors);
+        if (0 != s_profile_errors)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (0 != s_port_updates)
+    {
+        rx_host_run(check_port, HOST_CHECK_CYCLES);
+        printf("port check      : %lu errors\n", s_port_errors);
+        if (0 != s_port_errors)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (0 != s_elc_periods)
+    {
+        rx_host_run(check_elc, HOST_CHECK_CYCLES);
+        printf("elc check       : %lu errors\n", s_elc_errors);
+        if (0 != s_elc_errors)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (0 != s_dtcseq_wraps)
+    {
+        rx_host_run(check_dtcseq, HOST_CHECK_CYCLES);
+        printf("dtcseq check    : %lu errors\n", s_dtcseq_errors);
+        if (0 != s_dtcseq_errors)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (true == s_pin_check)
+    {
+        rx_host_run(check_pins, HOST_CHECK_CYCLES);
+        printf("pin check       : %lu errors\n", s_pin_errors);
+        if (0 != s_pin_errors)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (0 != s_ne_trials)
+    {
+        rx_host_run(check_non_existent_ports, HOST_CHECK_CYCLES);
+        printf("ne port check   : %lu errors\n", s_ne_errors);
+        if (0 != s_ne_errors)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (true == s_period_check)
+    {
+        check_period_solver();
+        if (0 != s_period_errors)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (0 != s_idle_ticks)
+    {
+        rx_host_run(check_periodic, HOST_CHECK_CYCLES);
+        rx_host_run(check_tickless, HOST_CHECK_CYCLES);
+        printf("tickless check  : %lu errors\n", s_idle_errors);
+        if (0 != s_idle_errors)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (0 != s_bench_ticks)
+    {
+        rx_host_run(bench_timers, HOST_CHECK_CYCLES);
+        printf("timer wheel     : %lu late expiries\n", s_bench_errors);
+        if (0 != s_bench_errors)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (0 != s_clock_trials)
+    {
+        rx_host_run(check_clock, HOST_CHECK_CYCLES);
+        printf("clock check     : %lu errors\n", s_clock_errors);
+        if (0 != s_clock_errors)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (0 != s_delay_trials)
+    {
+        rx_host_run(check_delay, HOST_CHECK_CYCLES);
+        printf("delay check     : %lu errors\n", s_delay_errors);
+        if (0 != s_delay_errors)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (0 != s_deadline_trials)
+    {
+        rx_host_run(check_deadline, HOST_CHECK_CYCLES);
+        printf("deadline check  : %lu errors\n", s_deadline_errors);
+        if (0 != s_deadline_errors)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (0 != s_perf_trials)
+    {
+        rx_host_run(check_perf, HOST_CHECK_CYCLES);
+        printf("perf check      : %lu errors\n", s_perf_errors);
+        if (0 != s_perf_errors)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (0 != s_clkstage_trials)
+    {
+        check_clkstage();
+        printf("clkstage check  : %lu errors\n", s_clkstage_errors);
+        if (0 != s_clkstage_errors)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (0 != s_retain_trials)
+    {
+        check_retain();
+        printf("retain check    : %lu errors\n", s_retain_errors);
+        if (0 != s_retain_errors)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (true == s_zsect_check)
+    {
+        rx_host_run(check_zsect, HOST_CHECK_CYCLES);
+        printf("zsect check     : %lu errors\n", s_zsect_errors);
+        if (0 != s_zsect_errors)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (true == s_initsct_check)
+    {
+        rx_host_run(check_initsct, HOST_CHECK_CYCLES);
+        printf("initsct check   : %lu errors\n", s_initsct_errors);
+        if (0 != s_initsct_errors)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    return 0;
+}
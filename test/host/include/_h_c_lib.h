@@ -0,0 +1,15 @@
+/***********************************************************************
+*
+*  FILE        : _h_c_lib.h
+*  DESCRIPTION : Host replacement for the CC-RX C runtime start-up
+*                declarations used by resetprg.c.
+*
+***********************************************************************/
+
+#ifndef RX_HOST_H_C_LIB_H
+#define RX_HOST_H_C_LIB_H
+
+/* Re-initializes the firmware's initialized and uninitialized data (see rx_host.c). */
+void _INITSCT(void);
+
+#endif /* RX_HOST_H_C_LIB_H */
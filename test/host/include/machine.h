@@ -0,0 +1,133 @@
+/***********************************************************************
+*
+*  FILE        : machine.h
+*  DESCRIPTION : Host replacement for the CC-RX <machine.h> intrinsic
+*                functions. Each intrinsic acts on the CPU model in
+*                rx_host.c instead of the RX core.
+*
+***********************************************************************/
+
+#ifndef RX_HOST_MACHINE_H
+#define RX_HOST_MACHINE_H
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <stdint.h>
+#include <stdlib.h>
+#include "rx_host.h"
+
+/***********************************************************************************************************************
+Intrinsic functions
+***********************************************************************************************************************/
+static inline void nop(void)
+{
+    rx_host_advance(g_rx_host_nop_cycles);
+}
+
+static inline void wait(void)
+{
+    rx_host_wait();
+}
+
+static inline void brk(void)
+{
+    abort();
+}
+
+static inline void int_exception(signed long num)
+{
+    (void)num;
+    abort();
+}
+
+static inline void setpsw_i(void)
+{
+    g_rx_host_cpu.psw |= RX_HOST_PSW_I;
+    rx_host_interrupt_poll();
+}
+
+static inline void clrpsw_i(void)
+{
+    g_rx_host_cpu.psw &= ~RX_HOST_PSW_I;
+}
+
+static inline void set_ipl(signed long level)
+{
+    g_rx_host_cpu.psw = (g_rx_host_cpu.psw & ~RX_HOST_PSW_IPL_MASK) |
+                        (((uint32_t)level << RX_HOST_PSW_IPL_SHIFT) & RX_HOST_PSW_IPL_MASK);
+    rx_host_interrupt_poll();
+}
+
+static inline unsigned char get_ipl(void)
+{
+    return (unsigned char)((g_rx_host_cpu.psw & RX_HOST_PSW_IPL_MASK) >> RX_HOST_PSW_IPL_SHIFT);
+}
+
+static inline void set_psw(unsigned long data)
+{
+    g_rx_host_cpu.psw = (uint32_t)data;
+    rx_host_interrupt_poll();
+}
+
+static inline unsigned long get_psw(void)
+{
+    return g_rx_host_cpu.psw;
+}
+
+static inline void chg_pmusr(void)
+{
+    g_rx_host_cpu.psw |= RX_HOST_PSW_PM;
+}
+
+static inline void set_fpsw(unsigned long data)
+{
+    g_rx_host_cpu.fpsw = (uint32_t)data;
+}
+
+static inline unsigned long get_fpsw(void)
+{
+    return g_rx_host_cpu.fpsw;
+}
+
+static inline void set_intb(void *data)
+{
+    g_rx_host_cpu.intb = (uint32_t)(uintptr_t)data;
+}
+
+static inline void *get_intb(void)
+{
+    return (void *)(uintptr_t)g_rx_host_cpu.intb;
+}
+
+static inline void set_extb(void *data)
+{
+    g_rx_host_cpu.extb = (uint32_t)(uintptr_t)data;
+}
+
+static inline void set_bpsw(unsigned long data)
+{
+    g_rx_host_cpu.bpsw = (uint32_t)data;
+}
+
+static inline void set_bpc(void *data)
+{
+    g_rx_host_cpu.bpc = (uint32_t)(uintptr_t)data;
+}
+
+static inline void set_fintv(void *data)
+{
+    g_rx_host_cpu.fintv = (uint32_t)(uintptr_t)data;
+}
+
+/* CC-RX 'signed long' is 32 bits wide. Interrupts are only accepted at intrinsic calls, so the swap is atomic with
+   respect to the simulated ISRs exactly like the XCHG instruction. */
+static inline void xchg(int32_t *data1, int32_t *data2)
+{
+    int32_t temp = *data1;
+
+    *data1 = *data2;
+    *data2 = temp;
+}
+
+#endif /* RX_HOST_MACHINE_H */
@@ -0,0 +1,22 @@
+/***********************************************************************
+*
+*  FILE        : rx_host_compiler.h
+*  DESCRIPTION : CC-RX language extensions for the host build. This
+*                header is force-included into every firmware source.
+*
+***********************************************************************/
+
+#ifndef RX_HOST_COMPILER_H
+#define RX_HOST_COMPILER_H
+
+/* __evenaccess only constrains the RX bus access width; the host register file is ordinary memory. */
+#define __evenaccess
+
+/* There is no CC-RX section layout on the host; the section address operators find the host's stand-ins for the
+   C$DSEC and C$BSEC tables and of the one set by rx_host_section_set(), and null pointers for other sections. */
+void *rx_host_sectop(const char *name);
+void *rx_host_secend(const char *name);
+#define __sectop(name)      rx_host_sectop(name)
+#define __secend(name)      rx_host_secend(name)
+
+#endif /* RX_HOST_COMPILER_H */
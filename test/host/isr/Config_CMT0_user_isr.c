@@ -0,0 +1,11 @@
+/***********************************************************************
+*
+*  FILE        : Config_CMT0_user_isr.c
+*  DESCRIPTION : Host build of Config_CMT0_user.c. Registers the static
+*                compare match ISR declared with '#pragma interrupt'.
+*
+***********************************************************************/
+
+#include "Config_CMT0_user.c"
+
+RX_HOST_INTERRUPT(CMT0, CMI0, r_Config_CMT0_cmi0_interrupt)
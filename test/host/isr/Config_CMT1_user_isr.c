@@ -0,0 +1,11 @@
+/***********************************************************************
+*
+*  FILE        : Config_CMT1_user_isr.c
+*  DESCRIPTION : Host build of Config_CMT1_user.c. Registers the static
+*                compare match ISR declared with '#pragma interrupt'.
+*
+***********************************************************************/
+
+#include "Config_CMT1_user.c"
+
+RX_HOST_INTERRUPT(CMT1, CMI1, r_Config_CMT1_cmi1_interrupt)
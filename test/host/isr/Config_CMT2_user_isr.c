@@ -0,0 +1,11 @@
+/***********************************************************************
+*
+*  FILE        : Config_CMT2_user_isr.c
+*  DESCRIPTION : Host build of Config_CMT2_user.c. Registers the static
+*                compare match ISR declared with '#pragma interrupt'.
+*
+***********************************************************************/
+
+#include "Config_CMT2_user.c"
+
+RX_HOST_INTERRUPT(CMT2, CMI2, r_Config_CMT2_cmi2_interrupt)
@@ -0,0 +1,17 @@
+/***********************************************************************
+*
+*  FILE        : clkstage_main.c
+*  DESCRIPTION : Host build of r_clkstage.c for the main clock source,
+*                for the staged clock check (-k).
+*
+***********************************************************************/
+
+#include "platform.h"
+
+#undef  BSP_CFG_CLOCK_SOURCE
+#define BSP_CFG_CLOCK_SOURCE        (2)
+#define R_CLKSTAGE_Start            host_clkstage_main_start
+#define R_CLKSTAGE_Poll             host_clkstage_main_poll
+#define R_CLKSTAGE_Finish           host_clkstage_main_finish
+
+#include "r_clkstage.c"
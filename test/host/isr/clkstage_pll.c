@@ -0,0 +1,17 @@
+/***********************************************************************
+*
+*  FILE        : clkstage_pll.c
+*  DESCRIPTION : Host build of r_clkstage.c for the PLL clock source,
+*                for the staged clock check (-k).
+*
+***********************************************************************/
+
+#include "platform.h"
+
+#undef  BSP_CFG_CLOCK_SOURCE
+#define BSP_CFG_CLOCK_SOURCE        (4)
+#define R_CLKSTAGE_Start            host_clkstage_pll_start
+#define R_CLKSTAGE_Poll             host_clkstage_pll_poll
+#define R_CLKSTAGE_Finish           host_clkstage_pll_finish
+
+#include "r_clkstage.c"
@@ -0,0 +1,43 @@
+/***********************************************************************
+*
+*  FILE        : host_pin_ops.c
+*  DESCRIPTION : Firmware side of the host pin check (-g): each r_pin
+*                pin and group operation on PORTA, one per function.
+*
+*  NOTE: Built like the firmware, so that with TRACE=1 host_main.c
+*        can compare the register accesses of each operation with the
+*        ones expected of it. PORTA is not connected on the board.
+*
+***********************************************************************/
+
+#include "platform.h"
+#include "r_cg_userdefine.h"
+
+#define HOST_PIN_IO         A, 1
+#define HOST_GROUP_IO       A, 0x3CU
+#define HOST_FULL_IO        A, 0xFFU
+
+/* Set by host_main.c before a write, read back after a read; a variable, so that the level is not folded. */
+volatile uint8_t g_host_pin_level;
+
+void host_pin_set(void)                 { R_PIN_SET(HOST_PIN_IO); }
+void host_pin_clear(void)               { R_PIN_CLEAR(HOST_PIN_IO); }
+void host_pin_write(void)               { R_PIN_WRITE(HOST_PIN_IO, g_host_pin_level); }
+void host_pin_toggle(void)              { R_PIN_TOGGLE(HOST_PIN_IO); }
+void host_pin_read(void)                { g_host_pin_level = R_PIN_READ(HOST_PIN_IO); }
+void host_pin_output(void)              { R_PIN_OUTPUT(HOST_PIN_IO, 1U); }
+void host_pin_input(void)               { R_PIN_INPUT(HOST_PIN_IO); }
+void host_pin_peripheral(void)          { R_PIN_PERIPHERAL(HOST_PIN_IO); }
+void host_pin_drive(void)               { R_PIN_DRIVE(HOST_PIN_IO, 1U); }
+
+void host_pin_group_set(void)           { R_PIN_GROUP_SET(HOST_GROUP_IO); }
+void host_pin_group_clear(void)         { R_PIN_GROUP_CLEAR(HOST_GROUP_IO); }
+void host_pin_group_write(void)         { R_PIN_GROUP_WRITE(HOST_GROUP_IO, g_host_pin_level); }
+void host_pin_group_toggle(void)        { R_PIN_GROUP_TOGGLE(HOST_GROUP_IO); }
+void host_pin_group_output(void)        { R_PIN_GROUP_OUTPUT(HOST_GROUP_IO, 0x0FU); }
+void host_pin_group_input(void)         { R_PIN_GROUP_INPUT(HOST_GROUP_IO); }
+void host_pin_group_peripheral(void)    { R_PIN_GROUP_PERIPHERAL(HOST_GROUP_IO); }
+void host_pin_group_drive(void)         { R_PIN_GROUP_DRIVE(HOST_GROUP_IO, 1U); }
+
+void host_pin_full_output(void)         { R_PIN_GROUP_OUTPUT(HOST_FULL_IO, 0x3CU); }
+void host_pin_full_toggle(void)         { R_PIN_GROUP_TOGGLE(HOST_FULL_IO); }
@@ -0,0 +1,72 @@
+/***********************************************************************
+*
+*  FILE        : host_port_isr.c
+*  DESCRIPTION : Firmware side of the host port check (-o): the LED
+*                updates of the main loop and of a simulated IRQ1
+*                interrupt, with r_port or without it.
+*
+*  NOTE: Built like the firmware, so that with TRACE=1 their register
+*        accesses are counted and, with -a, can be interrupted. A
+*        one-bit field toggle is a single BNOT on the RX, which the
+*        model cannot split either; the race is run against byte
+*        read-modify-writes, the way several pins of a port are
+*        updated together without r_port.
+*
+***********************************************************************/
+
+#include "platform.h"
+#include "r_cg_userdefine.h"
+#include "rx_host.h"
+
+/* Set by host_main.c before a run; IRQ1 owns LED1 and counts the updates of it it finds undone. */
+volatile bool     g_host_port_direct;
+volatile bool     g_host_port_led1;
+volatile uint32_t g_host_port_lost;
+volatile uint32_t g_host_port_irqs;
+volatile uint32_t g_host_port_spacing;
+
+void host_port_toggle_leds(void)
+{
+    if (true == g_host_port_direct)
+    {
+        LED0 = ~LED0;
+        LED1 = ~LED1;
+    }
+    else
+    {
+        (void)R_PORT_Toggle(LED_PORT, LED0_PIN | LED1_PIN);
+    }
+}
+
+void host_port_toggle_led0(void)
+{
+    if (true == g_host_port_direct)
+    {
+        PORTD.PODR.BYTE ^= LED0_PIN;
+    }
+    else
+    {
+        (void)R_PORT_Toggle(LED_PORT, LED0_PIN);
+    }
+}
+
+static void host_port_irq1_isr(void)
+{
+    if ((0U != (PORTD.PODR.BYTE & LED1_PIN)) != g_host_port_led1)
+    {
+        g_host_port_lost++;
+    }
+    if (true == g_host_port_direct)
+    {
+        PORTD.PODR.BYTE ^= LED1_PIN;
+    }
+    else
+    {
+        (void)R_PORT_Toggle(LED_PORT, LED1_PIN);
+    }
+    g_host_port_led1 = (0U != (PORTD.PODR.BYTE & LED1_PIN));
+    g_host_port_irqs++;
+    rx_host_wake_source(VECT_ICU_IRQ1, 1U + ((uint32_t)rand() % g_host_port_spacing));
+}
+
+RX_HOST_INTERRUPT(ICU, IRQ1, host_port_irq1_isr)
@@ -0,0 +1,17 @@
+/***********************************************************************
+*
+*  FILE        : mcu_init_64.c
+*  DESCRIPTION : Host build of mcu_init.c for the 64-pin packages, for
+*                the non-existent port check (-n).
+*
+***********************************************************************/
+
+#include "platform.h"
+
+#undef  BSP_PACKAGE_PINS
+#define BSP_PACKAGE_PINS            (64)
+#define bsp_non_existent_port_init  host_non_existent_port_init_64
+
+void host_non_existent_port_init_64(void);
+
+#include "mcu/rx231/mcu_init.c"
@@ -0,0 +1,11 @@
+/***********************************************************************
+*
+*  FILE        : vecttbl_isr.c
+*  DESCRIPTION : Host build of vecttbl.c. Registers the bus error ISR
+*                declared with '#pragma interrupt'.
+*
+***********************************************************************/
+
+#include "board/generic_rx231/vecttbl.c"
+
+RX_HOST_INTERRUPT(BSC, BUSERR, bus_error_isr)
@@ -0,0 +1,2033 @@
+/***********************************************************************
+*
+*  FILE        : rx_host.c
+*  DESCRIPTION : Host (Linux/gcc) model of the RX231: peripheral register
+*                file, CPU/ICU interrupt acceptance, clock generator
+*                decode, the compare match timers (CMT0..CMT3), TMR0/TMR1
+*                in 16-bit count mode, the ELC single port outputs and
+*                the DTC, and the operating mode transitions.
+*
+*  NOTE: Only the behaviour the BSP and application depend on is
+*        modelled. Oscillator stabilization flags read as stable from
+*        reset and every other register behaves as plain memory.
+*        TMR0/TMR1 count only in 16-bit mode on an internal clock;
+*        the ELC links only TMR0 compare match A to single ports.
+*        The DTC runs in full-address mode and takes no bus cycles:
+*        an activation completes its whole transfer chain at the
+*        instant of the interrupt request.
+*        OPCMTSF and SOPCMTSF are set for a fixed transition time from
+*        the first time that passes after OPCCR or SOPCCR changes, so
+*        a write and the wait that follows it are only seen apart
+*        when register accesses take time (TRACE=1 with -a). Changes
+*        seen together are taken in whatever order the rules allow.
+*
+***********************************************************************/
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "platform.h"
+#include "rx_host.h"
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* Number of compare match timer channels. */
+#define RX_HOST_CMT_CHANNELS    (4)
+
+/* Further section ranges rx_host_section_set() holds at once. */
+#define RX_HOST_SECTIONS        (2U)
+
+/* Longest step a software delay advances time by. */
+#define RX_HOST_DELAY_STEP_CYCLES   (0x80000000UL)
+
+/* ELC event number of TMR0 compare match A0, the number of single ports, and the ELSRn destinations the model
+   drives: other destinations are not modelled. */
+#define RX_HOST_ELC_TMR0_CMIA0  (0x22U)
+#define RX_HOST_ELC_PORTS       (4U)
+#define RX_HOST_ELC_ELSR_COUNT  (30U)
+#define RX_HOST_ELC_DEST_NONE   (0U)
+#define RX_HOST_ELC_DEST_GROUP1 (1U)
+#define RX_HOST_ELC_DEST_GROUP2 (2U)
+#define RX_HOST_ELC_DEST_PORT0  (3U)
+
+/* DTC transfer information: MRA/MRB fields and the vectors DTCER covers. */
+#define RX_HOST_DTC_MD_NORMAL   (0U)
+#define RX_HOST_DTC_MD_REPEAT   (1U)
+#define RX_HOST_DTC_MD_BLOCK    (2U)
+#define RX_HOST_DTC_MRB_CHNE    (0x80U)
+#define RX_HOST_DTC_MRB_CHNS    (0x40U)
+#define RX_HOST_DTC_MRB_DISEL   (0x20U)
+#define RX_HOST_DTC_MRB_DTS     (0x10U)
+#define RX_HOST_DTC_VECTORS     (253U)
+#define RX_HOST_DTC_VBR_MASK    (0xFFFFFC00UL)  /* DTCVBR bits 9 to 0 are fixed at 0 */
+
+/* HOCO frequencies selected by HOCOCR2.HCFRQ. */
+#define RX_HOST_HOCO_32MHZ      (32000000UL)
+#define RX_HOST_HOCO_54MHZ      (54000000UL)
+#define RX_HOST_LOCO_HZ         (4000000UL)
+#define RX_HOST_SUB_HZ          (32768UL)
+
+/* SCKCR3.CKSEL values of the oscillators rx_host_osc_delay() can slow down */
+#define RX_HOST_CKSEL_HOCO      (1U)
+#define RX_HOST_CKSEL_MAIN      (2U)
+#define RX_HOST_CKSEL_PLL       (4U)
+
+/* OPCCR.OPCM and SOPCCR.SOPCM settings, the fastest clock of high-speed operation, and the time OPCMTSF or SOPCMTSF
+   stays set after a mode change. */
+#define RX_HOST_OPCM_HIGH       (0U)
+#define RX_HOST_OPCM_MIDDLE     (2U)
+#define RX_HOST_SOPCM_LOW       (1U)
+#define RX_HOST_HIGH_SPEED_HZ   (54000000UL)
+#define RX_HOST_MODE_TRANSITION_PS  (5000000ULL)
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+typedef struct
+{
+    uintptr_t base;
+    size_t    size;
+} rx_host_area_t;
+
+typedef struct
+{
+    void              (*isr)(void);
+    volatile uint8_t  *ipr;
+    uint32_t          accepted;
+} rx_host_vector_t;
+
+typedef struct
+{
+    volatile struct st_cmt0 *regs;
+    uint32_t                vector;
+    uint32_t                prescale;   /* PCLKB cycles not yet converted to counts */
+    uint64_t                counts;     /* Count clocks since reset */
+    uint64_t                pclkb;      /* PCLKB cycles counted since reset */
+} rx_host_cmt_t;
+
+typedef struct
+{
+    uint64_t delay_ps;                  /* Stabilization time, 0 to report the oscillator stable at all times */
+    uint64_t running_ps;                /* Time since the oscillator was started */
+} rx_host_osc_model_t;
+
+typedef struct
+{
+    uint8_t  opcm;
+    uint8_t  sopcm;
+    uint8_t  memwait;
+    uint8_t  cksel;
+    uint32_t sckcr;
+} rx_host_mode_t;
+
+/***********************************************************************************************************************
+Private global variables and functions
+***********************************************************************************************************************/
+/* Peripheral I/O areas of the RX231 address space, mapped into the host process at the same addresses. */
+static const rx_host_area_t s_areas[] =
+{
+    { RX_HOST_IO_BASE,       RX_HOST_IO_SIZE },
+    { RX_HOST_FLASH_IO_BASE, RX_HOST_FLASH_IO_SIZE }
+};
+
+/* Event link destination of each ELSRn, from the RX231 hardware manual's ELSRn table: ELSR24 and ELSR25 are output
+   port groups 1 and 2, ELSR26 to ELSR29 single ports 0 to 3 (PEL0 to PEL3). */
+static const uint8_t s_elc_destinations[RX_HOST_ELC_ELSR_COUNT] =
+{
+    [24] = RX_HOST_ELC_DEST_GROUP1,
+    [25] = RX_HOST_ELC_DEST_GROUP2,
+    [26] = RX_HOST_ELC_DEST_PORT0,
+    [27] = RX_HOST_ELC_DEST_PORT0 + 1U,
+    [28] = RX_HOST_ELC_DEST_PORT0 + 2U,
+    [29] = RX_HOST_ELC_DEST_PORT0 + 3U
+};
+
+static rx_host_vector_t s_vectors[RX_HOST_VECTOR_COUNT];
+static uint8_t          s_vector_list[RX_HOST_VECTOR_COUNT];
+static uint32_t         s_vector_list_count;
+static uint32_t         s_accepted_total;
+static uint32_t         s_current_vector;   /* Vector being serviced, 0 outside interrupts */
+static uint32_t         s_interrupt_depth;
+static uint32_t         s_thread_psw;       /* PSW of the interrupted non-interrupt code */
+
+static rx_host_cmt_t    s_cmt[RX_HOST_CMT_CHANNELS];
+
+static uint32_t         s_tmr01_prescale;   /* PCLKB cycles not yet converted to TMR0/TMR1 counts */
+static uint64_t         s_tmr01_matches;    /* 16-bit compare matches A since reset */
+static uint64_t         s_elc_events[RX_HOST_ELC_PORTS];
+static uint64_t         s_dtc_activations;
+
+static rx_host_osc_model_t s_osc[RX_HOST_OSCS];
+static uint32_t         s_clock_violations;
+static rx_host_mode_t   s_mode;             /* Operating mode and clock registers as mode_advance() last saw them */
+static uint32_t         s_mode_limit_hz;    /* Fastest clock the mode allows, both modes' during a transition */
+static uint64_t         s_mode_transition_ps;   /* Time left of the mode transition under way */
+static uint32_t         s_mode_transitions;
+static uint32_t         s_mode_violations;
+static uint64_t         s_time_ps;          /* Time since reset */
+static uint64_t         s_time_remainder;   /* ICLK-scaled remainder of s_time_ps */
+
+static uint64_t         s_cycles;           /* ICLK cycles since reset */
+static uint64_t         s_pclkb_remainder;  /* ICLK-scaled PCLKB phase, see pclkb_advance() */
+static uint32_t         s_remainder_iclk;   /* ICLK the two remainders are scaled by */
+static uint64_t         s_cycle_limit;
+static uint64_t         s_delay_cycles;     /* ICLK cycles of the last software delay */
+static bool             s_delay_skip;       /* Software delays are counted but take no time */
+static uint64_t         s_sleep_cycles[2];  /* ICLK cycles in WAIT: [0] sleep mode, [1] software standby */
+static bool             s_standby;          /* In software standby: the CMT channels are not clocked */
+static uint32_t         s_wake_vector;      /* Simulated wake source, 0 when none is armed */
+static uint64_t         s_wake_at;
+static bool             s_running;
+static jmp_buf          s_run_env;
+
+/* Initial image of the firmware's initialized data, restored by _INITSCT() or R_INITSCT_Run() on every simulated
+   reset. The Makefile renames the firmware's .data/.bss sections so they can be found here. */
+extern uint8_t __start_rx_data[] __attribute__((weak));
+extern uint8_t __stop_rx_data[] __attribute__((weak));
+extern uint8_t __start_rx_bss[] __attribute__((weak));
+extern uint8_t __stop_rx_bss[] __attribute__((weak));
+static uint8_t *s_data_image;
+
+/* The RETAIN section of r_retain, which no simulated reset initializes. */
+extern uint8_t __start_rx_retain[] __attribute__((weak));
+extern uint8_t __stop_rx_retain[] __attribute__((weak));
+
+/* The C$DSEC and C$BSEC section tables of the host image, laid out like _DTBL and _BTBL in dbsct.c. */
+static struct
+{
+    uint8_t *rom_s;
+    uint8_t *rom_e;
+    uint8_t *ram_s;
+} s_dtbl[1];
+static struct
+{
+    uint8_t *b_s;
+    uint8_t *b_e;
+} s_btbl[1];
+
+/* Further section tables set by host_main.c, such as the C$ZSEC table of a zsect output, or one in place of a table
+   above. */
+static struct
+{
+    const char *name;
+    void       *top;
+    void       *end;
+} s_sections[RX_HOST_SECTIONS];
+
+static void     map_register_file(void);
+static void     set_reset_values(void);
+static void     advance_time(uint32_t cycles);
+static void     accept_interrupt(uint32_t vector, uint32_t level);
+static uint64_t pclkb_advance(uint32_t cycles);
+static void     osc_advance(uint64_t ps);
+static bool     osc_is_running(rx_host_osc_t osc);
+static bool     osc_is_stable(rx_host_osc_t osc);
+static void     osc_set_stable(rx_host_osc_t osc, bool stable);
+static void     mode_advance(uint64_t ps);
+static uint32_t mode_limit_hz(uint8_t opcm, uint8_t sopcm);
+static void     mode_read(rx_host_mode_t *p_mode);
+static void     cmt_advance(uint64_t pclkb);
+static void     tmr01_advance(uint64_t pclkb);
+static void     elc_event(uint32_t event, uint64_t count);
+static void     interrupt_request(uint32_t vector);
+static bool     dtc_is_linked(uint32_t vector);
+static void     dtc_activate(uint32_t vector);
+static uint32_t dtc_transfer(volatile uint32_t *p_info, bool *p_end);
+static uint32_t dtc_address(uint32_t address, uint32_t mode, int64_t step);
+static uint64_t cmt_cycles_to_match(const rx_host_cmt_t *p_cmt);
+static void     remainders_rescale(void);
+static bool     cmt_is_started(uint32_t channel);
+
+rx_host_cpu_t g_rx_host_cpu;
+uint32_t      g_rx_host_nop_cycles = 1;
+uint32_t      g_rx_host_access_cycles = 0;
+
+/***********************************************************************************************************************
+* Function Name: rx_host_reset
+* Description  : Maps the register file on first use and returns the MCU model to its power-on reset state.
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+void rx_host_reset(void)
+{
+    uint32_t i;
+
+    map_register_file();
+    set_reset_values();
+
+    memset(&g_rx_host_cpu, 0, sizeof(g_rx_host_cpu));
+    s_cycles = 0;
+    s_pclkb_remainder = 0;
+    s_remainder_iclk = 0;
+    s_time_ps = 0;
+    s_time_remainder = 0;
+    s_clock_violations = 0;
+    mode_read(&s_mode);
+    s_mode_limit_hz = mode_limit_hz(s_mode.opcm, s_mode.sopcm);
+    s_mode_transition_ps = 0;
+    s_mode_transitions = 0;
+    s_mode_violations = 0;
+    for (i = 0; i < RX_HOST_OSCS; i++)
+    {
+        s_osc[i].running_ps = 0;
+        if (0 != s_osc[i].delay_ps)
+        {
+            osc_set_stable((rx_host_osc_t)i, false);
+        }
+    }
+    s_accepted_total = 0;
+    s_current_vector = 0;
+    s_interrupt_depth = 0;
+    s_sleep_cycles[0] = 0;
+    s_sleep_cycles[1] = 0;
+    s_standby = false;
+    s_wake_vector = 0;
+
+    for (i = 0; i < RX_HOST_VECTOR_COUNT; i++)
+    {
+        s_vectors[i].accepted = 0;
+    }
+
+    s_cmt[0].regs = &CMT0;
+    s_cmt[1].regs = &CMT1;
+    s_cmt[2].regs = &CMT2;
+    s_cmt[3].regs = &CMT3;
+    for (i = 0; i < RX_HOST_CMT_CHANNELS; i++)
+    {
+        s_cmt[i].vector = VECT_CMT0_CMI0 + i;
+        s_cmt[i].prescale = 0;
+        s_cmt[i].counts = 0;
+        s_cmt[i].pclkb = 0;
+    }
+
+    s_tmr01_prescale = 0;
+    s_tmr01_matches = 0;
+    for (i = 0; i < RX_HOST_ELC_PORTS; i++)
+    {
+        s_elc_events[i] = 0;
+    }
+    s_dtc_activations = 0;
+}
+/***********************************************************************************************************************
+End of function rx_host_reset
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_reset_as
+* Description  : Resets the MCU model like rx_host_reset(), leaving the reset status registers as the given reset
+*                leaves them: a power-on reset clears RSTSR1.CWSF and sets RSTSR0.PORF only, the RES# pin clears
+*                RSTSR0 and RSTSR2, and every other reset adds its own flag to the ones still set.
+* Arguments    : cause -
+*                    Reset to simulate.
+* Return Value : none
+***********************************************************************************************************************/
+void rx_host_reset_as(rx_host_reset_t cause)
+{
+    uint8_t rstsr0;
+    uint8_t rstsr1;
+    uint8_t rstsr2;
+
+    map_register_file();
+    rstsr0 = SYSTEM.RSTSR0.BYTE;
+    rstsr1 = SYSTEM.RSTSR1.BYTE;
+    rstsr2 = SYSTEM.RSTSR2.BYTE;
+
+    rx_host_reset();
+    if (RX_HOST_RESET_POWER_ON == cause)
+    {
+        return;
+    }
+
+    SYSTEM.RSTSR0.BYTE = rstsr0;
+    SYSTEM.RSTSR1.BYTE = rstsr1;
+    SYSTEM.RSTSR2.BYTE = rstsr2;
+    switch (cause)
+    {
+        case RX_HOST_RESET_LVD0:
+            SYSTEM.RSTSR0.BIT.LVD0RF = 1;
+            break;
+        case RX_HOST_RESET_PIN:
+            SYSTEM.RSTSR0.BYTE = 0;
+            SYSTEM.RSTSR2.BYTE = 0;
+            break;
+        case RX_HOST_RESET_SOFTWARE:
+            SYSTEM.RSTSR2.BIT.SWRF = 1;
+            break;
+        case RX_HOST_RESET_WDT:
+            SYSTEM.RSTSR2.BIT.WDTRF = 1;
+            break;
+        default:
+            SYSTEM.RSTSR2.BIT.IWDTRF = 1;
+            break;
+    }
+}
+/***********************************************************************************************************************
+End of function rx_host_reset_as
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_run
+* Description  : Runs entry (normally PowerON_Reset_PC) until it returns, rx_host_stop() is called or the cycle budget
+*                is used up. A run that ends inside an interrupt service routine leaves the CPU in the state of the
+*                interrupted code, so that a following run continues from there.
+* Arguments    : entry -
+*                    Function to run.
+*                cycles -
+*                    ICLK cycle budget.
+* Return Value : ICLK cycles elapsed since reset.
+***********************************************************************************************************************/
+uint64_t rx_host_run(void (*entry)(void), uint64_t cycles)
+{
+    s_cycle_limit = s_cycles + cycles;
+    s_running = true;
+
+    if (0 == setjmp(s_run_env))
+    {
+        entry();
+    }
+    else if (0 != s_interrupt_depth)
+    {
+        g_rx_host_cpu.psw = s_thread_psw;
+        s_current_vector = 0;
+        s_interrupt_depth = 0;
+    }
+
+    s_running = false;
+    return s_cycles;
+}
+/***********************************************************************************************************************
+End of function rx_host_run
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_stop
+* Description  : Abandons the code started by rx_host_run() and returns to its caller.
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+void rx_host_stop(void)
+{
+    if (true == s_running)
+    {
+        longjmp(s_run_env, 1);
+    }
+
+    exit(EXIT_SUCCESS);
+}
+/***********************************************************************************************************************
+End of function rx_host_stop
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_cycles
+* Description  : Returns the ICLK cycles elapsed since reset.
+* Arguments    : none
+* Return Value : ICLK cycles.
+***********************************************************************************************************************/
+uint64_t rx_host_cycles(void)
+{
+    return s_cycles;
+}
+/***********************************************************************************************************************
+End of function rx_host_cycles
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_advance
+* Description  : Advances simulated time and accepts any interrupt that became pending.
+* Arguments    : cycles -
+*                    ICLK cycles executed by the caller.
+* Return Value : none
+***********************************************************************************************************************/
+void rx_host_advance(uint32_t cycles)
+{
+    advance_time(cycles);
+    rx_host_interrupt_poll();
+}
+/***********************************************************************************************************************
+End of function rx_host_advance
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_delay
+* Description  : Software delay loop of the BSP (delayWait()): advances simulated time by its cycles, in steps that
+*                fit rx_host_advance(), and records them for rx_host_delay_cycles().
+* Arguments    : cycles -
+*                    ICLK cycles of the loop.
+* Return Value : none
+***********************************************************************************************************************/
+void rx_host_delay(uint64_t cycles)
+{
+    s_delay_cycles = cycles;
+    if (true == s_delay_skip)
+    {
+        return;
+    }
+    for (; cycles > RX_HOST_DELAY_STEP_CYCLES; cycles -= RX_HOST_DELAY_STEP_CYCLES)
+    {
+        rx_host_advance(RX_HOST_DELAY_STEP_CYCLES);
+    }
+    rx_host_advance((uint32_t)cycles);
+}
+/***********************************************************************************************************************
+End of function rx_host_delay
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_delay_cycles
+* Description  : Returns the cycles of the last software delay loop and forgets them, so a delay that runs no loop
+*                reads as 0.
+* Arguments    : none
+* Return Value : ICLK cycles.
+***********************************************************************************************************************/
+uint64_t rx_host_delay_cycles(void)
+{
+    uint64_t cycles = s_delay_cycles;
+
+    s_delay_cycles = 0;
+    return cycles;
+}
+/***********************************************************************************************************************
+End of function rx_host_delay_cycles
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_delay_skip
+* Description  : Lets software delay loops be counted without taking simulated time, for checks of loop counts far
+*                longer than a run (2^32 loops at a 512 Hz ICLK is a year).
+* Arguments    : skip -
+*                    true to count only, false to let delays take their time.
+* Return Value : none
+***********************************************************************************************************************/
+void rx_host_delay_skip(bool skip)
+{
+    s_delay_skip = skip;
+}
+/***********************************************************************************************************************
+End of function rx_host_delay_skip
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_wait
+* Description  : WAIT instruction. Enables interrupts and skips simulated time forward to the next compare match or
+*                simulated wake-up until an interrupt has been accepted. With SBYCR.SSBY set the MCU is in software
+*                standby: the CMT channels neither count nor wake it.
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+void rx_host_wait(void)
+{
+    uint32_t accepted = s_accepted_total;
+    uint64_t next;
+    uint64_t cycles;
+    uint32_t mode = SYSTEM.SBYCR.BIT.SSBY;
+    uint32_t i;
+
+    g_rx_host_cpu.psw |= RX_HOST_PSW_I;
+    rx_host_interrupt_poll();
+
+    while (accepted == s_accepted_total)
+    {
+        next = (0 != s_wake_vector) ? (s_wake_at - s_cycles) : UINT64_MAX;
+        for (i = 0; (0 == mode) && (i < RX_HOST_CMT_CHANNELS); i++)
+        {
+            if ((true == cmt_is_started(i)) && (1 == s_cmt[i].regs->CMCR.BIT.CMIE))
+            {
+                cycles = cmt_cycles_to_match(&s_cmt[i]);
+                next = (cycles < next) ? cycles : next;
+            }
+        }
+
+        if (UINT64_MAX == next)
+        {
+            /* No wake-up source: the MCU would sleep forever. */
+            rx_host_stop();
+        }
+
+        /* Sleep no further than the end of the cycle budget. */
+        if ((true == s_running) && (next > (s_cycle_limit - s_cycles)))
+        {
+            next = s_cycle_limit - s_cycles;
+        }
+
+        s_standby = (1 == mode);
+        s_sleep_cycles[mode] += next;
+        while (next > UINT32_MAX)
+        {
+            advance_time(UINT32_MAX);
+            next -= UINT32_MAX;
+        }
+        advance_time((uint32_t)next);
+        s_standby = false;
+        rx_host_interrupt_poll();
+    }
+}
+/***********************************************************************************************************************
+End of function rx_host_wait
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_wake_source
+* Description  : Simulated wake-up source, such as an IRQ pin: sets the interrupt request of a vector after a delay,
+*                in any power mode. A new call replaces the previous one.
+* Arguments    : vector -
+*                    Vector number, or 0 to disarm.
+*                cycles -
+*                    ICLK cycles from now (at least 1).
+* Return Value : none
+***********************************************************************************************************************/
+void rx_host_wake_source(uint32_t vector, uint64_t cycles)
+{
+    s_wake_vector = vector;
+    s_wake_at = s_cycles + ((0 != cycles) ? cycles : 1U);
+}
+/***********************************************************************************************************************
+End of function rx_host_wake_source
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_sleep_cycles
+* Description  : Returns the ICLK cycles spent waiting in WAIT since reset, not counting the wake-up interrupt.
+* Arguments    : standby -
+*                    true for software standby, false for sleep mode.
+* Return Value : ICLK cycles.
+***********************************************************************************************************************/
+uint64_t rx_host_sleep_cycles(bool standby)
+{
+    return s_sleep_cycles[(true == standby) ? 1 : 0];
+}
+/***********************************************************************************************************************
+End of function rx_host_sleep_cycles
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_interrupt_poll
+* Description  : Accepts pending interrupts the way the ICU and CPU would at an instruction boundary: the request must
+*                be enabled in IER and its IPR must exceed PSW.IPL. The highest priority wins, the lowest vector number
+*                breaks ties.
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+void rx_host_interrupt_poll(void)
+{
+    uint32_t i;
+    uint32_t vector;
+    uint32_t level;
+    uint32_t best_vector;
+    uint32_t best_level;
+
+    while (0 != (g_rx_host_cpu.psw & RX_HOST_PSW_I))
+    {
+        best_vector = 0;
+        best_level = (g_rx_host_cpu.psw & RX_HOST_PSW_IPL_MASK) >> RX_HOST_PSW_IPL_SHIFT;
+
+        for (i = 0; i < s_vector_list_count; i++)
+        {
+            vector = s_vector_list[i];
+            if ((1 == ICU.IR[vector].BIT.IR) && (0 != (ICU.IER[vector >> 3].BYTE & (1U << (vector & 7)))))
+            {
+                level = (*s_vectors[vector].ipr) & 0x0FU;
+                if ((level > best_level) || ((level == best_level) && (0 != best_vector) && (vector < best_vector)))
+                {
+                    best_vector = vector;
+                    best_level = level;
+                }
+            }
+        }
+
+        if (0 == best_vector)
+        {
+            break;
+        }
+
+        accept_interrupt(best_vector, best_level);
+    }
+}
+/***********************************************************************************************************************
+End of function rx_host_interrupt_poll
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_clock_hz
+* Description  : Decodes a clock domain frequency from the current clock generator settings.
+* Arguments    : clock -
+*                    Clock domain.
+* Return Value : Frequency in Hz.
+***********************************************************************************************************************/
+uint32_t rx_host_clock_hz(rx_host_clock_t clock)
+{
+    uint64_t source;
+    uint32_t div;
+
+    switch (SYSTEM.SCKCR3.BIT.CKSEL)
+    {
+        case 1:
+            source = (3 == SYSTEM.HOCOCR2.BIT.HCFRQ) ? RX_HOST_HOCO_54MHZ : RX_HOST_HOCO_32MHZ;
+            break;
+        case 2:
+            source = BSP_CFG_XTAL_HZ;
+            break;
+        case 3:
+            source = RX_HOST_SUB_HZ;
+            break;
+        case 4:
+            /* PLL: input divided by 1, 2 or 4, multiplied by (STC + 1) / 2. */
+            source = ((uint64_t)BSP_CFG_XTAL_HZ >> SYSTEM.PLLCR.BIT.PLIDIV) * (SYSTEM.PLLCR.BIT.STC + 1U) / 2U;
+            break;
+        default:
+            source = RX_HOST_LOCO_HZ;
+            break;
+    }
+
+    switch (clock)
+    {
+        case RX_HOST_CLOCK_ICLK:
+            div = SYSTEM.SCKCR.BIT.ICK;
+            break;
+        case RX_HOST_CLOCK_PCLKA:
+            div = SYSTEM.SCKCR.BIT.PCKA;
+            break;
+        case RX_HOST_CLOCK_PCLKB:
+            div = SYSTEM.SCKCR.BIT.PCKB;
+            break;
+        case RX_HOST_CLOCK_PCLKD:
+            div = SYSTEM.SCKCR.BIT.PCKD;
+            break;
+        case RX_HOST_CLOCK_FCLK:
+            div = SYSTEM.SCKCR.BIT.FCK;
+            break;
+        default:
+            div = SYSTEM.SCKCR.BIT.BCK;
+            break;
+    }
+
+    return (uint32_t)(source >> div);
+}
+/***********************************************************************************************************************
+End of function rx_host_clock_hz
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_cmt_counts
+* Description  : Returns the count clocks a CMT channel has counted since reset, independent of CMCNT wrapping.
+* Arguments    : channel -
+*                    CMT channel (0 to 3).
+* Return Value : Count clocks.
+***********************************************************************************************************************/
+uint64_t rx_host_cmt_counts(uint32_t channel)
+{
+    return (channel < RX_HOST_CMT_CHANNELS) ? s_cmt[channel].counts : 0;
+}
+/***********************************************************************************************************************
+End of function rx_host_cmt_counts
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_cmt_pclkb
+* Description  : Returns the PCLKB cycles a CMT channel has been counting since reset. Unlike rx_host_cmt_counts(), it
+*                stays comparable across changes of CMCR.CKS.
+* Arguments    : channel -
+*                    CMT channel (0 to 3).
+* Return Value : PCLKB cycles.
+***********************************************************************************************************************/
+uint64_t rx_host_cmt_pclkb(uint32_t channel)
+{
+    return (channel < RX_HOST_CMT_CHANNELS) ? s_cmt[channel].pclkb : 0;
+}
+/***********************************************************************************************************************
+End of function rx_host_cmt_pclkb
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_tmr01_matches
+* Description  : Returns the 16-bit compare matches A of TMR0/TMR1 since reset.
+* Arguments    : none
+* Return Value : Compare matches.
+***********************************************************************************************************************/
+uint64_t rx_host_tmr01_matches(void)
+{
+    return s_tmr01_matches;
+}
+/***********************************************************************************************************************
+End of function rx_host_tmr01_matches
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_elc_events
+* Description  : Returns the events an ELC single port has acted on since reset.
+* Arguments    : port -
+*                    Single port (0 to 3).
+* Return Value : Events.
+***********************************************************************************************************************/
+uint64_t rx_host_elc_events(uint32_t port)
+{
+    return (port < RX_HOST_ELC_PORTS) ? s_elc_events[port] : 0;
+}
+/***********************************************************************************************************************
+End of function rx_host_elc_events
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_dtc_activations
+* Description  : Returns the DTC activations since reset; a chain of transfers counts once.
+* Arguments    : none
+* Return Value : Activations.
+***********************************************************************************************************************/
+uint64_t rx_host_dtc_activations(void)
+{
+    return s_dtc_activations;
+}
+/***********************************************************************************************************************
+End of function rx_host_dtc_activations
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_osc_delay
+* Description  : Sets the time an oscillator takes to stabilize after it is started; its OSCOVFSR flag stays 0 until
+*                then, and is 0 while it is stopped. The setting holds over resets. With 0, the default, the flag is 1
+*                at all times, which the BSP's busy-waits need: only nop(), wait(), the software delays and, with
+*                -a, register accesses let time pass.
+* Arguments    : osc -
+*                    Oscillator.
+*                us -
+*                    Stabilization time in microseconds, 0 for none.
+* Return Value : none
+***********************************************************************************************************************/
+void rx_host_osc_delay(rx_host_osc_t osc, uint32_t us)
+{
+    if ((uint32_t)osc < RX_HOST_OSCS)
+    {
+        s_osc[osc].delay_ps = (uint64_t)us * 1000000ULL;
+        s_osc[osc].running_ps = 0;
+        osc_set_stable(osc, (0U == us));
+    }
+}
+/***********************************************************************************************************************
+End of function rx_host_osc_delay
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_time_ns
+* Description  : Returns the time since reset, at the ICLK frequency of each cycle.
+* Arguments    : none
+* Return Value : Nanoseconds.
+***********************************************************************************************************************/
+uint64_t rx_host_time_ns(void)
+{
+    return s_time_ps / 1000U;
+}
+/***********************************************************************************************************************
+End of function rx_host_time_ns
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_clock_violations
+* Description  : Returns the number of times since reset that time passed with SCKCR3.CKSEL selecting an oscillator
+*                that had not stabilized, or with the PLL running from a main clock that had not.
+* Arguments    : none
+* Return Value : Count.
+***********************************************************************************************************************/
+uint32_t rx_host_clock_violations(void)
+{
+    return s_clock_violations;
+}
+/***********************************************************************************************************************
+End of function rx_host_clock_violations
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_mode_violations
+* Description  : Returns the number of operating mode rules broken since reset: a clock above what the operating mode
+*                allows (the slower of both modes during a transition), ICLK above 32 MHz without MEMWAIT, MEMWAIT
+*                changed outside high-speed operation, OPCCR changed in low-speed operation, and OPCCR, SOPCCR, MEMWAIT,
+*                SCKCR or SCKCR3 changed during a transition.
+* Arguments    : none
+* Return Value : Count.
+***********************************************************************************************************************/
+uint32_t rx_host_mode_violations(void)
+{
+    return s_mode_violations;
+}
+/***********************************************************************************************************************
+End of function rx_host_mode_violations
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_mode_transitions
+* Description  : Returns the number of operating mode transitions since reset.
+* Arguments    : none
+* Return Value : Count.
+***********************************************************************************************************************/
+uint32_t rx_host_mode_transitions(void)
+{
+    return s_mode_transitions;
+}
+/***********************************************************************************************************************
+End of function rx_host_mode_transitions
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_cmt_cycles_to_match
+* Description  : Returns the ICLK cycles until a CMT channel's next compare match.
+* Arguments    : channel -
+*                    CMT channel (0 to 3).
+* Return Value : ICLK cycles, UINT64_MAX if the channel is stopped.
+***********************************************************************************************************************/
+uint64_t rx_host_cmt_cycles_to_match(uint32_t channel)
+{
+    if ((channel >= RX_HOST_CMT_CHANNELS) || (false == cmt_is_started(channel)))
+    {
+        return UINT64_MAX;
+    }
+
+    return cmt_cycles_to_match(&s_cmt[channel]);
+}
+/***********************************************************************************************************************
+End of function rx_host_cmt_cycles_to_match
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_current_vector
+* Description  : Returns the vector of the interrupt being serviced.
+* Arguments    : none
+* Return Value : Vector number, or 0 outside interrupt service routines.
+***********************************************************************************************************************/
+uint32_t rx_host_current_vector(void)
+{
+    return s_current_vector;
+}
+/***********************************************************************************************************************
+End of function rx_host_current_vector
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_vector_register
+* Description  : Installs an interrupt service routine in the simulated relocatable vector table.
+* Arguments    : vector -
+*                    Vector number.
+*                ipr -
+*                    Interrupt priority register of the source.
+*                isr -
+*                    Interrupt service routine.
+* Return Value : none
+***********************************************************************************************************************/
+void rx_host_vector_register(uint32_t vector, volatile uint8_t *ipr, void (*isr)(void))
+{
+    if ((0 == vector) || (vector >= RX_HOST_VECTOR_COUNT) || (NULL != s_vectors[vector].isr))
+    {
+        fprintf(stderr, "rx_host: cannot register vector %u\n", (unsigned)vector);
+        abort();
+    }
+
+    s_vectors[vector].isr = isr;
+    s_vectors[vector].ipr = ipr;
+    s_vector_list[s_vector_list_count] = (uint8_t)vector;
+    s_vector_list_count++;
+}
+/***********************************************************************************************************************
+End of function rx_host_vector_register
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_vector_accepted
+* Description  : Returns how often an interrupt has been accepted since reset.
+* Arguments    : vector -
+*                    Vector number.
+* Return Value : Accepted interrupt count.
+***********************************************************************************************************************/
+uint32_t rx_host_vector_accepted(uint32_t vector)
+{
+    return (vector < RX_HOST_VECTOR_COUNT) ? s_vectors[vector].accepted : 0;
+}
+/***********************************************************************************************************************
+End of function rx_host_vector_accepted
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: _INITSCT
+* Description  : C runtime section initialization. Restores the firmware's initialized data to its load image and
+*                clears its uninitialized data, so every simulated reset starts from the same state.
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+void _INITSCT(void)
+{
+    memcpy(__start_rx_data, s_data_image, (size_t)(__stop_rx_data - __start_rx_data));
+    memset(__start_rx_bss, 0, (size_t)(__stop_rx_bss - __start_rx_bss));
+}
+/***********************************************************************************************************************
+End of function _INITSCT
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: _INIT_IOLIB
+* Description  : I/O library initialization. The host C library is already initialized.
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+void _INIT_IOLIB(void)
+{
+    /* Nothing to do on the host. */
+}
+/***********************************************************************************************************************
+End of function _INIT_IOLIB
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: _CLOSEALL
+* Description  : I/O library clean-up. The host C library closes its streams at exit.
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+void _CLOSEALL(void)
+{
+    /* Nothing to do on the host. */
+}
+/***********************************************************************************************************************
+End of function _CLOSEALL
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_sectop
+* Description  : __sectop() of the host build. Only the section tables have a host address.
+* Arguments    : name -
+*                    Section name.
+* Return Value : Start of the C$DSEC, C$BSEC or rx_host_section_set() table or of the RETAIN section, NULL for
+*                other sections.
+***********************************************************************************************************************/
+void *rx_host_sectop(const char *name)
+{
+    uint32_t i;
+
+    for (i = 0; i < RX_HOST_SECTIONS; i++)
+    {
+        if ((NULL != s_sections[i].name) && (0 == strcmp(name, s_sections[i].name)))
+        {
+            return s_sections[i].top;
+        }
+    }
+    if (0 == strcmp(name, "C$DSEC"))
+    {
+        return &s_dtbl[0];
+    }
+    if (0 == strcmp(name, "C$BSEC"))
+    {
+        return &s_btbl[0];
+    }
+    if (0 == strcmp(name, "BRETAIN"))
+    {
+        return __start_rx_retain;
+    }
+    return NULL;
+}
+/***********************************************************************************************************************
+End of function rx_host_sectop
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_secend
+* Description  : __secend() of the host build.
+* Arguments    : name -
+*                    Section name.
+* Return Value : End of the C$DSEC, C$BSEC or rx_host_section_set() table or of the RETAIN section, NULL for
+*                other sections.
+***********************************************************************************************************************/
+void *rx_host_secend(const char *name)
+{
+    uint32_t i;
+
+    for (i = 0; i < RX_HOST_SECTIONS; i++)
+    {
+        if ((NULL != s_sections[i].name) && (0 == strcmp(name, s_sections[i].name)))
+        {
+            return s_sections[i].end;
+        }
+    }
+    if (0 == strcmp(name, "C$DSEC"))
+    {
+        return &s_dtbl[1];
+    }
+    if (0 == strcmp(name, "C$BSEC"))
+    {
+        return &s_btbl[1];
+    }
+    if (0 == strcmp(name, "BRETAIN"))
+    {
+        return __stop_rx_retain;
+    }
+    return NULL;
+}
+/***********************************************************************************************************************
+End of function rx_host_secend
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_section_set
+* Description  : Gives a further section an address range for __sectop() and __secend(), in place of the one set
+*                before for that name and of a table of the host image; up to RX_HOST_SECTIONS of them.
+* Arguments    : name -
+*                    Section name (not copied), or NULL to remove every range.
+*                top -
+*                    Start of the section.
+*                end -
+*                    End of the section.
+* Return Value : none
+***********************************************************************************************************************/
+void rx_host_section_set(const char *name, void *top, void *end)
+{
+    uint32_t i;
+
+    for (i = 0; i < RX_HOST_SECTIONS; i++)
+    {
+        if ((NULL == name) || (NULL == s_sections[i].name) || (0 == strcmp(name, s_sections[i].name)))
+        {
+            s_sections[i].name = name;
+            s_sections[i].top = top;
+            s_sections[i].end = end;
+            if (NULL != name)
+            {
+                break;
+            }
+        }
+    }
+}
+/***********************************************************************************************************************
+End of function rx_host_section_set
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: save_data_image
+* Description  : Captures the firmware's initialized data before any firmware code has run, and describes it and the
+*                uninitialized data in the section tables.
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+static void __attribute__((constructor)) save_data_image(void)
+{
+    size_t size = (size_t)(__stop_rx_data - __start_rx_data);
+
+    s_data_image = malloc(size + 1);
+    if (NULL == s_data_image)
+    {
+        abort();
+    }
+    memcpy(s_data_image, __start_rx_data, size);
+
+    s_dtbl[0].rom_s = s_data_image;
+    s_dtbl[0].rom_e = s_data_image + size;
+    s_dtbl[0].ram_s = __start_rx_data;
+    s_btbl[0].b_s = __start_rx_bss;
+    s_btbl[0].b_e = __stop_rx_bss;
+}
+/***********************************************************************************************************************
+End of function save_data_image
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: map_register_file
+* Description  : Maps zero-filled memory at the RX231 peripheral register addresses (once).
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+static void map_register_file(void)
+{
+    static bool s_mapped = false;
+    uint32_t    i;
+    void        *p;
+
+    for (i = 0; (false == s_mapped) && (i < (sizeof(s_areas) / sizeof(s_areas[0]))); i++)
+    {
+        p = mmap((void *)s_areas[i].base, s_areas[i].size, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+        if (p != (void *)s_areas[i].base)
+        {
+            fprintf(stderr, "rx_host: cannot map register file at 0x%08lx (vm.mmap_min_addr?)\n",
+                    (unsigned long)s_areas[i].base);
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    s_mapped = true;
+}
+/***********************************************************************************************************************
+End of function map_register_file
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: set_reset_values
+* Description  : Clears the register file and loads the non-zero reset values the firmware depends on.
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+static void set_reset_values(void)
+{
+    uint32_t i;
+
+    for (i = 0; i < (sizeof(s_areas) / sizeof(s_areas[0])); i++)
+    {
+        memset((void *)s_areas[i].base, 0, s_areas[i].size);
+    }
+
+    /* Module stop: only DTC/DMAC, RAM and the data flash are running. */
+    SYSTEM.MSTPCRA.LONG = 0x47FFFFFFUL;
+    SYSTEM.MSTPCRB.LONG = 0xFFFFFFFFUL;
+    SYSTEM.MSTPCRC.LONG = 0xFFFFFFFFUL;
+    SYSTEM.MSTPCRD.LONG = 0xFFFFFFFFUL;
+
+    /* The main clock, sub-clock and PLLs are stopped, LOCO runs. */
+    SYSTEM.MOSCCR.BYTE = 0x01;
+    SYSTEM.SOSCCR.BYTE = 0x01;
+
+    /* The HOCO (OFS1.HOCOEN = 1) and both PLLs are stopped. */
+    SYSTEM.HOCOCR.BYTE = 0x01;
+    SYSTEM.PLLCR2.BYTE = 0x01;
+    SYSTEM.UPLLCR2.BYTE = 0x01;
+
+    /* Every oscillator is reported stable, unless rx_host_osc_delay() gave it a stabilization time. */
+    SYSTEM.OSCOVFSR.BIT.MOOVF = 1;
+    SYSTEM.OSCOVFSR.BIT.PLOVF = 1;
+    SYSTEM.OSCOVFSR.BIT.HCOVF = 1;
+    SYSTEM.OSCOVFSR.BIT.UPLOVF = 1;
+
+    MPC.PWPR.BYTE = 0x80;
+
+    /* Middle-speed operating mode. */
+    SYSTEM.OPCCR.BYTE = RX_HOST_OPCM_MIDDLE;
+
+    /* Power-on reset: RSTSR1.CWSF is 0 (cold start). */
+    SYSTEM.RSTSR0.BIT.PORF = 1;
+
+    CMT0.CMCOR = 0xFFFF;
+    CMT1.CMCOR = 0xFFFF;
+    CMT2.CMCOR = 0xFFFF;
+    CMT3.CMCOR = 0xFFFF;
+}
+/***********************************************************************************************************************
+End of function set_reset_values
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: advance_time
+* Description  : Advances the clock and the timers without accepting interrupts. Ends the run when the cycle budget
+*                is used up.
+* Arguments    : cycles -
+*                    ICLK cycles.
+* Return Value : none
+***********************************************************************************************************************/
+static void advance_time(uint32_t cycles)
+{
+    uint64_t          pclkb;
+    unsigned __int128 scaled;
+    uint32_t          iclk = rx_host_clock_hz(RX_HOST_CLOCK_ICLK);
+
+    remainders_rescale();
+    scaled = ((unsigned __int128)cycles * 1000000000000ULL) + s_time_remainder;
+
+    s_time_remainder = (uint64_t)(scaled % iclk);
+    s_time_ps += (uint64_t)(scaled / iclk);
+    osc_advance((uint64_t)(scaled / iclk));
+    mode_advance((uint64_t)(scaled / iclk));
+
+    s_cycles += cycles;
+    if (false == s_standby)
+    {
+        pclkb = pclkb_advance(cycles);
+        if (0 != pclkb)
+        {
+            cmt_advance(pclkb);
+            tmr01_advance(pclkb);
+        }
+    }
+
+    if ((0 != s_wake_vector) && (s_cycles >= s_wake_at))
+    {
+        interrupt_request(s_wake_vector);
+        s_wake_vector = 0;
+    }
+
+    if ((true == s_running) && (s_cycles >= s_cycle_limit))
+    {
+        longjmp(s_run_env, 1);
+    }
+}
+/***********************************************************************************************************************
+End of function advance_time
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: accept_interrupt
+* Description  : Interrupt acceptance and RTE: clears the edge-detected request, raises PSW.IPL to the request's
+*                priority with interrupts disabled, runs the handler and restores the PSW.
+* Arguments    : vector -
+*                    Vector number.
+*                level -
+*                    Priority of the request.
+* Return Value : none
+***********************************************************************************************************************/
+static void accept_interrupt(uint32_t vector, uint32_t level)
+{
+    uint32_t saved_psw = g_rx_host_cpu.psw;
+    uint32_t saved_vector = s_current_vector;
+
+    ICU.IR[vector].BIT.IR = 0;
+    s_vectors[vector].accepted++;
+    s_accepted_total++;
+
+    g_rx_host_cpu.psw = (saved_psw & ~(RX_HOST_PSW_I | RX_HOST_PSW_U | RX_HOST_PSW_PM | RX_HOST_PSW_IPL_MASK)) |
+                        (level << RX_HOST_PSW_IPL_SHIFT);
+    advance_time(RX_HOST_INT_ENTRY_CYCLES);
+
+    if (0 == s_interrupt_depth)
+    {
+        s_thread_psw = saved_psw;
+    }
+    s_interrupt_depth++;
+    s_current_vector = vector;
+    s_vectors[vector].isr();
+    s_current_vector = saved_vector;
+    s_interrupt_depth--;
+
+    advance_time(RX_HOST_INT_EXIT_CYCLES);
+    g_rx_host_cpu.psw = saved_psw;
+}
+/***********************************************************************************************************************
+End of function accept_interrupt
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: cmt_is_started
+* Description  : Returns whether a CMT channel is counting.
+* Arguments    : channel -
+*                    CMT channel (0 to 3).
+* Return Value : true when counting.
+***********************************************************************************************************************/
+static bool cmt_is_started(uint32_t channel)
+{
+    switch (channel)
+    {
+        case 0:
+            return (1 == CMT.CMSTR0.BIT.STR0);
+        case 1:
+            return (1 == CMT.CMSTR0.BIT.STR1);
+        case 2:
+            return (1 == CMT.CMSTR1.BIT.STR2);
+        default:
+            return (1 == CMT.CMSTR1.BIT.STR3);
+    }
+}
+/***********************************************************************************************************************
+End of function cmt_is_started
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: remainders_rescale
+* Description  : Keeps the time and PCLKB phases, which are scaled by ICLK, below one ICLK cycle after a clock change.
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+static void remainders_rescale(void)
+{
+    uint32_t iclk = rx_host_clock_hz(RX_HOST_CLOCK_ICLK);
+
+    if ((0 != s_remainder_iclk) && (iclk != s_remainder_iclk))
+    {
+        s_time_remainder = (uint64_t)(((unsigned __int128)s_time_remainder * iclk) / s_remainder_iclk);
+        s_pclkb_remainder = (uint64_t)(((unsigned __int128)s_pclkb_remainder * iclk) / s_remainder_iclk);
+    }
+    s_remainder_iclk = iclk;
+}
+/***********************************************************************************************************************
+End of function remainders_rescale
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: pclkb_advance
+* Description  : Converts elapsed ICLK cycles to PCLKB cycles, keeping the phase between calls.
+* Arguments    : cycles -
+*                    ICLK cycles.
+* Return Value : PCLKB cycles.
+***********************************************************************************************************************/
+static uint64_t pclkb_advance(uint32_t cycles)
+{
+    uint32_t iclk = rx_host_clock_hz(RX_HOST_CLOCK_ICLK);
+    uint64_t phase = ((uint64_t)cycles * rx_host_clock_hz(RX_HOST_CLOCK_PCLKB)) + s_pclkb_remainder;
+
+    s_pclkb_remainder = phase % iclk;
+    return phase / iclk;
+}
+/***********************************************************************************************************************
+End of function pclkb_advance
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: osc_advance
+* Description  : Runs the oscillators with a stabilization time and checks the clock selection against them.
+* Arguments    : ps -
+*                    Time passed, in picoseconds.
+* Return Value : none
+***********************************************************************************************************************/
+static void osc_advance(uint64_t ps)
+{
+    uint32_t i;
+    uint32_t cksel;
+
+    for (i = 0; i < RX_HOST_OSCS; i++)
+    {
+        if (0 == s_osc[i].delay_ps)
+        {
+            continue;
+        }
+        if (false == osc_is_running((rx_host_osc_t)i))
+        {
+            s_osc[i].running_ps = 0;
+            osc_set_stable((rx_host_osc_t)i, false);
+            continue;
+        }
+        s_osc[i].running_ps += ps;
+        osc_set_stable((rx_host_osc_t)i, (s_osc[i].running_ps >= s_osc[i].delay_ps));
+    }
+
+    /* The checks apply to the time that has just passed, so they use the state before it. */
+    cksel = SYSTEM.SCKCR3.BIT.CKSEL;
+    if (((RX_HOST_CKSEL_HOCO == cksel) && (false == osc_is_stable(RX_HOST_OSC_HOCO))) ||
+        ((RX_HOST_CKSEL_MAIN == cksel) && (false == osc_is_stable(RX_HOST_OSC_MAIN))) ||
+        ((RX_HOST_CKSEL_PLL == cksel) && (false == osc_is_stable(RX_HOST_OSC_PLL))) ||
+        ((true == osc_is_running(RX_HOST_OSC_PLL)) && (false == osc_is_stable(RX_HOST_OSC_MAIN))))
+    {
+        s_clock_violations++;
+    }
+}
+/***********************************************************************************************************************
+End of function osc_advance
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: osc_is_running
+* Description  : Reads the start/stop bit of an oscillator.
+* Arguments    : osc -
+*                    Oscillator.
+* Return Value : true if it is started.
+***********************************************************************************************************************/
+static bool osc_is_running(rx_host_osc_t osc)
+{
+    switch (osc)
+    {
+        case RX_HOST_OSC_MAIN:
+            return (0 == SYSTEM.MOSCCR.BIT.MOSTP);
+        case RX_HOST_OSC_PLL:
+            return (0 == SYSTEM.PLLCR2.BIT.PLLEN);
+        case RX_HOST_OSC_HOCO:
+            return (0 == SYSTEM.HOCOCR.BIT.HCSTP);
+        default:
+            return (0 == SYSTEM.UPLLCR2.BIT.UPLLEN);
+    }
+}
+/***********************************************************************************************************************
+End of function osc_is_running
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: osc_is_stable
+* Description  : Reads the OSCOVFSR flag of an oscillator.
+* Arguments    : osc -
+*                    Oscillator.
+* Return Value : true if the flag is 1.
+***********************************************************************************************************************/
+static bool osc_is_stable(rx_host_osc_t osc)
+{
+    switch (osc)
+    {
+        case RX_HOST_OSC_MAIN:
+            return (1 == SYSTEM.OSCOVFSR.BIT.MOOVF);
+        case RX_HOST_OSC_PLL:
+            return (1 == SYSTEM.OSCOVFSR.BIT.PLOVF);
+        case RX_HOST_OSC_HOCO:
+            return (1 == SYSTEM.OSCOVFSR.BIT.HCOVF);
+        default:
+            return (1 == SYSTEM.OSCOVFSR.BIT.UPLOVF);
+    }
+}
+/***********************************************************************************************************************
+End of function osc_is_stable
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: osc_set_stable
+* Description  : Writes the OSCOVFSR flag of an oscillator.
+* Arguments    : osc -
+*                    Oscillator.
+*                stable -
+*                    Flag value.
+* Return Value : none
+***********************************************************************************************************************/
+static void osc_set_stable(rx_host_osc_t osc, bool stable)
+{
+    switch (osc)
+    {
+        case RX_HOST_OSC_MAIN:
+            SYSTEM.OSCOVFSR.BIT.MOOVF = stable;
+            break;
+        case RX_HOST_OSC_PLL:
+            SYSTEM.OSCOVFSR.BIT.PLOVF = stable;
+            break;
+        case RX_HOST_OSC_HOCO:
+            SYSTEM.OSCOVFSR.BIT.HCOVF = stable;
+            break;
+        default:
+            SYSTEM.OSCOVFSR.BIT.UPLOVF = stable;
+            break;
+    }
+}
+/***********************************************************************************************************************
+End of function osc_set_stable
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: mode_advance
+* Description  : Runs the operating mode transition and checks the mode, the flash wait states and the clock against
+*                each other. Like osc_advance(), it sees the registers as they were through the time that has just
+*                passed, and each change once.
+* Arguments    : ps -
+*                    Time passed, in picoseconds.
+* Return Value : none
+***********************************************************************************************************************/
+static void mode_advance(uint64_t ps)
+{
+    rx_host_mode_t now;
+    uint32_t       fastest = 0;
+    uint32_t       hz;
+    uint32_t       limit;
+    uint32_t       i;
+    bool           mode_changed;
+    bool           clock_changed;
+
+    mode_read(&now);
+    if (0 != memcmp(&now, &s_mode, sizeof(now)))
+    {
+        mode_changed = ((now.opcm != s_mode.opcm) || (now.sopcm != s_mode.sopcm));
+        clock_changed = ((now.sckcr != s_mode.sckcr) || (now.cksel != s_mode.cksel));
+        if ((0 != s_mode_transition_ps) &&
+            ((true == mode_changed) || (true == clock_changed) || (now.memwait != s_mode.memwait)))
+        {
+            s_mode_violations++;
+        }
+
+        /* SOPCM first out of low-speed operation; MEMWAIT before leaving high-speed operation or after entering it. */
+        if (((now.opcm != s_mode.opcm) && (RX_HOST_SOPCM_LOW == s_mode.sopcm) && (RX_HOST_SOPCM_LOW == now.sopcm)) ||
+            ((now.memwait != s_mode.memwait) && ((RX_HOST_OPCM_HIGH != now.opcm) || (0 != now.sopcm)) &&
+             ((RX_HOST_OPCM_HIGH != s_mode.opcm) || (0 != s_mode.sopcm))))
+        {
+            s_mode_violations++;
+        }
+
+        limit = mode_limit_hz(now.opcm, now.sopcm);
+        if (true == mode_changed)
+        {
+            /* Until the transition ends, the clock must suit both modes; a clock changed at the same time is taken
+               as changed after it. */
+            s_mode_limit_hz = mode_limit_hz(s_mode.opcm, s_mode.sopcm);
+            s_mode_limit_hz = ((limit < s_mode_limit_hz) || (true == clock_changed)) ? limit : s_mode_limit_hz;
+            s_mode_transition_ps = RX_HOST_MODE_TRANSITION_PS;
+            s_mode_transitions++;
+            SYSTEM.OPCCR.BIT.OPCMTSF = (now.opcm != s_mode.opcm) ? 1 : SYSTEM.OPCCR.BIT.OPCMTSF;
+            SYSTEM.SOPCCR.BIT.SOPCMTSF = (now.sopcm != s_mode.sopcm) ? 1 : SYSTEM.SOPCCR.BIT.SOPCMTSF;
+        }
+        else if (0 == s_mode_transition_ps)
+        {
+            s_mode_limit_hz = limit;
+        }
+
+        for (i = RX_HOST_CLOCK_ICLK; i <= RX_HOST_CLOCK_BCLK; i++)
+        {
+            hz = rx_host_clock_hz((rx_host_clock_t)i);
+            fastest = (hz > fastest) ? hz : fastest;
+        }
+        if ((fastest > s_mode_limit_hz) ||
+            ((0 == now.memwait) && (rx_host_clock_hz(RX_HOST_CLOCK_ICLK) > BSP_MEMORY_NO_WAIT_MAX_FREQUENCY)))
+        {
+            s_mode_violations++;
+        }
+        s_mode = now;
+    }
+
+    if (0 != s_mode_transition_ps)
+    {
+        s_mode_transition_ps = (s_mode_transition_ps > ps) ? (s_mode_transition_ps - ps) : 0;
+        if (0 == s_mode_transition_ps)
+        {
+            SYSTEM.OPCCR.BIT.OPCMTSF = 0;
+            SYSTEM.SOPCCR.BIT.SOPCMTSF = 0;
+            s_mode_limit_hz = mode_limit_hz(s_mode.opcm, s_mode.sopcm);
+        }
+    }
+}
+/***********************************************************************************************************************
+End of function mode_advance
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: mode_limit_hz
+* Description  : Returns the fastest clock an operating mode allows.
+* Arguments    : opcm -
+*                    OPCCR.OPCM.
+*                sopcm -
+*                    SOPCCR.SOPCM.
+* Return Value : Frequency in Hz.
+***********************************************************************************************************************/
+static uint32_t mode_limit_hz(uint8_t opcm, uint8_t sopcm)
+{
+    if (RX_HOST_SOPCM_LOW == sopcm)
+    {
+        return RX_HOST_SUB_HZ;
+    }
+
+    return (RX_HOST_OPCM_HIGH == opcm) ? RX_HOST_HIGH_SPEED_HZ : BSP_MIDDLE_SPEED_MAX_FREQUENCY;
+}
+/***********************************************************************************************************************
+End of function mode_limit_hz
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: mode_read
+* Description  : Reads the registers mode_advance() follows.
+* Arguments    : p_mode -
+*                    Receives them.
+* Return Value : none
+***********************************************************************************************************************/
+static void mode_read(rx_host_mode_t *p_mode)
+{
+    memset(p_mode, 0, sizeof(*p_mode));
+    p_mode->opcm = SYSTEM.OPCCR.BIT.OPCM;
+    p_mode->sopcm = SYSTEM.SOPCCR.BIT.SOPCM;
+    p_mode->memwait = SYSTEM.MEMWAIT.BIT.MEMWAIT;
+    p_mode->cksel = SYSTEM.SCKCR3.BIT.CKSEL;
+    p_mode->sckcr = SYSTEM.SCKCR.LONG;
+}
+/***********************************************************************************************************************
+End of function mode_read
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: cmt_advance
+* Description  : Clocks the running CMT channels. CMCNT counts up to CMCOR and the following count clears it to 0 with
+*                a compare match; a counter above CMCOR runs to 0xFFFF and wraps first. Compare matches that activate
+*                the DTC are taken one at a time, as each transfer may rewrite CMCOR.
+* Arguments    : pclkb -
+*                    PCLKB cycles.
+* Return Value : none
+***********************************************************************************************************************/
+static void cmt_advance(uint64_t pclkb)
+{
+    uint64_t counts;
+    uint64_t to_match;
+    uint32_t shift;
+    uint32_t cor;
+    uint32_t cnt;
+    uint32_t i;
+
+    for (i = 0; i < RX_HOST_CMT_CHANNELS; i++)
+    {
+        if (false == cmt_is_started(i))
+        {
+            continue;
+        }
+
+        s_cmt[i].pclkb += pclkb;
+
+        /* Count clock is PCLK/8, /32, /128 or /512. */
+        shift = 3U + (2U * s_cmt[i].regs->CMCR.BIT.CKS);
+        s_cmt[i].prescale &= (1U << shift) - 1U;   /* A faster count clock keeps only its part of the phase */
+        counts = (pclkb + s_cmt[i].prescale) >> shift;
+        s_cmt[i].prescale = (uint32_t)((pclkb + s_cmt[i].prescale) & ((1U << shift) - 1U));
+        if (0 == counts)
+        {
+            continue;
+        }
+
+        cnt = s_cmt[i].regs->CMCNT;
+        cor = s_cmt[i].regs->CMCOR;
+        to_match = (cnt <= cor) ? ((cor - cnt) + 1U) : ((0x10000U - cnt) + cor + 1U);
+        if (counts < to_match)
+        {
+            s_cmt[i].counts += counts;
+            s_cmt[i].regs->CMCNT = (uint16_t)(cnt + counts);
+            continue;
+        }
+
+        s_cmt[i].counts += counts;
+        if ((1 == s_cmt[i].regs->CMCR.BIT.CMIE) && (true == dtc_is_linked(s_cmt[i].vector)))
+        {
+            do
+            {
+                counts -= to_match;
+                s_cmt[i].regs->CMCNT = 0;
+                interrupt_request(s_cmt[i].vector);
+                to_match = (uint64_t)s_cmt[i].regs->CMCOR + 1U;
+            } while (counts >= to_match);
+            s_cmt[i].regs->CMCNT = (uint16_t)counts;
+            continue;
+        }
+
+        s_cmt[i].regs->CMCNT = (uint16_t)((counts - to_match) % (cor + 1U));
+        if (1 == s_cmt[i].regs->CMCR.BIT.CMIE)
+        {
+            interrupt_request(s_cmt[i].vector);
+        }
+    }
+}
+/***********************************************************************************************************************
+End of function cmt_advance
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: tmr01_advance
+* Description  : Clocks TMR0/TMR1 in 16-bit count mode (TMR0.TCCR counting TMR1 overflows, TMR1.TCCR on an internal
+*                clock). The counter clears after matching TCORA when TMR0.TCR.CCLR selects it and runs through
+*                0xFFFF otherwise; each match sets CMIA0 if enabled and is sent to the ELC.
+* Arguments    : pclkb -
+*                    PCLKB cycles.
+* Return Value : none
+***********************************************************************************************************************/
+static void tmr01_advance(uint64_t pclkb)
+{
+    static const uint16_t s_divisors[] = { 1U, 2U, 8U, 32U, 64U, 1024U, 8192U };
+    uint64_t counts;
+    uint64_t to_match;
+    uint64_t matches;
+    uint32_t divisor;
+    uint32_t cnt;
+    uint32_t cor;
+
+    if ((3 != TMR0.TCCR.BIT.CSS) || (0 != TMR0.TCCR.BIT.CKS) || (1 != TMR1.TCCR.BIT.CSS) || (TMR1.TCCR.BIT.CKS > 6))
+    {
+        return;
+    }
+
+    divisor = s_divisors[TMR1.TCCR.BIT.CKS];
+    counts = (pclkb + s_tmr01_prescale) / divisor;
+    s_tmr01_prescale = (uint32_t)((pclkb + s_tmr01_prescale) % divisor);
+    if (0 == counts)
+    {
+        return;
+    }
+
+    cnt = ((uint32_t)TMR0.TCNT << 8) | TMR1.TCNT;
+    cor = ((uint32_t)TMR0.TCORA << 8) | TMR1.TCORA;
+    to_match = (cnt <= cor) ? ((cor - cnt) + 1U) : ((0x10000U - cnt) + cor + 1U);
+    if (counts < to_match)
+    {
+        cnt += (uint32_t)counts;
+        matches = 0;
+    }
+    else if (1 == TMR0.TCR.BIT.CCLR)
+    {
+        matches = 1U + ((counts - to_match) / (cor + 1U));
+        cnt = (uint32_t)((counts - to_match) % (cor + 1U));
+    }
+    else
+    {
+        matches = 1U + ((counts - to_match) >> 16);
+        cnt = (uint32_t)((cnt + counts) & 0xFFFFU);
+    }
+    TMR0.TCNT = (uint8_t)(cnt >> 8);
+    TMR1.TCNT = (uint8_t)cnt;
+
+    if (0 != matches)
+    {
+        s_tmr01_matches += matches;
+        if (1 == TMR0.TCR.BIT.CMIEA)
+        {
+            interrupt_request(VECT_TMR0_CMIA0);
+        }
+        elc_event(RX_HOST_ELC_TMR0_CMIA0, matches);
+    }
+}
+/***********************************************************************************************************************
+End of function tmr01_advance
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: elc_event
+* Description  : Delivers an event to the ELC single ports linked to it: PELn.PSP selects PORTB or PORTE, PSB the bit
+*                and PSM whether the output is set low, set high or toggled.
+* Arguments    : event -
+*                    ELC event number.
+*                count -
+*                    Number of events since the last call.
+* Return Value : none
+***********************************************************************************************************************/
+static void elc_event(uint32_t event, uint64_t count)
+{
+    volatile uint8_t *p_podr;
+    uint32_t         elsr;
+    uint32_t         port;
+    uint8_t          pel;
+    uint8_t          bit;
+
+    if (0 == ELC.ELCR.BIT.ELCON)
+    {
+        return;
+    }
+
+    for (elsr = 0; elsr < RX_HOST_ELC_ELSR_COUNT; elsr++)
+    {
+        if ((s_elc_destinations[elsr] < RX_HOST_ELC_DEST_PORT0) || (event != ELC.ELSR[elsr].BYTE))
+        {
+            continue;
+        }
+        port = s_elc_destinations[elsr] - RX_HOST_ELC_DEST_PORT0;
+
+        pel = (&ELC.PEL0.BYTE)[port];
+        p_podr = (1U == ((pel >> 3) & 3U)) ? &PORTB.PODR.BYTE : ((2U == ((pel >> 3) & 3U)) ? &PORTE.PODR.BYTE : NULL);
+        if (NULL == p_podr)
+        {
+            continue;
+        }
+
+        s_elc_events[port] += count;
+        bit = (uint8_t)(1U << (pel & 7U));
+        switch ((pel >> 5) & 3U)
+        {
+            case 0:
+                *p_podr &= (uint8_t)~bit;
+                break;
+            case 1:
+                *p_podr |= bit;
+                break;
+            case 2:
+                *p_podr ^= (uint8_t)((0U != (count & 1U)) ? bit : 0U);
+                break;
+            default:
+                break;
+        }
+    }
+}
+/***********************************************************************************************************************
+End of function elc_event
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: cmt_cycles_to_match
+* Description  : Returns the ICLK cycles until a running CMT channel's next compare match.
+* Arguments    : p_cmt -
+*                    CMT channel.
+* Return Value : ICLK cycles (at least 1).
+***********************************************************************************************************************/
+static uint64_t cmt_cycles_to_match(const rx_host_cmt_t *p_cmt)
+{
+    uint32_t cnt = p_cmt->regs->CMCNT;
+    uint32_t cor = p_cmt->regs->CMCOR;
+    uint32_t shift = 3U + (2U * p_cmt->regs->CMCR.BIT.CKS);
+    uint64_t counts = (cnt <= cor) ? ((cor - cnt) + 1U) : ((0x10000U - cnt) + cor + 1U);
+    uint64_t pclkb = (counts << shift) - (p_cmt->prescale & ((1U << shift) - 1U));
+    uint64_t phase;
+    uint64_t pclkb_hz = rx_host_clock_hz(RX_HOST_CLOCK_PCLKB);
+
+    remainders_rescale();
+    phase = (pclkb * rx_host_clock_hz(RX_HOST_CLOCK_ICLK)) - s_pclkb_remainder;
+
+    return ((phase + pclkb_hz) - 1U) / pclkb_hz;
+}
+/***********************************************************************************************************************
+End of function cmt_cycles_to_match
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: interrupt_request
+* Description  : Raises an interrupt request: it activates the DTC when DTCER selects it, and sets IR otherwise.
+* Arguments    : vector -
+*                    Vector number.
+* Return Value : none
+***********************************************************************************************************************/
+static void interrupt_request(uint32_t vector)
+{
+    if (true == dtc_is_linked(vector))
+    {
+        dtc_activate(vector);
+    }
+    else
+    {
+        ICU.IR[vector].BIT.IR = 1;
+    }
+}
+/***********************************************************************************************************************
+End of function interrupt_request
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: dtc_is_linked
+* Description  : Returns whether an interrupt request of a vector activates the DTC: the DTC is started, and the
+*                request is enabled in IER and selected in DTCER.
+* Arguments    : vector -
+*                    Vector number.
+* Return Value : true when the request activates the DTC.
+***********************************************************************************************************************/
+static bool dtc_is_linked(uint32_t vector)
+{
+    return ((vector < RX_HOST_DTC_VECTORS) && (1 == DTC.DTCST.BIT.DTCST) && (1 == ICU.DTCER[vector].BIT.DTCE) &&
+            (0 != (ICU.IER[vector >> 3].BYTE & (1U << (vector & 7)))));
+}
+/***********************************************************************************************************************
+End of function dtc_is_linked
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: dtc_activate
+* Description  : DTC activation: runs the transfer information chain the vector table entry at DTCVBR points to. At
+*                the end of a normal or block transfer DTCER is cleared and the CPU is interrupted, and with MRB.DISEL
+*                it is interrupted after every transfer. The low 10 bits of DTCVBR are ignored, as the hardware does.
+* Arguments    : vector -
+*                    Vector number.
+* Return Value : none
+***********************************************************************************************************************/
+static void dtc_activate(uint32_t vector)
+{
+    volatile uint32_t *p_info = (volatile uint32_t *)(uintptr_t)(*(volatile uint32_t *)(uintptr_t)
+                                                                 ((DTC.DTCVBR & RX_HOST_DTC_VBR_MASK) +
+                                                                  (vector * 4U)));
+    uint32_t          mrb;
+    bool              end;
+    bool              request = false;
+
+    s_dtc_activations++;
+    do
+    {
+        mrb = dtc_transfer(p_info, &end);
+        if (true == end)
+        {
+            ICU.DTCER[vector].BIT.DTCE = 0;
+        }
+        request = request || end || (0 != (mrb & RX_HOST_DTC_MRB_DISEL));
+        p_info += 4;
+    } while ((0 != (mrb & RX_HOST_DTC_MRB_CHNE)) && ((0 == (mrb & RX_HOST_DTC_MRB_CHNS)) || (true == end)));
+
+    if (true == request)
+    {
+        ICU.IR[vector].BIT.IR = 1;
+    }
+}
+/***********************************************************************************************************************
+End of function dtc_activate
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: dtc_transfer
+* Description  : Performs one transfer of a full-address mode transfer information entry and writes SAR, DAR and the
+*                counters back: one data unit in normal and repeat mode, one block in block mode. The repeat or block
+*                area address returns to its start when the repeat size or block size has been transferred.
+* Arguments    : p_info -
+*                    Transfer information: MRA << 24 | MRB << 16, SAR, DAR, CRA << 16 | CRB.
+*                p_end -
+*                    Set when the transfer counter reached 0 (always false in repeat mode, where it is reloaded).
+* Return Value : MRB.
+***********************************************************************************************************************/
+static uint32_t dtc_transfer(volatile uint32_t *p_info, bool *p_end)
+{
+    uint32_t mra = p_info[0] >> 24;
+    uint32_t mrb = (p_info[0] >> 16) & 0xFFU;
+    uint32_t sar = p_info[1];
+    uint32_t dar = p_info[2];
+    uint32_t cra = p_info[3] >> 16;
+    uint32_t crb = p_info[3] & 0xFFFFU;
+    uint32_t md = (mra >> 6) & 3U;
+    uint32_t size = 1U << ((mra >> 4) & 3U);
+    uint32_t area = (0U == (cra >> 8)) ? 256U : (cra >> 8);
+    uint32_t units = (RX_HOST_DTC_MD_BLOCK == md) ? area : 1U;
+    uint32_t i;
+    bool     restore;
+
+    for (i = 0; i < units; i++)
+    {
+        switch (size)
+        {
+            case 1:
+                *(volatile uint8_t *)(uintptr_t)dar = *(volatile uint8_t *)(uintptr_t)sar;
+                break;
+            case 2:
+                *(volatile uint16_t *)(uintptr_t)dar = *(volatile uint16_t *)(uintptr_t)sar;
+                break;
+            default:
+                *(volatile uint32_t *)(uintptr_t)dar = *(volatile uint32_t *)(uintptr_t)sar;
+                break;
+        }
+        sar = dtc_address(sar, mra >> 2, size);
+        dar = dtc_address(dar, mrb >> 2, size);
+    }
+
+    switch (md)
+    {
+        case RX_HOST_DTC_MD_REPEAT:
+            cra = (cra & 0xFF00U) | ((cra - 1U) & 0xFFU);
+            restore = (0U == (cra & 0xFFU));
+            if (true == restore)
+            {
+                cra |= cra >> 8;
+            }
+            *p_end = false;
+            break;
+        case RX_HOST_DTC_MD_BLOCK:
+            restore = true;
+            crb = (crb - 1U) & 0xFFFFU;
+            *p_end = (0U == crb);
+            break;
+        default:
+            restore = false;
+            cra = (cra - 1U) & 0xFFFFU;
+            *p_end = (0U == cra);
+            break;
+    }
+
+    if (true == restore)
+    {
+        if (0 != (mrb & RX_HOST_DTC_MRB_DTS))
+        {
+            sar = dtc_address(sar, mra >> 2, -(int64_t)area * size);
+        }
+        else
+        {
+            dar = dtc_address(dar, mrb >> 2, -(int64_t)area * size);
+        }
+    }
+
+    p_info[1] = sar;
+    p_info[2] = dar;
+    p_info[3] = (cra << 16) | crb;
+    return mrb;
+}
+/***********************************************************************************************************************
+End of function dtc_transfer
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: dtc_address
+* Description  : Moves a transfer address as its addressing mode (MRA.SM or MRB.DM) says: fixed, incremented or
+*                decremented.
+* Arguments    : address -
+*                    Address.
+*                mode -
+*                    Addressing mode in bits 1-0: 0x fixed, 10 increment, 11 decrement.
+*                step -
+*                    Bytes to move by when incrementing; the address moves the other way when decrementing.
+* Return Value : New address.
+***********************************************************************************************************************/
+static uint32_t dtc_address(uint32_t address, uint32_t mode, int64_t step)
+{
+    switch (mode & 3U)
+    {
+        case 2:
+            return (uint32_t)(address + step);
+        case 3:
+            return (uint32_t)(address - step);
+        default:
+            return address;
+    }
+}
+/***********************************************************************************************************************
+End of function dtc_address
+***********************************************************************************************************************/
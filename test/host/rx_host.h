@@ -0,0 +1,155 @@
+/***********************************************************************
+*
+*  FILE        : rx_host.h
+*  DESCRIPTION : Host (Linux/gcc) model of the RX231 used to build and
+*                run the smc_gen BSP and application off target.
+*
+*  NOTE: The peripheral register file is mapped at the real RX231
+*        peripheral addresses, so iodefine.h accessors work unchanged.
+*        Simulated time advances only at nop(), wait() and software
+*        delay calls; interrupts are accepted at those points. wait()
+*        honours SBYCR.SSBY: in software standby the CMT channels stop.
+*
+***********************************************************************/
+
+#ifndef RX_HOST_H
+#define RX_HOST_H
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* PSW bits used by the CPU model. */
+#define RX_HOST_PSW_I           (0x00010000UL)      /* Interrupt enable */
+#define RX_HOST_PSW_U           (0x00020000UL)      /* Stack pointer select */
+#define RX_HOST_PSW_PM          (0x00100000UL)      /* Processor mode */
+#define RX_HOST_PSW_IPL_SHIFT   (24)
+#define RX_HOST_PSW_IPL_MASK    (0x0F000000UL)
+
+/* Peripheral I/O areas of the RX231 address space backed by the host register file. */
+#define RX_HOST_IO_BASE         (0x00080000UL)      /* Peripheral I/O registers */
+#define RX_HOST_IO_SIZE         (0x00080000UL)
+#define RX_HOST_FLASH_IO_BASE   (0x007FC000UL)      /* Flash I/O registers and unique ID */
+#define RX_HOST_FLASH_IO_SIZE   (0x00004000UL)
+
+/* True when address lies in the host register file. */
+#define RX_HOST_IS_REGISTER(address)                                                                \
+    ((((uintptr_t)(address) - RX_HOST_IO_BASE) < RX_HOST_IO_SIZE) ||                               \
+     (((uintptr_t)(address) - RX_HOST_FLASH_IO_BASE) < RX_HOST_FLASH_IO_SIZE))
+
+/* Approximate CPU cycles charged for interrupt acceptance and RTE. */
+#define RX_HOST_INT_ENTRY_CYCLES    (7)
+#define RX_HOST_INT_EXIT_CYCLES     (6)
+
+/* Number of vectors in the relocatable vector table. */
+#define RX_HOST_VECTOR_COUNT    (256)
+
+/* Register an interrupt service routine for vector VECT(x,y), the host equivalent of
+   '#pragma interrupt isr(vect=VECT(x,y))'. Use at file scope in the translation unit that defines the ISR. */
+#define RX_HOST_INTERRUPT(x, y, isr)                                                                \
+    static void __attribute__((constructor)) rx_host_vect_ ## x ## _ ## y (void)                    \
+    {                                                                                               \
+        rx_host_vector_register(VECT_ ## x ## _ ## y, &ICU.IPR[IPR_ ## x ## _ ## y].BYTE, (isr));   \
+    }
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+/* Clock domains decoded from the SYSTEM clock registers. */
+typedef enum
+{
+    RX_HOST_CLOCK_ICLK = 0,
+    RX_HOST_CLOCK_PCLKA,
+    RX_HOST_CLOCK_PCLKB,
+    RX_HOST_CLOCK_PCLKD,
+    RX_HOST_CLOCK_FCLK,
+    RX_HOST_CLOCK_BCLK
+} rx_host_clock_t;
+
+/* Oscillators with a stabilization flag in OSCOVFSR, for rx_host_osc_delay(). */
+typedef enum
+{
+    RX_HOST_OSC_MAIN = 0,
+    RX_HOST_OSC_PLL,
+    RX_HOST_OSC_HOCO,
+    RX_HOST_OSC_UPLL,
+    RX_HOST_OSCS
+} rx_host_osc_t;
+
+/* Reset causes, for rx_host_reset_as(). */
+typedef enum
+{
+    RX_HOST_RESET_POWER_ON = 0,
+    RX_HOST_RESET_LVD0,
+    RX_HOST_RESET_PIN,
+    RX_HOST_RESET_SOFTWARE,
+    RX_HOST_RESET_WDT,
+    RX_HOST_RESET_IWDT
+} rx_host_reset_t;
+
+/* CPU registers that have no memory-mapped home. */
+typedef struct
+{
+    uint32_t psw;
+    uint32_t fpsw;
+    uint32_t intb;
+    uint32_t extb;
+    uint32_t bpsw;
+    uint32_t bpc;
+    uint32_t fintv;
+} rx_host_cpu_t;
+
+/***********************************************************************************************************************
+Exported global variables
+***********************************************************************************************************************/
+extern rx_host_cpu_t g_rx_host_cpu;
+
+/* Cycles charged for each nop(). Larger values compress simulated time when only the idle loop is running. */
+extern uint32_t g_rx_host_nop_cycles;
+
+/* Cycles charged before each peripheral register access in TRACE=1 builds. Non-zero values let timers advance and
+   interrupts be accepted between any two register accesses. */
+extern uint32_t g_rx_host_access_cycles;
+
+/***********************************************************************************************************************
+Exported global functions (to be accessed by other files)
+***********************************************************************************************************************/
+void     rx_host_reset(void);
+void     rx_host_reset_as(rx_host_reset_t cause);
+uint64_t rx_host_run(void (*entry)(void), uint64_t cycles);
+void     rx_host_stop(void);
+
+uint64_t rx_host_cycles(void);
+void     rx_host_advance(uint32_t cycles);
+void     rx_host_delay(uint64_t cycles);
+uint64_t rx_host_delay_cycles(void);
+void     rx_host_delay_skip(bool skip);
+void     rx_host_wait(void);
+void     rx_host_interrupt_poll(void);
+void     rx_host_wake_source(uint32_t vector, uint64_t cycles);
+uint64_t rx_host_sleep_cycles(bool standby);
+uint32_t rx_host_clock_hz(rx_host_clock_t clock);
+uint64_t rx_host_cmt_counts(uint32_t channel);
+uint64_t rx_host_cmt_pclkb(uint32_t channel);
+uint64_t rx_host_cmt_cycles_to_match(uint32_t channel);
+uint64_t rx_host_tmr01_matches(void);
+uint64_t rx_host_elc_events(uint32_t port);
+uint64_t rx_host_dtc_activations(void);
+void     rx_host_osc_delay(rx_host_osc_t osc, uint32_t us);
+uint64_t rx_host_time_ns(void);
+uint32_t rx_host_clock_violations(void);
+uint32_t rx_host_mode_violations(void);
+uint32_t rx_host_mode_transitions(void);
+
+uint32_t rx_host_current_vector(void);
+void     rx_host_vector_register(uint32_t vector, volatile uint8_t *ipr, void (*isr)(void));
+uint32_t rx_host_vector_accepted(uint32_t vector);
+
+void     rx_host_section_set(const char *name, void *top, void *end);
+
+#endif /* RX_HOST_H */
@@ -0,0 +1,432 @@
+/***********************************************************************
+*
+*  FILE        : rx_host_trace.c
+*  DESCRIPTION : Peripheral register access tracing for the host build.
+*                Implements the ThreadSanitizer entry points called by
+*                firmware compiled with 'make TRACE=1'.
+*
+*  NOTE: The firmware is never linked with the ThreadSanitizer run-time.
+*        GCC's --param tsan-distinguish-volatile=1 routes volatile
+*        accesses to __tsan_volatile_*; the atomic hooks make the
+*        access they replace, and all other hooks do nothing.
+*
+***********************************************************************/
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "platform.h"
+#include "rx_host.h"
+#include "rx_host_trace.h"
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+typedef struct
+{
+    const char *name;
+    uint32_t   base;
+} trace_peripheral_t;
+
+typedef struct
+{
+    uint32_t   start;
+    uint32_t   end;
+    uint32_t   peripheral;
+    const char *name;
+} trace_register_t;
+
+/* Peripheral indexes, in the address order of rx_host_peripherals.h. */
+typedef enum
+{
+#define RX_HOST_PERIPHERAL(name, tag, base)     TRACE_PERIPHERAL_ ## name,
+#define RX_HOST_REGISTER(name, tag, member)
+#include "rx_host_peripherals.h"
+#undef RX_HOST_PERIPHERAL
+#undef RX_HOST_REGISTER
+    TRACE_PERIPHERAL_COUNT
+} trace_peripheral_index_t;
+
+/***********************************************************************************************************************
+Private global variables and functions
+***********************************************************************************************************************/
+/* Peripheral instances and their registers from iodefine.h, listed by tools/iodefine_host.py. */
+static const trace_peripheral_t s_peripherals[TRACE_PERIPHERAL_COUNT] =
+{
+#define RX_HOST_PERIPHERAL(name, tag, base)     { #name, (base) },
+#define RX_HOST_REGISTER(name, tag, member)
+#include "rx_host_peripherals.h"
+#undef RX_HOST_PERIPHERAL
+#undef RX_HOST_REGISTER
+};
+
+/* Sorted by start address in __tsan_init(). Instances of some peripherals interleave (e.g. the I/O ports), so
+   accesses are attributed by register rather than by peripheral address range. */
+static trace_register_t s_registers[] =
+{
+#define RX_HOST_PERIPHERAL(name, tag, base)
+#define RX_HOST_REGISTER(name, tag, member)                                                         \
+    { (uint32_t)(offsetof(struct tag, member)), (uint32_t)sizeof(((struct tag *)0)->member),        \
+      TRACE_PERIPHERAL_ ## name, #member },
+#include "rx_host_peripherals.h"
+#undef RX_HOST_PERIPHERAL
+#undef RX_HOST_REGISTER
+};
+
+#define TRACE_REGISTER_COUNT    (sizeof(s_registers) / sizeof(s_registers[0]))
+
+static bool                  s_available;
+
+static rx_host_trace_entry_t s_ring[RX_HOST_TRACE_RING_SIZE];
+static uint64_t              s_total;
+static rx_host_trace_count_t s_peripheral_counts[TRACE_PERIPHERAL_COUNT + 1];
+static rx_host_trace_count_t s_vector_counts[RX_HOST_VECTOR_COUNT];
+
+static int                    compare_registers(const void *p_a, const void *p_b);
+static const trace_register_t *find_register(uint32_t address);
+static void                   trace_access(const void *address, uint32_t width, bool write);
+
+/***********************************************************************************************************************
+* Function Name: rx_host_trace_available
+* Description  : Returns whether the firmware was built with TRACE=1.
+* Arguments    : none
+* Return Value : true when register accesses are being traced.
+***********************************************************************************************************************/
+bool rx_host_trace_available(void)
+{
+    return s_available;
+}
+/***********************************************************************************************************************
+End of function rx_host_trace_available
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_trace_clear
+* Description  : Empties the ring buffer and zeroes all counters.
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+void rx_host_trace_clear(void)
+{
+    s_total = 0;
+    memset(s_peripheral_counts, 0, sizeof(s_peripheral_counts));
+    memset(s_vector_counts, 0, sizeof(s_vector_counts));
+}
+/***********************************************************************************************************************
+End of function rx_host_trace_clear
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_trace_peripheral_count
+* Description  : Returns the number of peripheral indexes, including the one for unmapped addresses.
+* Arguments    : none
+* Return Value : Peripheral index count.
+***********************************************************************************************************************/
+uint32_t rx_host_trace_peripheral_count(void)
+{
+    return TRACE_PERIPHERAL_COUNT + 1;
+}
+/***********************************************************************************************************************
+End of function rx_host_trace_peripheral_count
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_trace_peripheral_name
+* Description  : Returns the iodefine.h name of a peripheral.
+* Arguments    : peripheral -
+*                    Peripheral index (RX_HOST_TRACE_UNMAPPED is accepted).
+* Return Value : Peripheral name.
+***********************************************************************************************************************/
+const char *rx_host_trace_peripheral_name(uint32_t peripheral)
+{
+    return (peripheral < TRACE_PERIPHERAL_COUNT) ? s_peripherals[peripheral].name : "(unmapped)";
+}
+/***********************************************************************************************************************
+End of function rx_host_trace_peripheral_name
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_trace_peripheral_base
+* Description  : Returns the base address of a peripheral.
+* Arguments    : peripheral -
+*                    Peripheral index.
+* Return Value : Base address, 0 for unmapped addresses.
+***********************************************************************************************************************/
+uint32_t rx_host_trace_peripheral_base(uint32_t peripheral)
+{
+    return (peripheral < TRACE_PERIPHERAL_COUNT) ? s_peripherals[peripheral].base : 0;
+}
+/***********************************************************************************************************************
+End of function rx_host_trace_peripheral_base
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_trace_register_name
+* Description  : Returns the iodefine.h name of the register at an offset in a peripheral.
+* Arguments    : peripheral -
+*                    Peripheral index.
+*                offset -
+*                    Byte offset from the peripheral base address.
+* Return Value : Register name, or NULL if the offset is not in a register.
+***********************************************************************************************************************/
+const char *rx_host_trace_register_name(uint32_t peripheral, uint32_t offset)
+{
+    const trace_register_t *p_reg;
+
+    if (peripheral >= TRACE_PERIPHERAL_COUNT)
+    {
+        return NULL;
+    }
+
+    p_reg = find_register(s_peripherals[peripheral].base + offset);
+    return (NULL == p_reg) ? NULL : p_reg->name;
+}
+/***********************************************************************************************************************
+End of function rx_host_trace_register_name
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_trace_peripheral_counts
+* Description  : Returns the accesses made to a peripheral since the last clear.
+* Arguments    : peripheral -
+*                    Peripheral index (RX_HOST_TRACE_UNMAPPED is accepted).
+* Return Value : Read and write counts.
+***********************************************************************************************************************/
+const rx_host_trace_count_t *rx_host_trace_peripheral_counts(uint32_t peripheral)
+{
+    return &s_peripheral_counts[(peripheral < TRACE_PERIPHERAL_COUNT) ? peripheral : TRACE_PERIPHERAL_COUNT];
+}
+/***********************************************************************************************************************
+End of function rx_host_trace_peripheral_counts
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_trace_vector_counts
+* Description  : Returns the register accesses made by an interrupt service routine since the last clear.
+* Arguments    : vector -
+*                    Vector number, 0 for code running outside interrupts.
+* Return Value : Read and write counts.
+***********************************************************************************************************************/
+const rx_host_trace_count_t *rx_host_trace_vector_counts(uint32_t vector)
+{
+    return &s_vector_counts[vector % RX_HOST_VECTOR_COUNT];
+}
+/***********************************************************************************************************************
+End of function rx_host_trace_vector_counts
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_trace_total
+* Description  : Returns the number of accesses logged since the last clear.
+* Arguments    : none
+* Return Value : Access count.
+***********************************************************************************************************************/
+uint64_t rx_host_trace_total(void)
+{
+    return s_total;
+}
+/***********************************************************************************************************************
+End of function rx_host_trace_total
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: rx_host_trace_ring_read
+* Description  : Copies the most recent ring buffer entries, oldest first.
+* Arguments    : dest -
+*                    Destination buffer.
+*                max -
+*                    Maximum entries to copy.
+* Return Value : Number of entries copied.
+***********************************************************************************************************************/
+uint32_t rx_host_trace_ring_read(rx_host_trace_entry_t *dest, uint32_t max)
+{
+    uint64_t count = (s_total < RX_HOST_TRACE_RING_SIZE) ? s_total : RX_HOST_TRACE_RING_SIZE;
+    uint64_t i;
+
+    count = (count < max) ? count : max;
+    for (i = 0; i < count; i++)
+    {
+        dest[i] = s_ring[(s_total - count + i) & (RX_HOST_TRACE_RING_SIZE - 1)];
+    }
+
+    return (uint32_t)count;
+}
+/***********************************************************************************************************************
+End of function rx_host_trace_ring_read
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: compare_registers
+* Description  : qsort() comparison by start address.
+* Arguments    : p_a, p_b -
+*                    Registers to compare.
+* Return Value : <0, 0 or >0.
+***********************************************************************************************************************/
+static int compare_registers(const void *p_a, const void *p_b)
+{
+    uint32_t a = ((const trace_register_t *)p_a)->start;
+    uint32_t b = ((const trace_register_t *)p_b)->start;
+
+    return (a > b) - (a < b);
+}
+/***********************************************************************************************************************
+End of function compare_registers
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: find_register
+* Description  : Finds the register containing an address.
+* Arguments    : address -
+*                    Register file address.
+* Return Value : Register, or NULL if no register contains the address.
+***********************************************************************************************************************/
+static const trace_register_t *find_register(uint32_t address)
+{
+    uint32_t lo = 0;
+    uint32_t hi = TRACE_REGISTER_COUNT;
+    uint32_t mid;
+
+    /* Last register starting at or below the address. */
+    while ((hi - lo) > 1)
+    {
+        mid = (lo + hi) / 2;
+        if (s_registers[mid].start <= address)
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    if ((s_registers[lo].start <= address) && (address < s_registers[lo].end))
+    {
+        return &s_registers[lo];
+    }
+
+    return NULL;
+}
+/***********************************************************************************************************************
+End of function find_register
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: trace_access
+* Description  : Logs and counts one access if it falls in the register file, then charges g_rx_host_access_cycles.
+* Arguments    : address -
+*                    Accessed address.
+*                width -
+*                    Access width in bytes.
+*                write -
+*                    true for a write.
+* Return Value : none
+***********************************************************************************************************************/
+static void trace_access(const void *address, uint32_t width, bool write)
+{
+    uint32_t               addr = (uint32_t)(uintptr_t)address;
+    uint32_t               peripheral;
+    uint32_t               vector;
+    const trace_register_t *p_reg;
+    rx_host_trace_entry_t  *p_entry;
+    rx_host_trace_count_t  *p_count;
+
+    if (false == RX_HOST_IS_REGISTER(address))
+    {
+        return;
+    }
+
+    p_reg = find_register(addr);
+    peripheral = (NULL == p_reg) ? RX_HOST_TRACE_UNMAPPED : p_reg->peripheral;
+
+    p_entry = &s_ring[s_total & (RX_HOST_TRACE_RING_SIZE - 1)];
+    p_entry->peripheral = (uint8_t)peripheral;
+    p_entry->access = (uint8_t)(width | ((true == write) ? RX_HOST_TRACE_WRITE : 0));
+    p_entry->offset = (uint16_t)((RX_HOST_TRACE_UNMAPPED == peripheral) ? addr : (addr - s_peripherals[peripheral].base));
+    s_total++;
+
+    p_count = &s_peripheral_counts[(RX_HOST_TRACE_UNMAPPED == peripheral) ? TRACE_PERIPHERAL_COUNT : peripheral];
+    vector = rx_host_current_vector();
+    if (true == write)
+    {
+        p_count->writes++;
+        s_vector_counts[vector].writes++;
+    }
+    else
+    {
+        p_count->reads++;
+        s_vector_counts[vector].reads++;
+    }
+
+    /* The hook runs before the access, so time passing here can change what the access sees. */
+    if (0 != g_rx_host_access_cycles)
+    {
+        rx_host_advance(g_rx_host_access_cycles);
+    }
+}
+/***********************************************************************************************************************
+End of function trace_access
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ThreadSanitizer entry points
+***********************************************************************************************************************/
+void __tsan_init(void)
+{
+    uint32_t i;
+
+    if (true == s_available)
+    {
+        return;
+    }
+
+    for (i = 0; i < TRACE_REGISTER_COUNT; i++)
+    {
+        s_registers[i].start += s_peripherals[s_registers[i].peripheral].base;
+        s_registers[i].end += s_registers[i].start;
+    }
+    qsort(s_registers, TRACE_REGISTER_COUNT, sizeof(s_registers[0]), compare_registers);
+
+    s_available = true;
+}
+
+#define TRACE_HOOKS(n)                                                                              \
+    void __tsan_volatile_read ## n (void *addr)            { trace_access(addr, (n), false); }     \
+    void __tsan_volatile_write ## n (void *addr)           { trace_access(addr, (n), true); }      \
+    void __tsan_unaligned_volatile_read ## n (void *addr)  { trace_access(addr, (n), false); }     \
+    void __tsan_unaligned_volatile_write ## n (void *addr) { trace_access(addr, (n), true); }      \
+    void __tsan_read ## n (void *addr)                     { (void)addr; }                          \
+    void __tsan_write ## n (void *addr)                    { (void)addr; }                          \
+    void __tsan_unaligned_read ## n (void *addr)           { (void)addr; }                          \
+    void __tsan_unaligned_write ## n (void *addr)          { (void)addr; }
+
+TRACE_HOOKS(1)
+TRACE_HOOKS(2)
+TRACE_HOOKS(4)
+TRACE_HOOKS(8)
+TRACE_HOOKS(16)
+
+/* Bit field and aggregate accesses that GCC does not split into fixed-width ones. */
+void __tsan_read_range(void *addr, unsigned long size)
+{
+    trace_access(addr, (uint32_t)size, false);
+}
+
+void __tsan_write_range(void *addr, unsigned long size)
+{
+    trace_access(addr, (uint32_t)size, true);
+}
+
+/* Atomic accesses, which the firmware makes only to RAM (r_workq on the host); the memory order values are GCC's. */
+uint32_t __tsan_atomic32_load(const volatile uint32_t *addr, int order)
+{
+    return __atomic_load_n(addr, order);
+}
+
+void __tsan_atomic32_store(volatile uint32_t *addr, uint32_t value, int order)
+{
+    __atomic_store_n(addr, value, order);
+}
@@ -0,0 +1,69 @@
+/***********************************************************************
+*
+*  FILE        : rx_host_trace.h
+*  DESCRIPTION : Peripheral register access tracing for the host build.
+*
+*  NOTE: Built with 'make TRACE=1', the firmware is compiled with
+*        -fsanitize=thread so that every volatile access calls a hook
+*        in rx_host_trace.c. Accesses to the register file are logged
+*        in a ring buffer and counted per peripheral and per interrupt
+*        vector. Without TRACE=1 nothing is recorded.
+*
+***********************************************************************/
+
+#ifndef RX_HOST_TRACE_H
+#define RX_HOST_TRACE_H
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* Number of entries kept in the ring buffer (power of two). */
+#define RX_HOST_TRACE_RING_SIZE     (4096)
+
+/* rx_host_trace_entry_t.access: access width in bytes and direction. */
+#define RX_HOST_TRACE_WIDTH_MASK    (0x7F)
+#define RX_HOST_TRACE_WRITE         (0x80)
+
+/* rx_host_trace_entry_t.peripheral for register file addresses outside every iodefine.h peripheral. */
+#define RX_HOST_TRACE_UNMAPPED      (0xFF)
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+typedef struct
+{
+    uint8_t  peripheral;    /* Index for rx_host_trace_peripheral_name() */
+    uint8_t  access;        /* Width | RX_HOST_TRACE_WRITE */
+    uint16_t offset;        /* Byte offset from the peripheral base address */
+} rx_host_trace_entry_t;
+
+typedef struct
+{
+    uint64_t reads;
+    uint64_t writes;
+} rx_host_trace_count_t;
+
+/***********************************************************************************************************************
+Exported global functions (to be accessed by other files)
+***********************************************************************************************************************/
+bool        rx_host_trace_available(void);
+void        rx_host_trace_clear(void);
+
+uint32_t    rx_host_trace_peripheral_count(void);
+const char  *rx_host_trace_peripheral_name(uint32_t peripheral);
+uint32_t    rx_host_trace_peripheral_base(uint32_t peripheral);
+const char  *rx_host_trace_register_name(uint32_t peripheral, uint32_t offset);
+
+const rx_host_trace_count_t *rx_host_trace_peripheral_counts(uint32_t peripheral);
+const rx_host_trace_count_t *rx_host_trace_vector_counts(uint32_t vector);
+
+uint64_t    rx_host_trace_total(void);
+uint32_t    rx_host_trace_ring_read(rx_host_trace_entry_t *dest, uint32_t max);
+
+#endif /* RX_HOST_TRACE_H */
@@ -0,0 +1,170 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+FILE        : iodefine_host.py
+DESCRIPTION : Generates the host-build variant of the RX231 iodefine.h.
+
+The CC-RX iodefine.h is written for '#pragma bit_order left' (the first bit field declared in a storage unit occupies
+its most significant bits) and '#pragma unpack'. GCC on a little-endian host allocates bit fields starting at the least
+significant bit, so the bit fields of every storage unit are emitted in reverse order and the unpack/packoption pragmas
+are translated to '#pragma pack'. CC-RX 'long' is 32 bits wide, so 'unsigned long' registers become 'unsigned int' on
+the LP64 host, and so do the address registers declared as 'void *' (DMSAR, DMDAR, DTCVBR), which hold a 32-bit RX
+address. Register offsets, widths and the peripheral base addresses are left untouched; the host build maps an
+in-process register file at those addresses (see rx_host.c).
+
+When a third file is named, the peripheral instances defined by iodefine.h are also written to it as X-macro lists,
+sorted by address: RX_HOST_PERIPHERAL(name, struct tag, base address) for every instance, followed by
+RX_HOST_REGISTER(name, struct tag, member) for every register of every instance (see rx_host_trace.c).
+
+Usage: iodefine_host.py <iodefine.h> <output iodefine.h> [<output peripheral list>]
+"""
+
+import re
+import sys
+
+UNIT_BITS = {'char': 8, 'short': 16, 'long': 32}
+
+FIELD_RE = re.compile(r'^\s*unsigned\s+(char|short|long)\s*(\w*)\s*:\s*(\d+)\s*;\s*$')
+
+STRUCT_RE = re.compile(r'^struct\s+(\w+)\s*\{\s*$')
+MEMBER_RE = re.compile(r'^\s*(?:\}|(?:unsigned\s+)?(?:char|short|long)|void\s*\*)\s*(\w+)\s*(?:\[\s*\d+\s*\])?\s*;\s*$')
+
+PERIPHERAL_RE = re.compile(r'^#define\s+(\w+)\s+\(\*\(volatile\s+struct\s+(\w+)\s+__evenaccess\s+\*\)(0x[0-9A-Fa-f]+)\)\s*$')
+
+PRAGMAS = {
+    '#pragma bit_order left': '/* #pragma bit_order left - bit fields reversed per storage unit below */',
+    '#pragma bit_order': '/* #pragma bit_order */',
+    '#pragma unpack': '#pragma pack(push, 1)',
+    '#pragma packoption': '#pragma pack(pop)',
+}
+
+
+def reverse_units(fields, where):
+    """Reverse the declaration order of the bit fields inside each storage unit.
+
+    A field that does not fit in the rest of a unit starts a new one, as it does for CC-RX; the unused bits are made
+    explicit so that the packed host layout keeps every later field in its unit.
+    """
+    out = []
+    unit = []
+    used = 0
+    size = None
+    ftype = None
+    for line, ftype, width in fields:
+        if size is None:
+            size = UNIT_BITS[ftype]
+        if UNIT_BITS[ftype] != size:
+            sys.exit('%s: mixed storage unit types in one bit field block' % where)
+        if used + width > size:
+            unit.append(padding(line, ftype, size - used))
+            out.extend(reversed(unit))
+            unit = []
+            used = 0
+        unit.append(line)
+        used += width
+        if used == size:
+            out.extend(reversed(unit))
+            unit = []
+            used = 0
+    if unit:
+        unit.append(padding(unit[-1], ftype, size - used))
+        out.extend(reversed(unit))
+    return out
+
+
+def padding(line, ftype, width):
+    """Unnamed bit field of the given width, indented like line."""
+    indent = line[:len(line) - len(line.lstrip())]
+    return '%sunsigned %s :%d;' % (indent, ftype, width)
+
+
+def convert(lines, src_name):
+    out = []
+    i = 0
+    while i < len(lines):
+        line = lines[i]
+        stripped = line.strip()
+        if stripped in PRAGMAS:
+            out.append(line.replace(stripped, PRAGMAS[stripped]))
+            i += 1
+            continue
+        if stripped == 'struct {':
+            # Collect the block; only blocks made entirely of bit fields are reordered.
+            j = i + 1
+            fields = []
+            while not lines[j].strip().startswith('}'):
+                m = FIELD_RE.match(lines[j])
+                fields.append((lines[j], m.group(1), int(m.group(3))) if m else None)
+                j += 1
+            out.append(line)
+            if fields and all(fields):
+                out.extend(reverse_units(fields, '%s:%d' % (src_name, i + 1)))
+            else:
+                out.extend(lines[i + 1:j])
+            i = j
+            continue
+        out.append(line)
+        i += 1
+    return out
+
+
+def peripherals(lines):
+    """Peripheral instances as (name, struct tag, base address), sorted by address."""
+    found = []
+    for line in lines:
+        m = PERIPHERAL_RE.match(line)
+        if m:
+            found.append((m.group(1), m.group(2), int(m.group(3), 16)))
+    return sorted(found, key=lambda p: (p[2], p[0]))
+
+
+def registers(lines):
+    """Top-level register members of every struct, by struct tag. Reserved 'wkN' gaps are left out."""
+    found = {}
+    tag = None
+    depth = 0
+    for line in lines:
+        if tag is None:
+            m = STRUCT_RE.match(line)
+            if m:
+                tag = m.group(1)
+                found[tag] = []
+                depth = 1
+            continue
+        depth -= line.count('}')
+        if depth == 0:
+            tag = None
+            continue
+        if depth == 1:
+            m = MEMBER_RE.match(line)
+            if m and not re.match(r'wk\d+$', m.group(1)):
+                found[tag].append(m.group(1))
+        depth += line.count('{')
+    return found
+
+
+def main(argv):
+    if len(argv) not in (3, 4):
+        sys.exit(__doc__.strip().splitlines()[-1])
+    with open(argv[1], encoding='latin-1', newline='') as f:
+        lines = f.read().splitlines()
+    body = [re.sub(r'\bvoid(\s*)\*', r'unsigned int\1', re.sub(r'\bunsigned long\b', 'unsigned int', line))
+            for line in convert(lines, argv[1])]
+    with open(argv[2], 'w', encoding='latin-1', newline='\n') as f:
+        f.write('/* Generated by iodefine_host.py from %s. Do not edit. */\n' % argv[1])
+        f.write('\n'.join(body))
+        f.write('\n')
+    if len(argv) == 4:
+        with open(argv[3], 'w', encoding='latin-1', newline='\n') as f:
+            f.write('/* Generated by iodefine_host.py from %s. Do not edit. */\n' % argv[1])
+            instances = peripherals(lines)
+            members = registers(lines)
+            for name, tag, base in instances:
+                f.write('RX_HOST_PERIPHERAL(%s, %s, 0x%08XUL)\n' % (name, tag, base))
+            for name, tag, base in instances:
+                for member in members[tag]:
+                    f.write('RX_HOST_REGISTER(%s, %s, %s)\n' % (name, tag, member))
+
+
+if __name__ == '__main__':
+    main(sys.argv)
@@ -0,0 +1,228 @@
+/***********************************************************************
+*
+*  FILE        : lz4_pack.c
+*  DESCRIPTION : LZ4 block compressor for the host.
+*
+***********************************************************************/
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <string.h>
+#include "lz4_pack.h"
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+#define PACK_HASH_BITS      (12U)
+#define PACK_MATCH_MIN      (4U)
+#define PACK_MFLIMIT        (12U)       /* A match starts at least this far from the end */
+#define PACK_LAST_LITERALS  (5U)        /* and ends at least this far from it. */
+#define PACK_OFFSET_MAX     (65535U)
+#define PACK_MORE           (15U)
+
+/***********************************************************************************************************************
+Private global variables and functions
+***********************************************************************************************************************/
+static uint32_t pack_read32(const uint8_t *p);
+static uint8_t *pack_count(uint8_t *p_out, const uint8_t *p_out_end, size_t count);
+static uint8_t *pack_sequence(uint8_t *p_out, const uint8_t *p_out_end, const uint8_t *p_literals, size_t literals,
+                              size_t offset, size_t match);
+
+/***********************************************************************************************************************
+* Function Name: lz4_pack_bound
+* Description  : Returns the largest stream lz4_pack() can write for an input size.
+* Arguments    : size -
+*                    Input size.
+* Return Value : Capacity that never makes lz4_pack() fail.
+***********************************************************************************************************************/
+size_t lz4_pack_bound(size_t size)
+{
+    return size + (size / 255U) + 16U;
+}
+/***********************************************************************************************************************
+End of function lz4_pack_bound
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: lz4_pack
+* Description  : Compresses data into one LZ4 block.
+* Arguments    : p_src -
+*                    Data.
+*                size -
+*                    Size of the data.
+*                p_dst -
+*                    Stream buffer.
+*                capacity -
+*                    Size of the stream buffer.
+* Return Value : Size of the stream, 0 if it does not fit in capacity.
+***********************************************************************************************************************/
+size_t lz4_pack(const uint8_t *p_src, size_t size, uint8_t *p_dst, size_t capacity)
+{
+    uint32_t      table[1U << PACK_HASH_BITS];  /* Position + 1 of the last four bytes with each hash, 0 for none */
+    const uint8_t *p_end = p_src + size;
+    const uint8_t *p_ip = p_src;
+    const uint8_t *p_anchor = p_src;
+    const uint8_t *p_ref;
+    uint8_t       *p_out = p_dst;
+    uint8_t       *p_out_end = p_dst + capacity;
+    uint32_t      hash;
+    size_t        match;
+
+    memset(table, 0, sizeof(table));
+
+    if (size > (PACK_MFLIMIT + 1U))
+    {
+        const uint8_t *p_mflimit = p_end - PACK_MFLIMIT;
+        const uint8_t *p_matchlimit = p_end - PACK_LAST_LITERALS;
+
+        while (p_ip < p_mflimit)
+        {
+            hash = (uint32_t)(pack_read32(p_ip) * 2654435761U) >> (32U - PACK_HASH_BITS);
+            p_ref = (0U != table[hash]) ? (p_src + table[hash] - 1U) : NULL;
+            table[hash] = (uint32_t)(p_ip - p_src) + 1U;
+
+            if ((NULL == p_ref) || ((size_t)(p_ip - p_ref) > PACK_OFFSET_MAX) ||
+                (pack_read32(p_ref) != pack_read32(p_ip)))
+            {
+                p_ip++;
+                continue;
+            }
+
+            for (match = PACK_MATCH_MIN; ((p_ip + match) < p_matchlimit) && (p_ref[match] == p_ip[match]); match++)
+            {
+            }
+            p_out = pack_sequence(p_out, p_out_end, p_anchor, (size_t)(p_ip - p_anchor), (size_t)(p_ip - p_ref), match);
+            if (NULL == p_out)
+            {
+                return 0U;
+            }
+            p_ip += match;
+            p_anchor = p_ip;
+        }
+    }
+
+    /* The last sequence is literals only. */
+    p_out = pack_sequence(p_out, p_out_end, p_anchor, (size_t)(p_end - p_anchor), 0U, 0U);
+
+    return (NULL == p_out) ? 0U : (size_t)(p_out - p_dst);
+}
+/***********************************************************************************************************************
+End of function lz4_pack
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: pack_read32
+* Description  : Reads four bytes at any alignment.
+* Arguments    : p -
+*                    Bytes.
+* Return Value : The bytes as a word.
+***********************************************************************************************************************/
+static uint32_t pack_read32(const uint8_t *p)
+{
+    uint32_t value;
+
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+/***********************************************************************************************************************
+End of function pack_read32
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: pack_count
+* Description  : Writes the continuation bytes of a literal count or match length of 15 or more.
+* Arguments    : p_out -
+*                    Stream position.
+*                p_out_end -
+*                    End of the stream buffer.
+*                count -
+*                    Count less the 15 held in the token.
+* Return Value : Stream position after the bytes, NULL if they do not fit.
+***********************************************************************************************************************/
+static uint8_t *pack_count(uint8_t *p_out, const uint8_t *p_out_end, size_t count)
+{
+    for (;;)
+    {
+        if (p_out >= p_out_end)
+        {
+            return NULL;
+        }
+        if (count < 255U)
+        {
+            *p_out++ = (uint8_t)count;
+            return p_out;
+        }
+        *p_out++ = 255U;
+        count -= 255U;
+    }
+}
+/***********************************************************************************************************************
+End of function pack_count
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: pack_sequence
+* Description  : Writes one sequence: token, literals and, unless match is 0, the match.
+* Arguments    : p_out -
+*                    Stream position.
+*                p_out_end -
+*                    End of the stream buffer.
+*                p_literals -
+*                    Literals.
+*                literals -
+*                    Number of literals.
+*                offset -
+*                    Distance back to the match.
+*                match -
+*                    Match length, at least 4, or 0 for the last sequence.
+* Return Value : Stream position after the sequence, NULL if it does not fit.
+***********************************************************************************************************************/
+static uint8_t *pack_sequence(uint8_t *p_out, const uint8_t *p_out_end, const uint8_t *p_literals, size_t literals,
+                              size_t offset, size_t match)
+{
+    uint8_t *p_token = p_out;
+    size_t  length = (0U != match) ? (match - PACK_MATCH_MIN) : 0U;
+
+    if (p_out >= p_out_end)
+    {
+        return NULL;
+    }
+    *p_token = (uint8_t)(((literals < PACK_MORE) ? literals : PACK_MORE) << 4);
+    *p_token |= (uint8_t)((length < PACK_MORE) ? length : PACK_MORE);
+    p_out++;
+
+    if (literals >= PACK_MORE)
+    {
+        p_out = pack_count(p_out, p_out_end, literals - PACK_MORE);
+        if (NULL == p_out)
+        {
+            return NULL;
+        }
+    }
+    if ((size_t)(p_out_end - p_out) < literals)
+    {
+        return NULL;
+    }
+    memcpy(p_out, p_literals, literals);
+    p_out += literals;
+
+    if (0U != match)
+    {
+        if ((p_out_end - p_out) < 2)
+        {
+            return NULL;
+        }
+        *p_out++ = (uint8_t)offset;
+        *p_out++ = (uint8_t)(offset >> 8);
+        if (length >= PACK_MORE)
+        {
+            p_out = pack_count(p_out, p_out_end, length - PACK_MORE);
+        }
+    }
+
+    return p_out;
+}
+/***********************************************************************************************************************
+End of function pack_sequence
+***********************************************************************************************************************/
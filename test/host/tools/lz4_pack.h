@@ -0,0 +1,29 @@
+/***********************************************************************
+*
+*  FILE        : lz4_pack.h
+*  DESCRIPTION : LZ4 block compressor for the host, the packing side of
+*                R_INITSCT_Unpack().
+*
+*  NOTE: Greedy, with one candidate per hash of the next four bytes.
+*        The streams keep the LZ4 end-of-block rules (the last match
+*        starts at least 12 bytes and ends at least 5 bytes before the
+*        end), so any LZ4 block decoder accepts them.
+*
+***********************************************************************/
+
+#ifndef LZ4_PACK_H
+#define LZ4_PACK_H
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <stddef.h>
+#include <stdint.h>
+
+/***********************************************************************************************************************
+Exported global functions (to be accessed by other files)
+***********************************************************************************************************************/
+size_t lz4_pack_bound(size_t size);
+size_t lz4_pack(const uint8_t *p_src, size_t size, uint8_t *p_dst, size_t capacity);
+
+#endif /* LZ4_PACK_H */
@@ -0,0 +1,240 @@
+/***********************************************************************
+*
+*  FILE        : zsect.c
+*  DESCRIPTION : Build step for packed initial data: compresses binary
+*                files and writes them, with the C$ZSEC table that
+*                R_INITSCT_Run() unpacks them from, as a C source file.
+*
+*  NOTE: Usage: zsect <output.c> <name>=<file> | <section>:<file> ...
+*        Each <name> becomes an uninitialized uint8_t array of the
+*        size of <file>, which R_INITSCT_Run() fills from its LZ4
+*        stream when INITSCT_CFG_PACKED is 1; declare it
+*        'extern uint8_t <name>[];' where it is used. A <section>
+*        is an existing RAM section, such as R for the contents of
+*        D (see the Makefile's zsect-d); an empty <file> gives an entry with
+*        nothing to unpack. Add the output to the project; the
+*        linker's C$* entry places the table, and the streams are
+*        in the ZSECT section (CZSECT_1, as they are byte arrays).
+*
+***********************************************************************/
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "lz4_pack.h"
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+#define ZSECT_BYTES_PER_LINE    (16U)
+
+/***********************************************************************************************************************
+Private global variables and functions
+***********************************************************************************************************************/
+static uint8_t *zsect_read(const char *p_path, size_t *p_size);
+static void     zsect_bytes(FILE *p_out, const uint8_t *p_bytes, size_t size);
+
+/***********************************************************************************************************************
+* Function Name: main
+* Description  : Writes the packed arrays and the C$ZSEC table.
+* Arguments    : argc -
+*                    Argument count.
+*                argv -
+*                    Output file, then one <name>=<file> or <section>:<file> per area.
+* Return Value : 0, or 1 on a usage or file error.
+***********************************************************************************************************************/
+int main(int argc, char *argv[])
+{
+    FILE    *p_out;
+    char    *p_eq;
+    bool    *p_section;
+    size_t  *p_packed_size;
+    uint8_t *p_data;
+    uint8_t *p_packed;
+    size_t  size;
+    size_t  packed;
+    int     i;
+
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage: %s <output.c> <name>=<file> | <section>:<file> ...\n", argv[0]);
+        return 1;
+    }
+    p_section = calloc((size_t)argc, sizeof(bool));
+    p_packed_size = calloc((size_t)argc, sizeof(size_t));
+    if ((NULL == p_section) || (NULL == p_packed_size))
+    {
+        perror(argv[0]);
+        return 1;
+    }
+    p_out = fopen(argv[1], "w");
+    if (NULL == p_out)
+    {
+        perror(argv[1]);
+        return 1;
+    }
+
+    fprintf(p_out, "/* Generated by zsect; unpacked by R_INITSCT_Run() with INITSCT_CFG_PACKED 1. */\n\n");
+    fprintf(p_out, "#include <stdint.h>\n");
+
+    for (i = 2; i < argc; i++)
+    {
+        p_eq = strchr(argv[i], '=');
+        if (NULL == p_eq)
+        {
+            p_eq = strchr(argv[i], ':');
+            p_section[i] = true;
+        }
+        if ((NULL == p_eq) || (p_eq == argv[i]))
+        {
+            fprintf(stderr, "%s: expected <name>=<file> or <section>:<file>\n", argv[i]);
+            return 1;
+        }
+        *p_eq = '\0';
+        p_data = zsect_read(p_eq + 1, &size);
+        if (NULL == p_data)
+        {
+            return 1;
+        }
+        if ((0U == size) && (false == p_section[i]))
+        {
+            fprintf(stderr, "%s: empty\n", p_eq + 1);
+            return 1;
+        }
+        p_packed = malloc(lz4_pack_bound(size));
+        if (NULL == p_packed)
+        {
+            perror(argv[0]);
+            return 1;
+        }
+        packed = (0U == size) ? 0U : lz4_pack(p_data, size, p_packed, lz4_pack_bound(size));
+        p_packed_size[i] = packed;
+
+        if (true == p_section[i])
+        {
+            fprintf(p_out, "\n/* %s: %lu bytes packed to %lu, unpacked into section %s. */\n", p_eq + 1,
+                    (unsigned long)size, (unsigned long)packed, argv[i]);
+        }
+        else
+        {
+            fprintf(p_out, "\n/* %s: %lu bytes packed to %lu. */\n", p_eq + 1, (unsigned long)size,
+                    (unsigned long)packed);
+            fprintf(p_out, "uint8_t %s[%lu];\n", argv[i], (unsigned long)size);
+        }
+        if (0U != packed)
+        {
+            fprintf(p_out, "#pragma section C ZSECT\n");
+            fprintf(p_out, "static const uint8_t %s%s_packed[%lu] =\n{", (true == p_section[i]) ? "zsect_" : "",
+                    argv[i], (unsigned long)packed);
+            zsect_bytes(p_out, p_packed, packed);
+            fprintf(p_out, "\n};\n#pragma section\n");
+        }
+        free(p_packed);
+        free(p_data);
+    }
+
+    fprintf(p_out, "\n#pragma section C C$ZSEC\n");
+    fprintf(p_out, "const struct\n{\n    uint8_t *packed_s;\n    uint8_t *packed_e;\n");
+    fprintf(p_out, "    uint8_t *ram_s;\n    uint8_t *ram_e;\n} _ZTBL[] =\n{\n");
+    for (i = 2; i < argc; i++)
+    {
+        if (0U == p_packed_size[i])
+        {
+            /* An empty section: nothing to unpack (and, before the first link, nothing packed yet). */
+            fprintf(p_out, "    { (uint8_t *)0, (uint8_t *)0, ");
+        }
+        else
+        {
+            fprintf(p_out, "    { (uint8_t *)%s%s_packed, (uint8_t *)%s%s_packed + sizeof(%s%s_packed), ",
+                    (true == p_section[i]) ? "zsect_" : "", argv[i], (true == p_section[i]) ? "zsect_" : "",
+                    argv[i], (true == p_section[i]) ? "zsect_" : "", argv[i]);
+        }
+        if (true == p_section[i])
+        {
+            fprintf(p_out, "(uint8_t *)__sectop(\"%s\"), (uint8_t *)__secend(\"%s\") },\n", argv[i], argv[i]);
+        }
+        else
+        {
+            fprintf(p_out, "%s, %s + sizeof(%s) },\n", argv[i], argv[i], argv[i]);
+        }
+    }
+    fprintf(p_out, "};\n#pragma section\n");
+
+    free(p_section);
+    free(p_packed_size);
+    return (0 == fclose(p_out)) ? 0 : 1;
+}
+/***********************************************************************************************************************
+End of function main
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: zsect_read
+* Description  : Reads a whole file.
+* Arguments    : p_path -
+*                    File.
+*                p_size -
+*                    Receives its size.
+* Return Value : Contents (malloc'd), NULL on an error.
+***********************************************************************************************************************/
+static uint8_t *zsect_read(const char *p_path, size_t *p_size)
+{
+    FILE    *p_in = fopen(p_path, "rb");
+    uint8_t *p_data;
+    long    size;
+
+    if (NULL == p_in)
+    {
+        perror(p_path);
+        return NULL;
+    }
+    if ((0 != fseek(p_in, 0L, SEEK_END)) || ((size = ftell(p_in)) < 0) || (0 != fseek(p_in, 0L, SEEK_SET)))
+    {
+        perror(p_path);
+        fclose(p_in);
+        return NULL;
+    }
+    p_data = malloc((size_t)size + 1U);
+    if ((NULL == p_data) || (fread(p_data, 1U, (size_t)size, p_in) != (size_t)size))
+    {
+        perror(p_path);
+        free(p_data);
+        fclose(p_in);
+        return NULL;
+    }
+    fclose(p_in);
+
+    *p_size = (size_t)size;
+    return p_data;
+}
+/***********************************************************************************************************************
+End of function zsect_read
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: zsect_bytes
+* Description  : Writes bytes as the elements of an array initializer.
+* Arguments    : p_out -
+*                    Output file.
+*                p_bytes -
+*                    Bytes.
+*                size -
+*                    Number of bytes.
+* Return Value : none
+***********************************************************************************************************************/
+static void zsect_bytes(FILE *p_out, const uint8_t *p_bytes, size_t size)
+{
+    size_t i;
+
+    for (i = 0U; i < size; i++)
+    {
+        fprintf(p_out, "%s0x%02XU,", (0U == (i % ZSECT_BYTES_PER_LINE)) ? "\n    " : " ", p_bytes[i]);
+    }
+}
+/***********************************************************************************************************************
+End of function zsect_bytes
+***********************************************************************************************************************/
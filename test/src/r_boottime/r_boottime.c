@@ -0,0 +1,300 @@
+/***********************************************************************
+*
+*  FILE        : r_boottime.c
+*  DESCRIPTION : Boot timeline of the start-up stages.
+*
+*  NOTE: R_BOOTTIME_Start() and the marks run before _INITSCT() and
+*        before the interrupts are set up, so they use no
+*        initialized data and no interrupt masking.
+*
+***********************************************************************/
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <stdio.h>
+#include "platform.h"
+#include "r_boottime.h"
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* CMT3 control: PCLKB/8, with the compare match request enabled so that IR shows a turn; the interrupt itself stays
+   disabled in IER. A turn is CMCOR + 1 counts. */
+#define BOOTTIME_CMCR           (0x0080U)
+#define BOOTTIME_CMCR_CMIE      (0x0040U)
+#define BOOTTIME_CMCOR          (0xFFFFU)
+#define BOOTTIME_TURN           (0x10000UL)
+#define BOOTTIME_DIVISOR        (8U)
+
+/* Clock sources selected by SCKCR3.CKSEL. */
+#define BOOTTIME_LOCO_HZ        (4000000UL)
+#define BOOTTIME_SUB_HZ         (32768UL)
+#define BOOTTIME_HOCO_32MHZ     (32000000UL)
+#define BOOTTIME_HOCO_54MHZ     (54000000UL)
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+typedef struct st_boottime_record
+{
+    uint32_t    marked;                         /* One bit per stage marked since the start */
+    uint32_t    saturated;                      /* One bit per stage that ran over a CMT3 turn */
+    uint32_t    pclkb_hz;                       /* PCLKB at the last mark */
+    uint16_t    last;                           /* CMT3 count at the last mark */
+    uint32_t    counts[BOOTTIME_STAGES];
+    uint32_t    stage_pclkb_hz[BOOTTIME_STAGES];
+} boottime_record_t;
+
+/***********************************************************************************************************************
+Private global variables and functions
+***********************************************************************************************************************/
+/* Written before _INITSCT(), so it must be in a section that _INITSCT() leaves alone. */
+#if defined(RX_HOST_BUILD)
+static boottime_record_t s_record __attribute__((section("rx_noinit")));
+#else
+#pragma section B BOOTTIME
+static boottime_record_t s_record;
+#pragma section
+#endif
+
+static const char * const s_names[BOOTTIME_STAGES] =
+{
+    "clock", "usb_lpc", "initsct", "iolib", "interrupt", "protect", "switch", "hardware"
+};
+
+static uint32_t boottime_pclkb_hz(void);
+
+/***********************************************************************************************************************
+* Function Name: R_BOOTTIME_Start
+* Description  : Clears the record and starts CMT3 counting from 0. Called at reset entry.
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+void R_BOOTTIME_Start(void)
+{
+    uint32_t stage;
+
+    SYSTEM.PRCR.WORD = 0xA502U;
+    MSTP(CMT3) = 0U;
+    SYSTEM.PRCR.WORD = 0xA500U;
+
+    CMT.CMSTR1.BIT.STR3 = 0U;
+    CMT3.CMCR.WORD = BOOTTIME_CMCR | BOOTTIME_CMCR_CMIE;
+    CMT3.CMCOR = BOOTTIME_CMCOR;
+    CMT3.CMCNT = 0U;
+    IR(CMT3,CMI3) = 0U;
+
+    s_record.marked = 0U;
+    s_record.saturated = 0U;
+    s_record.last = 0U;
+    s_record.pclkb_hz = boottime_pclkb_hz();
+    for (stage = 0; stage < BOOTTIME_STAGES; stage++)
+    {
+        s_record.counts[stage] = 0U;
+        s_record.stage_pclkb_hz[stage] = 0U;
+    }
+
+    CMT.CMSTR1.BIT.STR3 = 1U;
+}
+/***********************************************************************************************************************
+End of function R_BOOTTIME_Start
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_BOOTTIME_Mark
+* Description  : Ends a stage: records the counts since the previous mark, and whether CMT3 turned over since then.
+*                The hardware_setup() stage is the last one and stops CMT3.
+* Arguments    : stage -
+*                    Stage that has just ended.
+* Return Value : none
+***********************************************************************************************************************/
+void R_BOOTTIME_Mark(boottime_stage_t stage)
+{
+    uint32_t counts;
+    uint16_t now;
+    uint8_t  turned;
+
+    if ((uint32_t)stage >= BOOTTIME_STAGES)
+    {
+        return;
+    }
+    if (BOOTTIME_STAGE_HARDWARE == stage)
+    {
+        CMT.CMSTR1.BIT.STR3 = 0U;
+    }
+
+    /* A compare match between the reads of IR and CMCNT is seen by the second read of IR; CMCNT is read again. */
+    turned = IR(CMT3,CMI3);
+    now = CMT3.CMCNT;
+    if ((0U == turned) && (0U != IR(CMT3,CMI3)))
+    {
+        turned = 1U;
+        now = CMT3.CMCNT;
+    }
+
+    counts = (uint16_t)(now - s_record.last);
+    if (0U != turned)
+    {
+        /* CMCNT matched CMCOR since the last mark. Unless the match is the one at the current count, CMCNT has been
+           cleared since: the 16-bit difference holds that turn only when CMCNT is now below the last mark. Further
+           turns cannot be seen, so the counts are a lower bound. */
+        if (BOOTTIME_CMCOR != now)
+        {
+            IR(CMT3,CMI3) = 0U;
+            if (now >= s_record.last)
+            {
+                counts += BOOTTIME_TURN;
+            }
+        }
+        s_record.saturated |= (1UL << stage);
+    }
+    if (BOOTTIME_STAGE_HARDWARE == stage)
+    {
+        CMT3.CMCR.WORD = BOOTTIME_CMCR;
+        IR(CMT3,CMI3) = 0U;
+    }
+
+    s_record.counts[stage] = counts;
+    s_record.stage_pclkb_hz[stage] = s_record.pclkb_hz;
+    s_record.marked |= (1UL << stage);
+    s_record.last = now;
+    s_record.pclkb_hz = boottime_pclkb_hz();
+}
+/***********************************************************************************************************************
+End of function R_BOOTTIME_Mark
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_BOOTTIME_GetStage
+* Description  : Returns the time of a stage.
+* Arguments    : stage -
+*                    Stage.
+*                p_span -
+*                    Receives the counts, the PCLKB they are converted at and the time in ns.
+* Return Value : false if the stage is invalid or was not marked since the last reset, or p_span is NULL.
+***********************************************************************************************************************/
+bool R_BOOTTIME_GetStage(boottime_stage_t stage, boottime_span_t *p_span)
+{
+    if (((uint32_t)stage >= BOOTTIME_STAGES) || (NULL == p_span) || (0U == (s_record.marked & (1UL << stage))) ||
+        (0U == s_record.stage_pclkb_hz[stage]))
+    {
+        return false;
+    }
+
+    p_span->counts = s_record.counts[stage];
+    p_span->pclkb_hz = s_record.stage_pclkb_hz[stage];
+    p_span->ns = (uint32_t)(((uint64_t)p_span->counts * BOOTTIME_DIVISOR * 1000000000ULL) / p_span->pclkb_hz);
+    p_span->saturated = (0U != (s_record.saturated & (1UL << stage)));
+
+    return true;
+}
+/***********************************************************************************************************************
+End of function R_BOOTTIME_GetStage
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_BOOTTIME_TotalNs
+* Description  : Returns the time from R_BOOTTIME_Start() to the last mark.
+* Arguments    : none
+* Return Value : Sum of the marked stages, in ns; a lower bound if a stage is saturated.
+***********************************************************************************************************************/
+uint32_t R_BOOTTIME_TotalNs(void)
+{
+    boottime_span_t span;
+    uint32_t        total = 0U;
+    uint32_t        stage;
+
+    for (stage = 0; stage < BOOTTIME_STAGES; stage++)
+    {
+        if (true == R_BOOTTIME_GetStage((boottime_stage_t)stage, &span))
+        {
+            total += span.ns;
+        }
+    }
+
+    return total;
+}
+/***********************************************************************************************************************
+End of function R_BOOTTIME_TotalNs
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_BOOTTIME_StageName
+* Description  : Returns the name of a stage.
+* Arguments    : stage -
+*                    Stage.
+* Return Value : Name, or "?" for an invalid stage.
+***********************************************************************************************************************/
+const char *R_BOOTTIME_StageName(boottime_stage_t stage)
+{
+    return ((uint32_t)stage < BOOTTIME_STAGES) ? s_names[stage] : "?";
+}
+/***********************************************************************************************************************
+End of function R_BOOTTIME_StageName
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_BOOTTIME_Print
+* Description  : Prints the timeline, one line per marked stage and the total, through the I/O library. Lower bounds
+*                of saturated stages are shown with ">=".
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+void R_BOOTTIME_Print(void)
+{
+    boottime_span_t span;
+    uint32_t        stage;
+
+    for (stage = 0; stage < BOOTTIME_STAGES; stage++)
+    {
+        if (true == R_BOOTTIME_GetStage((boottime_stage_t)stage, &span))
+        {
+            printf("boot %-10s: %s%10lu ns (%6lu counts at PCLKB %8lu Hz)\n", s_names[stage],
+                   (true == span.saturated) ? ">=" : "  ", (unsigned long)span.ns, (unsigned long)span.counts,
+                   (unsigned long)span.pclkb_hz);
+        }
+    }
+    printf("boot total     : %s%10lu ns\n", (0U != s_record.saturated) ? ">=" : "  ",
+           (unsigned long)R_BOOTTIME_TotalNs());
+}
+/***********************************************************************************************************************
+End of function R_BOOTTIME_Print
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: boottime_pclkb_hz
+* Description  : Decodes PCLKB from the clock source and divider settings.
+* Arguments    : none
+* Return Value : PCLKB in Hz.
+***********************************************************************************************************************/
+static uint32_t boottime_pclkb_hz(void)
+{
+    uint32_t source;
+
+    switch (SYSTEM.SCKCR3.BIT.CKSEL)
+    {
+        case 1:
+            source = (3U == SYSTEM.HOCOCR2.BIT.HCFRQ) ? BOOTTIME_HOCO_54MHZ : BOOTTIME_HOCO_32MHZ;
+            break;
+        case 2:
+            source = BSP_CFG_XTAL_HZ;
+            break;
+        case 3:
+            source = BOOTTIME_SUB_HZ;
+            break;
+        case 4:
+            /* PLL: main clock divided by 1, 2 or 4, multiplied by (STC + 1) / 2. */
+            source = (uint32_t)((((uint32_t)BSP_CFG_XTAL_HZ >> SYSTEM.PLLCR.BIT.PLIDIV) *
+                                 (SYSTEM.PLLCR.BIT.STC + 1U)) / 2U);
+            break;
+        default:
+            source = BOOTTIME_LOCO_HZ;
+            break;
+    }
+
+    return source >> SYSTEM.SCKCR.BIT.PCKB;
+}
+/***********************************************************************************************************************
+End of function boottime_pclkb_hz
+***********************************************************************************************************************/
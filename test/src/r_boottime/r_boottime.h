@@ -0,0 +1,87 @@
+/***********************************************************************
+*
+*  FILE        : r_boottime.h
+*  DESCRIPTION : Boot timeline: the time PowerON_Reset_PC spends in
+*                each start-up stage before main().
+*
+*  NOTE: BOOTTIME_START() at reset entry starts CMT3 free-running at
+*        PCLKB/8, and BOOTTIME_MARK(stage) at the end of each stage
+*        records the counts since the previous mark; the
+*        hardware_setup() mark stops CMT3 again. The CMI3 request
+*        flag (IR, with the interrupt left disabled in IER) shows a
+*        stage that ran over a CMT3 turn (19 ms at PCLKB 27 MHz,
+*        131 ms at the 4 MHz LOCO of the reset clock): one turn is
+*        counted, and the stage is reported saturated, as further
+*        turns cannot be seen.
+*        Counts are converted at the PCLKB in effect when the stage
+*        began, read back from the clock registers; the clock stage
+*        switches PCLKB part way through, so its time is an upper
+*        bound. With CLKSTAGE_CFG_ENABLE the switch stage does that
+*        instead, and the stages before it run at the LOCO.
+*        The record is kept out of the sections _INITSCT()
+*        initializes and is valid from main() until the next reset.
+*        With BOOTTIME_CFG_ENABLE 0 the marks cost nothing.
+*
+***********************************************************************/
+
+#ifndef R_BOOTTIME_H
+#define R_BOOTTIME_H
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* 1 to time the start-up stages, 0 to leave the marks empty. */
+#ifndef BOOTTIME_CFG_ENABLE
+#define BOOTTIME_CFG_ENABLE         (0)
+#endif
+
+#if BOOTTIME_CFG_ENABLE == 1
+#define BOOTTIME_START()            R_BOOTTIME_Start()
+#define BOOTTIME_MARK(stage)        R_BOOTTIME_Mark(stage)
+#else
+#define BOOTTIME_START()
+#define BOOTTIME_MARK(stage)
+#endif
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+/* Start-up stages in the order PowerON_Reset_PC runs them. */
+typedef enum e_boottime_stage
+{
+    BOOTTIME_STAGE_CLOCK = 0,       /* operating_frequency_set(), or R_CLKSTAGE_Start() */
+    BOOTTIME_STAGE_USB_LPC,         /* usb_lpc_clock_source_select() */
+    BOOTTIME_STAGE_INITSCT,         /* _INITSCT(), with RETAIN_OPEN() and the warm start callbacks */
+    BOOTTIME_STAGE_IOLIB,           /* _INIT_IOLIB(), if BSP_CFG_IO_LIB_ENABLE */
+    BOOTTIME_STAGE_INTERRUPT,       /* bsp_interrupt_open() */
+    BOOTTIME_STAGE_PROTECT,         /* bsp_register_protect_open() */
+    BOOTTIME_STAGE_SWITCH,          /* R_CLKSTAGE_Finish(), if CLKSTAGE_CFG_ENABLE */
+    BOOTTIME_STAGE_HARDWARE,        /* hardware_setup() */
+    BOOTTIME_STAGES
+} boottime_stage_t;
+
+typedef struct st_boottime_span
+{
+    uint32_t    counts;     /* CMT3 counts (PCLKB/8) */
+    uint32_t    pclkb_hz;   /* PCLKB when the stage began */
+    uint32_t    ns;
+    bool        saturated;  /* The stage ran over a CMT3 turn: counts and ns are a lower bound */
+} boottime_span_t;
+
+/***********************************************************************************************************************
+Exported global functions (to be accessed by other files)
+***********************************************************************************************************************/
+void        R_BOOTTIME_Start(void);
+void        R_BOOTTIME_Mark(boottime_stage_t stage);
+bool        R_BOOTTIME_GetStage(boottime_stage_t stage, boottime_span_t *p_span);
+uint32_t    R_BOOTTIME_TotalNs(void);
+const char *R_BOOTTIME_StageName(boottime_stage_t stage);
+void        R_BOOTTIME_Print(void);
+
+#endif /* R_BOOTTIME_H */
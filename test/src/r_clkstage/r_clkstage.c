@@ -0,0 +1,245 @@
+/***********************************************************************
+*
+*  FILE        : r_clkstage.c
+*  DESCRIPTION : Staged clock bring-up.
+*
+*  NOTE: The register settings are those of operating_frequency_set()
+*        and clock_source_select() in resetprg.c; only the waits move.
+*
+***********************************************************************/
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include "platform.h"
+#include "r_clkstage.h"
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+#if (BSP_CFG_CLOCK_SOURCE > 4) || (BSP_CFG_CLOCK_SOURCE < 0)
+    #error "Error! Invalid setting for BSP_CFG_CLOCK_SOURCE in r_bsp_config.h"
+#endif
+
+/* SCKCR divider field for a divisor of 1, 2, 4 ... 64. */
+#define CLKSTAGE_DIV(div)       (((div) >= 64) ? 6UL : ((div) >= 32) ? 5UL : ((div) >= 16) ? 4UL : \
+                                 ((div) >= 8) ? 3UL : ((div) >= 4) ? 2UL : ((div) >= 2) ? 1UL : 0UL)
+
+#if BSP_CFG_BCLK_OUTPUT == 0
+#define CLKSTAGE_PSTOP1         (0x00800000UL)      /* BCLK output disabled */
+#else
+#define CLKSTAGE_PSTOP1         (0x00000000UL)
+#endif
+
+#define CLKSTAGE_SCKCR          ((CLKSTAGE_DIV(BSP_CFG_FCK_DIV) << 28) | (CLKSTAGE_DIV(BSP_CFG_ICK_DIV) << 24) | \
+                                 CLKSTAGE_PSTOP1 | (CLKSTAGE_DIV(BSP_CFG_BCK_DIV) << 16) | \
+                                 (CLKSTAGE_DIV(BSP_CFG_PCKA_DIV) << 12) | (CLKSTAGE_DIV(BSP_CFG_PCKB_DIV) << 8) | \
+                                 CLKSTAGE_DIV(BSP_CFG_PCKD_DIV))
+
+/* PRCR key and the PRC0 bit that guards the clock generation registers. */
+#define CLKSTAGE_PRCR_KEY       (0xA500U)
+#define CLKSTAGE_PRCR_PRC0      (0x0001U)
+#define CLKSTAGE_PRCR_BITS      (0x000FU)
+
+/***********************************************************************************************************************
+* Function Name: R_CLKSTAGE_Start
+* Description  : Selects the operating mode and starts the oscillators of the configured clock source, without waiting
+*                for them to stabilize. The PLL is configured but not started; R_CLKSTAGE_Poll() starts it once the
+*                main clock is stable. Called by PowerON_Reset_PC in place of operating_frequency_set().
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+void R_CLKSTAGE_Start(void)
+{
+#if (BSP_CFG_CLOCK_SOURCE == 3) || (BSP_CFG_LPT_CLOCK_SOURCE == 0)
+    /* Declared volatile for software delay purposes. */
+    volatile uint32_t i;
+#endif
+
+    SYSTEM.PRCR.WORD = 0xA50BU;
+
+    /* High-speed operating mode above 12 MHz and memory wait states above 32 MHz: both may be set while the CPU
+       still runs from the LOCO. */
+    if ((BSP_ICLK_HZ > BSP_MIDDLE_SPEED_MAX_FREQUENCY) || (BSP_PCLKA_HZ > BSP_MIDDLE_SPEED_MAX_FREQUENCY) ||
+        (BSP_PCLKB_HZ > BSP_MIDDLE_SPEED_MAX_FREQUENCY) || (BSP_PCLKD_HZ > BSP_MIDDLE_SPEED_MAX_FREQUENCY) ||
+        (BSP_FCLK_HZ > BSP_MIDDLE_SPEED_MAX_FREQUENCY) || (BSP_BCLK_HZ > BSP_MIDDLE_SPEED_MAX_FREQUENCY))
+    {
+        SYSTEM.OPCCR.BYTE = 0x00U;
+        while (1U == SYSTEM.OPCCR.BIT.OPCMTSF)
+        {
+            /* Wait for the transition to finish. */
+        }
+    }
+    if (BSP_ICLK_HZ > BSP_MEMORY_NO_WAIT_MAX_FREQUENCY)
+    {
+        SYSTEM.MEMWAIT.BYTE = 0x01U;
+        while (0x01U != SYSTEM.MEMWAIT.BYTE)
+        {
+            /* Wait for the bit to set. */
+        }
+    }
+
+    /* Main clock oscillator drive capability. */
+    if ((BSP_CFG_MCU_VCC_MV >= 2400) && (BSP_CFG_XTAL_HZ >= 10000000))
+    {
+        SYSTEM.MOFCR.BIT.MODRV21 = 1U;
+    }
+    else
+    {
+        SYSTEM.MOFCR.BIT.MODRV21 = 0U;
+    }
+
+#if (BSP_CFG_CLOCK_SOURCE == 1)
+    /* The HOCO frequency may only be changed while it is stopped. */
+    SYSTEM.HOCOCR.BYTE = 0x01U;
+    SYSTEM.HOCOCR2.BIT.HCFRQ = BSP_CFG_HOCO_FREQUENCY;
+    SYSTEM.HOCOCR.BYTE = 0x00U;
+#else
+    SYSTEM.HOCOCR.BYTE = 0x01U;
+#endif
+
+#if (BSP_CFG_CLOCK_SOURCE == 2) || (BSP_CFG_CLOCK_SOURCE == 4) || (BSP_CFG_USB_CLOCK_SOURCE == 1)
+    SYSTEM.MOSCWTCR.BYTE = 0x04U;
+    SYSTEM.MOSCCR.BYTE = 0x00U;
+#if (BSP_CFG_USB_CLOCK_SOURCE == 1)
+    /* usb_lpc_clock_source_select() starts the USB PLL from the main clock straight after. */
+    while (1U != SYSTEM.OSCOVFSR.BIT.MOOVF)
+    {
+        nop();
+    }
+#endif
+#else
+    SYSTEM.MOSCCR.BYTE = 0x01U;
+#endif
+
+#if (BSP_CFG_CLOCK_SOURCE == 3) || (BSP_CFG_LPT_CLOCK_SOURCE == 0)
+    /* The sub-clock has no stabilization flag, so it keeps the fixed delays of clock_source_select(). */
+    SYSTEM.SOSCCR.BYTE = 0x01U;
+    while (0x01U != SYSTEM.SOSCCR.BYTE)
+    {
+        /* Wait for the bit to change. */
+    }
+    RTC.RCR3.BIT.RTCEN = 0U;
+    while (0U != RTC.RCR3.BIT.RTCEN)
+    {
+        /* Wait for the bit to change. */
+    }
+    for (i = 0; i < 88; i++)
+    {
+        nop();
+    }
+    RTC.RCR3.BIT.RTCDV = 0x01U;
+    while (0x01U != RTC.RCR3.BIT.RTCDV)
+    {
+        /* Wait for the bits to change. */
+    }
+    SYSTEM.SOSCCR.BYTE = 0x00U;
+    while (0x00U != SYSTEM.SOSCCR.BYTE)
+    {
+        /* Wait for the bit to change. */
+    }
+    R_BSP_SoftwareDelay(1482, BSP_DELAY_MILLISECS);
+    RTC.RCR3.BIT.RTCEN = 0x01U;
+    while (0x01U != RTC.RCR3.BIT.RTCEN)
+    {
+        /* Wait for the bit to change. */
+    }
+#else
+    SYSTEM.SOSCCR.BYTE = 0x01U;
+#endif
+
+#if (BSP_CFG_CLOCK_SOURCE == 4)
+    SYSTEM.PLLCR.BIT.PLIDIV = BSP_CFG_PLL_DIV >> 1;
+    SYSTEM.PLLCR.BIT.STC = ((uint8_t)((float)BSP_CFG_PLL_MUL * 2.0)) - 1;
+#endif
+    SYSTEM.PLLCR2.BYTE = 0x01U;
+
+#if (BSP_CFG_CLOCK_SOURCE == 0)
+    SYSTEM.LOCOCR.BYTE = 0x00U;
+#endif
+
+    SYSTEM.PRCR.WORD = 0xA500U;
+}
+/***********************************************************************************************************************
+End of function R_CLKSTAGE_Start
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_CLKSTAGE_Poll
+* Description  : Reads the stage of the bring-up and, once the main clock is stable, starts the PLL. Never waits, so
+*                it may be called between any start-up steps; the register protection is left as it was.
+* Arguments    : none
+* Return Value : Stage.
+***********************************************************************************************************************/
+clkstage_state_t R_CLKSTAGE_Poll(void)
+{
+#if (BSP_CFG_CLOCK_SOURCE == 4)
+    uint16_t prcr;
+#endif
+
+    if (BSP_CFG_CLOCK_SOURCE == SYSTEM.SCKCR3.BIT.CKSEL)
+    {
+        return CLKSTAGE_STATE_DONE;
+    }
+
+#if (BSP_CFG_CLOCK_SOURCE == 1)
+    return (1U == SYSTEM.OSCOVFSR.BIT.HCOVF) ? CLKSTAGE_STATE_READY : CLKSTAGE_STATE_HOCO;
+#elif (BSP_CFG_CLOCK_SOURCE == 2)
+    return (1U == SYSTEM.OSCOVFSR.BIT.MOOVF) ? CLKSTAGE_STATE_READY : CLKSTAGE_STATE_MAIN;
+#elif (BSP_CFG_CLOCK_SOURCE == 4)
+    if (1U == SYSTEM.PLLCR2.BIT.PLLEN)
+    {
+        if (1U != SYSTEM.OSCOVFSR.BIT.MOOVF)
+        {
+            return CLKSTAGE_STATE_MAIN;
+        }
+        prcr = (uint16_t)(SYSTEM.PRCR.WORD & CLKSTAGE_PRCR_BITS);
+        SYSTEM.PRCR.WORD = (uint16_t)(CLKSTAGE_PRCR_KEY | CLKSTAGE_PRCR_PRC0 | prcr);
+        SYSTEM.PLLCR2.BYTE = 0x00U;
+        SYSTEM.PRCR.WORD = (uint16_t)(CLKSTAGE_PRCR_KEY | prcr);
+    }
+    return (1U == SYSTEM.OSCOVFSR.BIT.PLOVF) ? CLKSTAGE_STATE_READY : CLKSTAGE_STATE_PLL;
+#else
+    /* The LOCO runs from reset and the sub-clock was waited for in R_CLKSTAGE_Start(). */
+    return CLKSTAGE_STATE_READY;
+#endif
+}
+/***********************************************************************************************************************
+End of function R_CLKSTAGE_Poll
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_CLKSTAGE_Finish
+* Description  : Waits for the clock source to stabilize, sets the clock dividers and switches to it, then stops the
+*                LOCO if it is not the clock source.
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+void R_CLKSTAGE_Finish(void)
+{
+    while (R_CLKSTAGE_Poll() < CLKSTAGE_STATE_READY)
+    {
+        nop();
+    }
+
+    SYSTEM.PRCR.WORD = 0xA50BU;
+
+#if BSP_CFG_BCLK_OUTPUT == 2
+    SYSTEM.BCKCR.BIT.BCLKDIV = 1U;
+#endif
+    SYSTEM.SCKCR.LONG = CLKSTAGE_SCKCR;
+    while (CLKSTAGE_SCKCR != SYSTEM.SCKCR.LONG)
+    {
+        /* The hardware manual asks for the write to be read back before the clock is switched. */
+    }
+
+    SYSTEM.SCKCR3.WORD = (uint16_t)(((uint16_t)BSP_CFG_CLOCK_SOURCE) << 8);
+#if (BSP_CFG_CLOCK_SOURCE != 0)
+    SYSTEM.LOCOCR.BYTE = 0x01U;
+#endif
+
+    SYSTEM.PRCR.WORD = 0xA500U;
+}
+/***********************************************************************************************************************
+End of function R_CLKSTAGE_Finish
+***********************************************************************************************************************/
@@ -0,0 +1,67 @@
+/***********************************************************************
+*
+*  FILE        : r_clkstage.h
+*  DESCRIPTION : Staged clock bring-up: the oscillators stabilize
+*                while PowerON_Reset_PC initializes the sections.
+*
+*  NOTE: R_CLKSTAGE_Start() in place of operating_frequency_set()
+*        starts the oscillators of the configured clock source and
+*        returns without waiting for them; the CPU stays on the LOCO
+*        it runs from at reset. R_CLKSTAGE_Poll() advances the
+*        bring-up without blocking (the PLL is started once the main
+*        clock is stable) and R_CLKSTAGE_Finish() waits for what is
+*        left, then sets the dividers and switches SCKCR3.CKSEL, in
+*        the order operating_frequency_set() does.
+*        The stage is read back from the clock registers, so the
+*        bring-up keeps no data and is not disturbed by _INITSCT().
+*        Work before Finish runs at the LOCO, so only clock-
+*        independent work belongs there: the sub-clock, and the main
+*        clock when the USB PLL needs it, are still waited for in
+*        Start.
+*        With CLKSTAGE_CFG_ENABLE 0 PowerON_Reset_PC is unchanged.
+*
+***********************************************************************/
+
+#ifndef R_CLKSTAGE_H
+#define R_CLKSTAGE_H
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <stdint.h>
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* 1 for PowerON_Reset_PC to switch the clock after the section initialization, 0 to switch it first. */
+#ifndef CLKSTAGE_CFG_ENABLE
+#define CLKSTAGE_CFG_ENABLE         (0)
+#endif
+
+#if CLKSTAGE_CFG_ENABLE == 1
+#define CLKSTAGE_POLL()             ((void)R_CLKSTAGE_Poll())
+#else
+#define CLKSTAGE_POLL()
+#endif
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+/* Bring-up stages, in order. */
+typedef enum e_clkstage_state
+{
+    CLKSTAGE_STATE_MAIN = 0,        /* Waiting for the main clock oscillator */
+    CLKSTAGE_STATE_PLL,             /* Waiting for the PLL */
+    CLKSTAGE_STATE_HOCO,            /* Waiting for the HOCO */
+    CLKSTAGE_STATE_READY,           /* The clock source is stable, the CPU still runs from the LOCO */
+    CLKSTAGE_STATE_DONE             /* The clock source is selected */
+} clkstage_state_t;
+
+/***********************************************************************************************************************
+Exported global functions (to be accessed by other files)
+***********************************************************************************************************************/
+void             R_CLKSTAGE_Start(void);
+clkstage_state_t R_CLKSTAGE_Poll(void);
+void             R_CLKSTAGE_Finish(void);
+
+#endif /* R_CLKSTAGE_H */
@@ -0,0 +1,742 @@
+/***********************************************************************
+*
+*  FILE        : r_clock.c
+*  DESCRIPTION : Clock registry.
+*
+*  NOTE: The frequencies are decoded as get_iclk_freq_hz() in
+*        mcu_clocks.c decodes ICLK: the source frequency shifted right
+*        by each SCKCR divider field.
+*        The delay rates are ICLK / (units * BSP_DELAY_LOOP_CYCLES),
+*        the only divisions left in a software delay, made here once
+*        per ICLK change.
+*        R_CLOCK_SetPerformance() moves between the operating modes in
+*        steps: out of low-speed operation through middle-speed, into
+*        high-speed operation before MEMWAIT is set, and back in the
+*        reverse order, each step waiting for OPCMTSF or SOPCMTSF.
+*
+***********************************************************************/
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include "platform.h"
+#include "r_clock.h"
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* SCKCR divider fields: 4 bits each, 0 to 6 for a divider of 1 to 64. */
+#define CLOCK_DIV_FIELD         (0x0FUL)
+#define CLOCK_DIV_MAX           (64U)
+
+/* PRCR key, the PRC0 bit that guards the clock generation registers and the PRC1 bit that guards OPCCR, SOPCCR and
+   MEMWAIT. */
+#define CLOCK_PRCR_KEY          (0xA500U)
+#define CLOCK_PRCR_PRC0         (0x0001U)
+#define CLOCK_PRCR_PRC1         (0x0002U)
+#define CLOCK_PRCR_BITS         (0x000FU)
+
+/* HOCOCR2.HCFRQ setting for the 54 MHz HOCO; the others run it at 32 MHz. */
+#define CLOCK_HCFRQ_54MHZ       (3U)
+#define CLOCK_HOCO_54MHZ        (54000000UL)
+#define CLOCK_HOCO_32MHZ        (32000000UL)
+
+/* OPCCR.OPCM and SOPCCR.SOPCM settings below high-speed operation, and the fastest clock of high-speed operation. */
+#define CLOCK_OPCM_MIDDLE       (2U)
+#define CLOCK_SOPCM_LOW         (1U)
+#define CLOCK_OPCM_HIGH         (0U)
+#define CLOCK_SOPCM_MIDDLE      (0U)
+#define CLOCK_HIGH_SPEED_MAX_HZ (54000000UL)
+
+/* Operating modes, fastest first. */
+#define CLOCK_MODE_HIGH         (0U)
+#define CLOCK_MODE_MIDDLE       (1U)
+#define CLOCK_MODE_LOW          (2U)
+
+/* Main clock oscillator wait control, as R_CLKSTAGE_Start() sets it, and the time given to the LOCO, which has no
+   stabilization flag, when it is restarted. */
+#define CLOCK_MOSCWTCR          (0x04U)
+#define CLOCK_LOCO_WAIT_US      (62U)
+
+/* R_BSP_SoftwareDelay() units: microseconds, milliseconds and seconds. */
+#define CLOCK_DELAY_UNITS       (3U)
+
+/***********************************************************************************************************************
+Private global variables and functions
+***********************************************************************************************************************/
+/* Read before _INITSCT(), so it must be in a section that _INITSCT() leaves alone. */
+#if defined(RX_HOST_BUILD)
+static uint32_t     s_hz[CLOCKS] __attribute__((section("rx_noinit")));
+static clock_rate_t s_delay_rate[CLOCK_DELAY_UNITS] __attribute__((section("rx_noinit")));
+#else
+#pragma section B CLOCK
+static uint32_t     s_hz[CLOCKS];
+static clock_rate_t s_delay_rate[CLOCK_DELAY_UNITS];
+#pragma section
+#endif
+
+static clock_subscriber_t *s_p_subscribers;
+
+/* Position of each clock's divider field in SCKCR. */
+static const uint8_t s_div_shift[CLOCKS] =
+{
+    24U,    /* ICK */
+    12U,    /* PCKA */
+    8U,     /* PCKB */
+    0U,     /* PCKD */
+    28U,    /* FCK */
+    16U     /* BCK */
+};
+
+/* Units of each delay rate. */
+static const uint32_t s_delay_units[CLOCK_DELAY_UNITS] =
+{
+    (uint32_t)BSP_DELAY_MICROSECS,
+    (uint32_t)BSP_DELAY_MILLISECS,
+    (uint32_t)BSP_DELAY_SECS
+};
+
+static clock_err_t clock_setting_decode(const clock_setting_t *p_setting, uint32_t *p_sckcr, uint32_t *p_hz);
+static void     clock_decode(uint32_t source, uint32_t sckcr, uint32_t *p_hz);
+static bool     clock_is_stable(uint32_t source);
+static bool     clock_start(uint32_t source);
+static uint32_t clock_mode(void);
+static uint32_t clock_mode_for(uint32_t source, const uint32_t *p_hz);
+static void     clock_mode_set(uint32_t mode);
+static uint32_t clock_mode_max_hz(void);
+static void     clock_delay_rates(uint32_t iclk_hz);
+
+/***********************************************************************************************************************
+* Function Name: R_CLOCK_Refresh
+* Description  : Decodes the clock registers into the registry without calling the subscribers. For PowerON_Reset_PC,
+*                which switches the clock itself, and for code that has changed the clock registers directly.
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+void R_CLOCK_Refresh(void)
+{
+    clock_decode(SYSTEM.SCKCR3.BIT.CKSEL, SYSTEM.SCKCR.LONG, s_hz);
+    clock_delay_rates(s_hz[CLOCK_ICLK]);
+}
+/***********************************************************************************************************************
+End of function R_CLOCK_Refresh
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_CLOCK_GetHz
+* Description  : Returns the frequency of a clock.
+* Arguments    : clock -
+*                    Clock.
+* Return Value : Frequency in Hz, or 0 for an invalid clock.
+***********************************************************************************************************************/
+uint32_t R_CLOCK_GetHz(clock_id_t clock)
+{
+    return ((uint32_t)clock < CLOCKS) ? s_hz[clock] : 0U;
+}
+/***********************************************************************************************************************
+End of function R_CLOCK_GetHz
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_CLOCK_GetDelayRate
+* Description  : Returns the delayWait() loops per unit of time at the current ICLK, for R_BSP_SoftwareDelay().
+* Arguments    : units -
+*                    BSP_DELAY_MICROSECS, BSP_DELAY_MILLISECS or BSP_DELAY_SECS.
+* Return Value : Loops per unit, or NULL for other units.
+***********************************************************************************************************************/
+const clock_rate_t *R_CLOCK_GetDelayRate(uint32_t units)
+{
+    uint32_t i;
+
+    for (i = 0; i < CLOCK_DELAY_UNITS; i++)
+    {
+        if (units == s_delay_units[i])
+        {
+            return &s_delay_rate[i];
+        }
+    }
+
+    return NULL;
+}
+/***********************************************************************************************************************
+End of function R_CLOCK_GetDelayRate
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_CLOCK_Switch
+* Description  : Sets the clock dividers and selects the clock source, updates the registry and calls each subscriber
+*                with the clocks that changed, just before the switch as well as after it. The source must already be
+*                running and stable, and the operating mode and flash wait states must allow the new frequencies; the
+*                clock is left as it was otherwise. The register protection is left as it was.
+* Arguments    : p_setting -
+*                    Source and dividers.
+* Return Value : CLOCK_SUCCESS, or the reason the clock was not switched.
+***********************************************************************************************************************/
+clock_err_t R_CLOCK_Switch(const clock_setting_t *p_setting)
+{
+    uint32_t           hz[CLOCKS];
+    uint32_t           between[CLOCKS];
+    uint32_t           sckcr;
+    uint32_t           changed = 0U;
+    uint32_t           fastest = 0U;
+    uint32_t           i;
+    uint16_t           prcr;
+    clock_err_t        err;
+    clock_subscriber_t *p_sub;
+
+    err = clock_setting_decode(p_setting, &sckcr, hz);
+    if (CLOCK_SUCCESS != err)
+    {
+        return err;
+    }
+    if (false == clock_is_stable((uint32_t)p_setting->source))
+    {
+        return CLOCK_ERR_NOT_STABLE;
+    }
+    for (i = 0; i < CLOCKS; i++)
+    {
+        fastest = (hz[i] > fastest) ? hz[i] : fastest;
+    }
+    if ((fastest > clock_mode_max_hz()) ||
+        ((hz[CLOCK_ICLK] > BSP_MEMORY_NO_WAIT_MAX_FREQUENCY) && (0x01U != SYSTEM.MEMWAIT.BYTE)))
+    {
+        return CLOCK_ERR_MODE;
+    }
+
+    for (i = 0; i < CLOCKS; i++)
+    {
+        if (hz[i] != s_hz[i])
+        {
+            changed |= CLOCK_BIT(i);
+        }
+    }
+    if (0U != changed)
+    {
+        for (p_sub = s_p_subscribers; NULL != p_sub; p_sub = p_sub->p_next)
+        {
+            p_sub->p_callback(CLOCK_BEFORE | changed, p_sub->p_context);
+        }
+    }
+
+    /* Between the two writes the clocks are no faster than before or after them: the dividers first to a faster
+       source, the source first to a slower one. */
+    clock_decode(SYSTEM.SCKCR3.BIT.CKSEL, sckcr, between);
+    prcr = (uint16_t)(SYSTEM.PRCR.WORD & CLOCK_PRCR_BITS);
+    SYSTEM.PRCR.WORD = (uint16_t)(CLOCK_PRCR_KEY | CLOCK_PRCR_PRC0 | prcr);
+    if (between[CLOCK_ICLK] > hz[CLOCK_ICLK])
+    {
+        SYSTEM.SCKCR3.WORD = (uint16_t)((uint16_t)p_setting->source << 8);
+    }
+    SYSTEM.SCKCR.LONG = sckcr;
+    while (sckcr != SYSTEM.SCKCR.LONG)
+    {
+        /* The hardware manual asks for the write to be read back before the clock is switched. */
+    }
+    SYSTEM.SCKCR3.WORD = (uint16_t)((uint16_t)p_setting->source << 8);
+    SYSTEM.PRCR.WORD = (uint16_t)(CLOCK_PRCR_KEY | prcr);
+
+    for (i = 0; i < CLOCKS; i++)
+    {
+        s_hz[i] = hz[i];
+    }
+    if (0U != (changed & CLOCK_BIT(CLOCK_ICLK)))
+    {
+        clock_delay_rates(s_hz[CLOCK_ICLK]);
+    }
+    if (0U != changed)
+    {
+        for (p_sub = s_p_subscribers; NULL != p_sub; p_sub = p_sub->p_next)
+        {
+            p_sub->p_callback(changed, p_sub->p_context);
+        }
+    }
+
+    return CLOCK_SUCCESS;
+}
+/***********************************************************************************************************************
+End of function R_CLOCK_Switch
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_CLOCK_SetPerformance
+* Description  : Switches the clock as R_CLOCK_Switch() does, after starting its source and waiting for it to
+*                stabilize, and moves to the slowest operating mode and the fewest flash wait states the new clock
+*                allows: the mode is raised before the switch and lowered after it. Low-speed operation is chosen
+*                for the sub-clock. The PLL is stopped once it is no longer the source. Not for interrupt context;
+*                the register protection is left as it was.
+* Arguments    : p_setting -
+*                    Source and dividers.
+* Return Value : CLOCK_SUCCESS, CLOCK_ERR_NULL_PTR, CLOCK_ERR_INVALID_ARG, CLOCK_ERR_NOT_STABLE if the source is the
+*                sub-clock and it is stopped, or CLOCK_ERR_MODE if a clock is above 54 MHz.
+***********************************************************************************************************************/
+clock_err_t R_CLOCK_SetPerformance(const clock_setting_t *p_setting)
+{
+    uint32_t    hz[CLOCKS];
+    uint32_t    sckcr;
+    uint32_t    mode;
+    uint32_t    i;
+    uint16_t    prcr;
+    clock_err_t err;
+
+    err = clock_setting_decode(p_setting, &sckcr, hz);
+    if (CLOCK_SUCCESS != err)
+    {
+        return err;
+    }
+    for (i = 0; i < CLOCKS; i++)
+    {
+        if (hz[i] > CLOCK_HIGH_SPEED_MAX_HZ)
+        {
+            return CLOCK_ERR_MODE;
+        }
+    }
+
+    prcr = (uint16_t)(SYSTEM.PRCR.WORD & CLOCK_PRCR_BITS);
+    SYSTEM.PRCR.WORD = (uint16_t)(CLOCK_PRCR_KEY | CLOCK_PRCR_PRC0 | CLOCK_PRCR_PRC1 | prcr);
+    if (false == clock_start((uint32_t)p_setting->source))
+    {
+        SYSTEM.PRCR.WORD = (uint16_t)(CLOCK_PRCR_KEY | prcr);
+        return CLOCK_ERR_NOT_STABLE;
+    }
+
+    /* Up to a mode no slower than both clocks need, then wait states if the new ICLK needs them. */
+    mode = clock_mode_for((uint32_t)p_setting->source, hz);
+    if (mode < clock_mode())
+    {
+        clock_mode_set(mode);
+    }
+    if ((hz[CLOCK_ICLK] > BSP_MEMORY_NO_WAIT_MAX_FREQUENCY) && (0x01U != SYSTEM.MEMWAIT.BYTE))
+    {
+        SYSTEM.MEMWAIT.BYTE = 0x01U;
+        while (0x01U != SYSTEM.MEMWAIT.BYTE)
+        {
+            /* Wait for the bit to set. */
+        }
+    }
+
+    err = R_CLOCK_Switch(p_setting);
+
+    /* Down to what the clock now running needs, whether or not it changed. */
+    if ((s_hz[CLOCK_ICLK] <= BSP_MEMORY_NO_WAIT_MAX_FREQUENCY) && (0x00U != SYSTEM.MEMWAIT.BYTE))
+    {
+        SYSTEM.MEMWAIT.BYTE = 0x00U;
+        while (0x00U != SYSTEM.MEMWAIT.BYTE)
+        {
+            /* Wait for the bit to clear. */
+        }
+    }
+    mode = clock_mode_for(SYSTEM.SCKCR3.BIT.CKSEL, s_hz);
+    if (mode > clock_mode())
+    {
+        clock_mode_set(mode);
+    }
+    if ((CLOCK_SOURCE_PLL != SYSTEM.SCKCR3.BIT.CKSEL) && (0U == SYSTEM.PLLCR2.BIT.PLLEN))
+    {
+        SYSTEM.PLLCR2.BYTE = 0x01U;
+    }
+
+    SYSTEM.PRCR.WORD = (uint16_t)(CLOCK_PRCR_KEY | prcr);
+
+    return err;
+}
+/***********************************************************************************************************************
+End of function R_CLOCK_SetPerformance
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_CLOCK_Subscribe
+* Description  : Adds a subscriber, called just before and after each clock switch that changes a frequency, after
+*                those added before it. Not for interrupt context.
+* Arguments    : p_subscriber -
+*                    Subscriber, in memory that stays valid until it is removed.
+*                p_callback -
+*                    Called with the CLOCK_BIT() mask of the clocks that change, with CLOCK_BEFORE before the switch,
+*                    and p_context.
+*                p_context -
+*                    Passed to the callback.
+* Return Value : CLOCK_SUCCESS, CLOCK_ERR_NULL_PTR, or CLOCK_ERR_INVALID_ARG if it is already subscribed.
+***********************************************************************************************************************/
+clock_err_t R_CLOCK_Subscribe(clock_subscriber_t *p_subscriber, r_clock_callback_t p_callback, void *p_context)
+{
+    clock_subscriber_t **pp_link = &s_p_subscribers;
+
+    if ((NULL == p_subscriber) || (NULL == p_callback))
+    {
+        return CLOCK_ERR_NULL_PTR;
+    }
+    for (; NULL != *pp_link; pp_link = &(*pp_link)->p_next)
+    {
+        if (p_subscriber == *pp_link)
+        {
+            return CLOCK_ERR_INVALID_ARG;
+        }
+    }
+
+    p_subscriber->p_next = NULL;
+    p_subscriber->p_callback = p_callback;
+    p_subscriber->p_context = p_context;
+    *pp_link = p_subscriber;
+
+    return CLOCK_SUCCESS;
+}
+/***********************************************************************************************************************
+End of function R_CLOCK_Subscribe
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_CLOCK_Unsubscribe
+* Description  : Removes a subscriber. Not for interrupt context.
+* Arguments    : p_subscriber -
+*                    Subscriber.
+* Return Value : CLOCK_SUCCESS, CLOCK_ERR_NULL_PTR, or CLOCK_ERR_INVALID_ARG if it is not subscribed.
+***********************************************************************************************************************/
+clock_err_t R_CLOCK_Unsubscribe(clock_subscriber_t *p_subscriber)
+{
+    clock_subscriber_t **pp_link = &s_p_subscribers;
+
+    if (NULL == p_subscriber)
+    {
+        return CLOCK_ERR_NULL_PTR;
+    }
+    for (; NULL != *pp_link; pp_link = &(*pp_link)->p_next)
+    {
+        if (p_subscriber == *pp_link)
+        {
+            *pp_link = p_subscriber->p_next;
+            p_subscriber->p_next = NULL;
+            return CLOCK_SUCCESS;
+        }
+    }
+
+    return CLOCK_ERR_INVALID_ARG;
+}
+/***********************************************************************************************************************
+End of function R_CLOCK_Unsubscribe
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: clock_setting_decode
+* Description  : Checks a setting and decodes it.
+* Arguments    : p_setting -
+*                    Source and dividers.
+*                p_sckcr -
+*                    Receives the SCKCR value: the current one with the divider fields of the setting.
+*                p_hz -
+*                    Receives the frequencies, in Hz.
+* Return Value : CLOCK_SUCCESS, CLOCK_ERR_NULL_PTR, or CLOCK_ERR_INVALID_ARG for an invalid source or divider, or
+*                ICLK below FCLK, PCLKB or BCLK.
+***********************************************************************************************************************/
+static clock_err_t clock_setting_decode(const clock_setting_t *p_setting, uint32_t *p_sckcr, uint32_t *p_hz)
+{
+    uint32_t sckcr;
+    uint32_t field;
+    uint32_t i;
+
+    if (NULL == p_setting)
+    {
+        return CLOCK_ERR_NULL_PTR;
+    }
+    if ((uint32_t)p_setting->source > (uint32_t)CLOCK_SOURCE_PLL)
+    {
+        return CLOCK_ERR_INVALID_ARG;
+    }
+
+    /* Keep the PSTOP bits; build the divider fields. */
+    sckcr = SYSTEM.SCKCR.LONG;
+    for (i = 0; i < CLOCKS; i++)
+    {
+        if ((0U == p_setting->div[i]) || (p_setting->div[i] > CLOCK_DIV_MAX) ||
+            (0U != (p_setting->div[i] & (p_setting->div[i] - 1U))))
+        {
+            return CLOCK_ERR_INVALID_ARG;
+        }
+        for (field = 0U; (1U << field) < p_setting->div[i]; field++)
+        {
+            /* log2 of the divider */
+        }
+        sckcr &= ~(CLOCK_DIV_FIELD << s_div_shift[i]);
+        sckcr |= field << s_div_shift[i];
+    }
+
+    clock_decode((uint32_t)p_setting->source, sckcr, p_hz);
+    if ((p_hz[CLOCK_ICLK] < p_hz[CLOCK_FCLK]) || (p_hz[CLOCK_ICLK] < p_hz[CLOCK_PCLKB]) ||
+        (p_hz[CLOCK_ICLK] < p_hz[CLOCK_BCLK]))
+    {
+        return CLOCK_ERR_INVALID_ARG;
+    }
+
+    *p_sckcr = sckcr;
+    return CLOCK_SUCCESS;
+}
+/***********************************************************************************************************************
+End of function clock_setting_decode
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: clock_decode
+* Description  : Decodes the frequency of every clock from a clock source and an SCKCR value.
+* Arguments    : source -
+*                    SCKCR3.CKSEL value.
+*                sckcr -
+*                    SCKCR value.
+*                p_hz -
+*                    Receives the frequencies, in Hz.
+* Return Value : none
+***********************************************************************************************************************/
+static void clock_decode(uint32_t source, uint32_t sckcr, uint32_t *p_hz)
+{
+    uint32_t source_hz;
+    uint32_t i;
+
+    switch (source)
+    {
+        case CLOCK_SOURCE_HOCO:
+            source_hz = (CLOCK_HCFRQ_54MHZ == SYSTEM.HOCOCR2.BIT.HCFRQ) ? CLOCK_HOCO_54MHZ : CLOCK_HOCO_32MHZ;
+            break;
+        case CLOCK_SOURCE_MAIN:
+            source_hz = BSP_CFG_XTAL_HZ;
+            break;
+        case CLOCK_SOURCE_SUB:
+            source_hz = BSP_SUB_CLOCK_HZ;
+            break;
+        case CLOCK_SOURCE_PLL:
+            /* Main clock divided by 1, 2 or 4, multiplied by (STC + 1) / 2. */
+            source_hz = (((uint32_t)BSP_CFG_XTAL_HZ >> SYSTEM.PLLCR.BIT.PLIDIV) * (SYSTEM.PLLCR.BIT.STC + 1U)) / 2U;
+            break;
+        default:
+            source_hz = BSP_LOCO_HZ;
+            break;
+    }
+
+    for (i = 0; i < CLOCKS; i++)
+    {
+        p_hz[i] = source_hz >> ((sckcr >> s_div_shift[i]) & CLOCK_DIV_FIELD);
+    }
+}
+/***********************************************************************************************************************
+End of function clock_decode
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: clock_is_stable
+* Description  : Checks that a clock source runs and, if it has a stabilization flag, that the flag is set.
+* Arguments    : source -
+*                    SCKCR3.CKSEL value.
+* Return Value : true if it can be selected.
+***********************************************************************************************************************/
+static bool clock_is_stable(uint32_t source)
+{
+    switch (source)
+    {
+        case CLOCK_SOURCE_HOCO:
+            return (0U == SYSTEM.HOCOCR.BIT.HCSTP) && (1U == SYSTEM.OSCOVFSR.BIT.HCOVF);
+        case CLOCK_SOURCE_MAIN:
+            return (0U == SYSTEM.MOSCCR.BIT.MOSTP) && (1U == SYSTEM.OSCOVFSR.BIT.MOOVF);
+        case CLOCK_SOURCE_SUB:
+            return (0U == SYSTEM.SOSCCR.BIT.SOSTP);
+        case CLOCK_SOURCE_PLL:
+            return (0U == SYSTEM.PLLCR2.BIT.PLLEN) && (1U == SYSTEM.OSCOVFSR.BIT.PLOVF);
+        default:
+            return (0U == SYSTEM.LOCOCR.BIT.LCSTP);
+    }
+}
+/***********************************************************************************************************************
+End of function clock_is_stable
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: clock_start
+* Description  : Starts a clock source if it is stopped and waits for it to stabilize; the PLL after the main clock.
+*                The sub-clock is not started here, as it takes seconds and the RTC with it.
+* Arguments    : source -
+*                    SCKCR3.CKSEL value.
+* Return Value : false if the source is the sub-clock and it is stopped.
+***********************************************************************************************************************/
+static bool clock_start(uint32_t source)
+{
+    switch (source)
+    {
+        case CLOCK_SOURCE_HOCO:
+            SYSTEM.HOCOCR.BYTE = 0x00U;
+            while (1U != SYSTEM.OSCOVFSR.BIT.HCOVF)
+            {
+                nop();
+            }
+            break;
+        case CLOCK_SOURCE_MAIN:
+        case CLOCK_SOURCE_PLL:
+            if (1U == SYSTEM.MOSCCR.BIT.MOSTP)
+            {
+                SYSTEM.MOSCWTCR.BYTE = CLOCK_MOSCWTCR;
+                SYSTEM.MOSCCR.BYTE = 0x00U;
+            }
+            while (1U != SYSTEM.OSCOVFSR.BIT.MOOVF)
+            {
+                nop();
+            }
+            if (CLOCK_SOURCE_PLL == source)
+            {
+                SYSTEM.PLLCR2.BYTE = 0x00U;
+                while (1U != SYSTEM.OSCOVFSR.BIT.PLOVF)
+                {
+                    nop();
+                }
+            }
+            break;
+        case CLOCK_SOURCE_SUB:
+            return (0U == SYSTEM.SOSCCR.BIT.SOSTP);
+        default:
+            if (1U == SYSTEM.LOCOCR.BIT.LCSTP)
+            {
+                SYSTEM.LOCOCR.BYTE = 0x00U;
+                R_BSP_SoftwareDelay(CLOCK_LOCO_WAIT_US, BSP_DELAY_MICROSECS);
+            }
+            break;
+    }
+
+    return true;
+}
+/***********************************************************************************************************************
+End of function clock_start
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: clock_mode
+* Description  : Returns the current operating mode.
+* Arguments    : none
+* Return Value : CLOCK_MODE_HIGH, CLOCK_MODE_MIDDLE or CLOCK_MODE_LOW.
+***********************************************************************************************************************/
+static uint32_t clock_mode(void)
+{
+    if (CLOCK_SOPCM_LOW == SYSTEM.SOPCCR.BIT.SOPCM)
+    {
+        return CLOCK_MODE_LOW;
+    }
+
+    return (CLOCK_OPCM_MIDDLE == SYSTEM.OPCCR.BIT.OPCM) ? CLOCK_MODE_MIDDLE : CLOCK_MODE_HIGH;
+}
+/***********************************************************************************************************************
+End of function clock_mode
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: clock_mode_for
+* Description  : Returns the slowest operating mode that allows a clock setting: low-speed operation for the
+*                sub-clock, middle-speed operation up to 12 MHz.
+* Arguments    : source -
+*                    SCKCR3.CKSEL value.
+*                p_hz -
+*                    Frequencies, in Hz.
+* Return Value : CLOCK_MODE_HIGH, CLOCK_MODE_MIDDLE or CLOCK_MODE_LOW.
+***********************************************************************************************************************/
+static uint32_t clock_mode_for(uint32_t source, const uint32_t *p_hz)
+{
+    uint32_t i;
+
+    for (i = 0; i < CLOCKS; i++)
+    {
+        if (p_hz[i] > BSP_MIDDLE_SPEED_MAX_FREQUENCY)
+        {
+            return CLOCK_MODE_HIGH;
+        }
+    }
+
+    return (CLOCK_SOURCE_SUB == source) ? CLOCK_MODE_LOW : CLOCK_MODE_MIDDLE;
+}
+/***********************************************************************************************************************
+End of function clock_mode_for
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: clock_mode_set
+* Description  : Moves to an operating mode one step at a time, low-speed to and from high-speed operation through
+*                middle-speed operation, waiting for each transition to finish. PRC1 must be set.
+* Arguments    : mode -
+*                    CLOCK_MODE_HIGH, CLOCK_MODE_MIDDLE or CLOCK_MODE_LOW.
+* Return Value : none
+***********************************************************************************************************************/
+static void clock_mode_set(uint32_t mode)
+{
+    uint32_t now = clock_mode();
+
+    while (now != mode)
+    {
+        if (CLOCK_MODE_LOW == now)
+        {
+            SYSTEM.SOPCCR.BYTE = CLOCK_SOPCM_MIDDLE;
+            while (1U == SYSTEM.SOPCCR.BIT.SOPCMTSF)
+            {
+                /* Wait for the transition to finish. */
+            }
+            now = CLOCK_MODE_MIDDLE;
+        }
+        else if ((CLOCK_MODE_MIDDLE == now) && (CLOCK_MODE_LOW == mode))
+        {
+            SYSTEM.SOPCCR.BYTE = CLOCK_SOPCM_LOW;
+            while (1U == SYSTEM.SOPCCR.BIT.SOPCMTSF)
+            {
+                /* Wait for the transition to finish. */
+            }
+            now = CLOCK_MODE_LOW;
+        }
+        else
+        {
+            now = (CLOCK_MODE_MIDDLE == now) ? CLOCK_MODE_HIGH : CLOCK_MODE_MIDDLE;
+            SYSTEM.OPCCR.BYTE = (CLOCK_MODE_HIGH == now) ? CLOCK_OPCM_HIGH : CLOCK_OPCM_MIDDLE;
+            while (1U == SYSTEM.OPCCR.BIT.OPCMTSF)
+            {
+                /* Wait for the transition to finish. */
+            }
+        }
+    }
+}
+/***********************************************************************************************************************
+End of function clock_mode_set
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: clock_mode_max_hz
+* Description  : Returns the highest clock frequency the current operating mode allows.
+* Arguments    : none
+* Return Value : Frequency in Hz.
+***********************************************************************************************************************/
+static uint32_t clock_mode_max_hz(void)
+{
+    if (CLOCK_SOPCM_LOW == SYSTEM.SOPCCR.BIT.SOPCM)
+    {
+        return BSP_SUB_CLOCK_HZ;
+    }
+    if (CLOCK_OPCM_MIDDLE == SYSTEM.OPCCR.BIT.OPCM)
+    {
+        return BSP_MIDDLE_SPEED_MAX_FREQUENCY;
+    }
+
+    return CLOCK_HIGH_SPEED_MAX_HZ;
+}
+/***********************************************************************************************************************
+End of function clock_mode_max_hz
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: clock_delay_rates
+* Description  : Works out the delay rate of each unit: ICLK / (units * BSP_DELAY_LOOP_CYCLES) loops, in 32.32 fixed
+*                point with the fraction rounded down.
+* Arguments    : iclk_hz -
+*                    ICLK frequency.
+* Return Value : none
+***********************************************************************************************************************/
+static void clock_delay_rates(uint32_t iclk_hz)
+{
+    uint32_t cycles;
+    uint32_t i;
+
+    for (i = 0; i < CLOCK_DELAY_UNITS; i++)
+    {
+        cycles = s_delay_units[i] * (uint32_t)BSP_DELAY_LOOP_CYCLES;
+        s_delay_rate[i].whole = iclk_hz / cycles;
+        s_delay_rate[i].frac = (uint32_t)(((uint64_t)(iclk_hz % cycles) << 32) / cycles);
+    }
+}
+/***********************************************************************************************************************
+End of function clock_delay_rates
+***********************************************************************************************************************/
@@ -0,0 +1,131 @@
+/***********************************************************************
+*
+*  FILE        : r_clock.h
+*  DESCRIPTION : Clock registry: the ICLK, PCLKA, PCLKB, PCLKD, FCLK
+*                and BCLK frequencies, decoded once per clock change.
+*
+*  NOTE: R_CLOCK_GetHz() reads the registry instead of decoding
+*        SCKCR3, HOCOCR2, PLLCR and SCKCR, and R_BSP_GetIClkFreqHz()
+*        (so R_BSP_SoftwareDelay()) reads it too. It stays right as
+*        long as the clock is only changed through R_CLOCK_Switch(),
+*        which also calls the subscribers (a CMT period, a UART baud
+*        rate) with the clocks that changed, and with CLOCK_BEFORE
+*        just before the switch, for a subscriber that must mark the
+*        moment (a clock of its own). PowerON_Reset_PC sets
+*        the clock itself and calls CLOCK_REFRESH() at reset entry and
+*        after each switch; the registry is kept out of the sections
+*        _INITSCT() initializes, so it is valid from the first one.
+*        Subscribers are only called once main() has run, since the
+*        list lives in B.
+*        Each refresh and switch also works out the delayWait() loops
+*        per microsecond, millisecond and second as 32.32 fixed point,
+*        so R_BSP_SoftwareDelay() multiplies instead of dividing.
+*        R_CLOCK_SetPerformance() switches between performance levels
+*        at run time: it starts the source, PLL included, steps the
+*        operating mode (OPCCR, SOPCCR) and the flash wait states
+*        (MEMWAIT) around the switch, and stops the PLL when it is
+*        left. CMT0 is a subscriber, so its tick keeps its period.
+*        With CLOCK_CFG_ENABLE 0 R_BSP_GetIClkFreqHz() decodes the
+*        registers on every call, as before.
+*
+***********************************************************************/
+
+#ifndef R_CLOCK_H
+#define R_CLOCK_H
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* 1 for R_BSP_GetIClkFreqHz() to read the registry, 0 to decode the clock registers. */
+#ifndef CLOCK_CFG_ENABLE
+#define CLOCK_CFG_ENABLE            (1)
+#endif
+
+#if CLOCK_CFG_ENABLE == 1
+#define CLOCK_REFRESH()             R_CLOCK_Refresh()
+#else
+#define CLOCK_REFRESH()
+#endif
+
+/* Bit of a clock in the changed mask passed to the subscribers. */
+#define CLOCK_BIT(clock)            (1UL << (clock))
+
+/* Bit of the changed mask when the subscribers are called before the switch; the registry is not yet updated. */
+#define CLOCK_BEFORE                (0x80000000UL)
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+typedef enum e_clock_id
+{
+    CLOCK_ICLK = 0,
+    CLOCK_PCLKA,
+    CLOCK_PCLKB,
+    CLOCK_PCLKD,
+    CLOCK_FCLK,
+    CLOCK_BCLK,
+    CLOCKS
+} clock_id_t;
+
+/* Clock sources, as SCKCR3.CKSEL selects them. */
+typedef enum e_clock_source
+{
+    CLOCK_SOURCE_LOCO = 0,
+    CLOCK_SOURCE_HOCO,
+    CLOCK_SOURCE_MAIN,
+    CLOCK_SOURCE_SUB,
+    CLOCK_SOURCE_PLL
+} clock_source_t;
+
+typedef enum e_clock_err
+{
+    CLOCK_SUCCESS = 0,
+    CLOCK_ERR_NULL_PTR,
+    CLOCK_ERR_INVALID_ARG,      /* A divider that is not 1, 2, 4 ... 64, or ICLK below FCLK, PCLKB or BCLK */
+    CLOCK_ERR_NOT_STABLE,       /* The source is stopped or has not stabilized */
+    CLOCK_ERR_MODE              /* Too fast for the operating mode (OPCCR) or the flash wait states (MEMWAIT) */
+} clock_err_t;
+
+/* Setting for R_CLOCK_Switch(): the source and the divider of each clock. The HOCO frequency and the PLL settings
+   are those in HOCOCR2 and PLLCR. */
+typedef struct st_clock_setting
+{
+    clock_source_t  source;
+    uint8_t         div[CLOCKS];
+} clock_setting_t;
+
+/* Delay loops per unit of time, in 32.32 fixed point: whole + (frac / 2^32). */
+typedef struct st_clock_rate
+{
+    uint32_t    whole;
+    uint32_t    frac;
+} clock_rate_t;
+
+typedef void (*r_clock_callback_t)(uint32_t changed, void *p_context);
+
+/* Subscriber, owned by the caller. Fields are private to r_clock.c. */
+typedef struct st_clock_subscriber
+{
+    struct st_clock_subscriber  *p_next;
+    r_clock_callback_t          p_callback;
+    void                        *p_context;
+} clock_subscriber_t;
+
+/***********************************************************************************************************************
+Exported global functions (to be accessed by other files)
+***********************************************************************************************************************/
+void        R_CLOCK_Refresh(void);
+uint32_t    R_CLOCK_GetHz(clock_id_t clock);
+const clock_rate_t *R_CLOCK_GetDelayRate(uint32_t units);
+clock_err_t R_CLOCK_Switch(const clock_setting_t *p_setting);
+clock_err_t R_CLOCK_SetPerformance(const clock_setting_t *p_setting);
+clock_err_t R_CLOCK_Subscribe(clock_subscriber_t *p_subscriber, r_clock_callback_t p_callback, void *p_context);
+clock_err_t R_CLOCK_Unsubscribe(clock_subscriber_t *p_subscriber);
+
+#endif /* R_CLOCK_H */
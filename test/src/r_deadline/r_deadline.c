@@ -0,0 +1,495 @@
+/***********************************************************************
+*
+*  FILE        : r_deadline.c
+*  DESCRIPTION : Deadlines and non-blocking delays.
+*
+*  NOTE: Microseconds are turned into clock counts with a 32.32 fixed
+*        point rate worked out by R_DEADLINE_Open(), so setting a
+*        deadline takes two multiplies and no division. Pending
+*        delays are kept soonest first, so a poll with none due reads
+*        the clock once.
+*        After a change of rate the clock is read through a 32.32
+*        fixed point scale to the rate of R_DEADLINE_Open(), rounded
+*        down so that deadlines are late rather than early, from an
+*        epoch that a read moves up once half a turn has passed.
+*        Just before an r_clock switch the epoch is moved up to the
+*        switch and the scale held at 0; the counts made during it are
+*        then taken at the slower of the two rates.
+*
+***********************************************************************/
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include "platform.h"
+#include "r_deadline.h"
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+#define DEADLINE_US_PER_S       (1000000UL)
+
+#define DEADLINE_PSW_I          (0x00010000UL)
+
+/***********************************************************************************************************************
+Private global variables and functions
+***********************************************************************************************************************/
+static r_deadline_clock_t   s_p_clock;
+static uint32_t             s_rate_whole;       /* Clock counts per microsecond, 32.32 fixed point rounded up */
+static uint32_t             s_rate_frac;
+static deadline_delay_t     *s_p_delays;        /* Pending delays, soonest first */
+
+/* Rate of R_DEADLINE_Open(), and its source clock and that clock's frequency then. */
+static uint32_t             s_hz;
+static clock_id_t           s_source;
+static uint32_t             s_source_hz;
+static clock_subscriber_t   s_subscriber;
+
+/* Clock reading of the last change of rate or move of the epoch, the time in counts at the rate of
+   R_DEADLINE_Open() then with its fraction, and those counts per clock count, in 32.32 fixed point rounded down. */
+static uint32_t             s_epoch_clock;
+static uint32_t             s_epoch_time;
+static uint32_t             s_epoch_frac;
+static uint32_t             s_scale_whole;
+static uint32_t             s_scale_frac;
+
+/* Scale before an r_clock switch, while it is held at 0 until the switch is over. */
+static bool                 s_switching;
+static uint32_t             s_switch_whole;
+static uint32_t             s_switch_frac;
+
+static uint32_t deadline_now(void);
+static uint32_t deadline_scaled(uint32_t clock, uint32_t *p_frac);
+static void     deadline_rescale(uint32_t counts, uint32_t per);
+static void     deadline_clock_changed(uint32_t changed, void *p_context);
+static uint32_t deadline_remaining(const deadline_t *p_deadline, uint32_t now);
+
+/***********************************************************************************************************************
+* Function Name: R_DEADLINE_Open
+* Description  : Sets the clock and its frequency, and forgets every pending delay. Not for interrupt context.
+* Arguments    : p_clock -
+*                    Free-running 32-bit clock.
+*                hz -
+*                    Its counts per second.
+*                source -
+*                    Clock it counts, whose changes scale it, or DEADLINE_FIXED_RATE.
+* Return Value : none
+***********************************************************************************************************************/
+void R_DEADLINE_Open(r_deadline_clock_t p_clock, uint32_t hz, clock_id_t source)
+{
+    s_p_clock = p_clock;
+    s_rate_whole = hz / DEADLINE_US_PER_S;
+    s_rate_frac = (uint32_t)(((((uint64_t)(hz % DEADLINE_US_PER_S)) << 32) + DEADLINE_US_PER_S - 1U) /
+                             DEADLINE_US_PER_S);
+    s_p_delays = NULL;
+    s_hz = hz;
+    s_epoch_clock = 0U;
+    s_epoch_time = 0U;
+    s_epoch_frac = 0U;
+    s_scale_whole = 1U;
+    s_scale_frac = 0U;
+    s_switching = false;
+
+    s_source = source;
+    if (DEADLINE_FIXED_RATE == source)
+    {
+        (void)R_CLOCK_Unsubscribe(&s_subscriber);
+    }
+    else
+    {
+        s_source_hz = R_CLOCK_GetHz(source);
+        (void)R_CLOCK_Subscribe(&s_subscriber, deadline_clock_changed, NULL);
+    }
+}
+/***********************************************************************************************************************
+End of function R_DEADLINE_Open
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_DEADLINE_SetRate
+* Description  : Takes a new frequency of the clock, from now on, keeping the deadlines and delays already set. For a
+*                clock that r_clock does not scale.
+* Arguments    : hz -
+*                    Its counts per second.
+* Return Value : DEADLINE_SUCCESS, DEADLINE_ERR_NO_CLOCK, or DEADLINE_ERR_INVALID_ARG for 0.
+***********************************************************************************************************************/
+deadline_err_t R_DEADLINE_SetRate(uint32_t hz)
+{
+    if (NULL == s_p_clock)
+    {
+        return DEADLINE_ERR_NO_CLOCK;
+    }
+    if (0U == hz)
+    {
+        return DEADLINE_ERR_INVALID_ARG;
+    }
+
+    deadline_rescale(s_hz, hz);
+
+    return DEADLINE_SUCCESS;
+}
+/***********************************************************************************************************************
+End of function R_DEADLINE_SetRate
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_DEADLINE_Set
+* Description  : Sets a deadline from now.
+* Arguments    : p_deadline -
+*                    Deadline.
+*                us -
+*                    Time to the deadline in microseconds; 0 for one that has already expired.
+* Return Value : DEADLINE_SUCCESS, DEADLINE_ERR_NULL_PTR, DEADLINE_ERR_NO_CLOCK, or DEADLINE_ERR_INVALID_ARG if it is
+*                longer than DEADLINE_MAX_COUNTS.
+***********************************************************************************************************************/
+deadline_err_t R_DEADLINE_Set(deadline_t *p_deadline, uint32_t us)
+{
+    uint64_t counts = 0U;
+    uint64_t frac;
+
+    if (NULL == p_deadline)
+    {
+        return DEADLINE_ERR_NULL_PTR;
+    }
+    if (NULL == s_p_clock)
+    {
+        return DEADLINE_ERR_NO_CLOCK;
+    }
+
+    if (0U != us)
+    {
+        /* Rounded up to whole counts, plus the count under way when the clock is read. */
+        frac = (uint64_t)us * s_rate_frac;
+        counts = ((uint64_t)us * s_rate_whole) + (frac >> 32) + ((0U != (uint32_t)frac) ? 1U : 0U) + 1U;
+        if (counts > DEADLINE_MAX_COUNTS)
+        {
+            return DEADLINE_ERR_INVALID_ARG;
+        }
+    }
+
+    p_deadline->start = deadline_now();
+    p_deadline->counts = (uint32_t)counts;
+
+    return DEADLINE_SUCCESS;
+}
+/***********************************************************************************************************************
+End of function R_DEADLINE_Set
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_DEADLINE_Expired
+* Description  : Checks a deadline. Once it has been seen to expire, it stays expired without reading the clock.
+* Arguments    : p_deadline -
+*                    Deadline set with R_DEADLINE_Set().
+* Return Value : true if it has expired.
+***********************************************************************************************************************/
+bool R_DEADLINE_Expired(deadline_t *p_deadline)
+{
+    if (0U == p_deadline->counts)
+    {
+        return true;
+    }
+    if ((deadline_now() - p_deadline->start) < p_deadline->counts)
+    {
+        return false;
+    }
+
+    p_deadline->counts = 0U;
+    return true;
+}
+/***********************************************************************************************************************
+End of function R_DEADLINE_Expired
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_DEADLINE_DelayAsync
+* Description  : Starts a delay after which R_DEADLINE_Poll() calls a function, after any pending delay that is due no
+*                later. Not for interrupt context; the callback may start its own delay again.
+* Arguments    : p_delay -
+*                    Delay, in memory that stays valid until it has run or is cancelled.
+*                us -
+*                    Delay in microseconds.
+*                p_callback -
+*                    Called with p_context once the delay is over.
+*                p_context -
+*                    Passed to the callback.
+* Return Value : DEADLINE_SUCCESS, DEADLINE_ERR_IN_USE if it is already pending, or an error of R_DEADLINE_Set().
+***********************************************************************************************************************/
+deadline_err_t R_DEADLINE_DelayAsync(deadline_delay_t *p_delay, uint32_t us, r_deadline_callback_t p_callback,
+                                     void *p_context)
+{
+    deadline_delay_t **pp_link;
+    deadline_err_t   err;
+
+    if ((NULL == p_delay) || (NULL == p_callback))
+    {
+        return DEADLINE_ERR_NULL_PTR;
+    }
+    for (pp_link = &s_p_delays; NULL != *pp_link; pp_link = &(*pp_link)->p_next)
+    {
+        if (p_delay == *pp_link)
+        {
+            return DEADLINE_ERR_IN_USE;
+        }
+    }
+
+    err = R_DEADLINE_Set(&p_delay->deadline, us);
+    if (DEADLINE_SUCCESS != err)
+    {
+        return err;
+    }
+    p_delay->p_callback = p_callback;
+    p_delay->p_context = p_context;
+
+    for (pp_link = &s_p_delays; NULL != *pp_link; pp_link = &(*pp_link)->p_next)
+    {
+        if (deadline_remaining(&(*pp_link)->deadline, p_delay->deadline.start) > p_delay->deadline.counts)
+        {
+            break;
+        }
+    }
+    p_delay->p_next = *pp_link;
+    *pp_link = p_delay;
+
+    return DEADLINE_SUCCESS;
+}
+/***********************************************************************************************************************
+End of function R_DEADLINE_DelayAsync
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_DEADLINE_Cancel
+* Description  : Cancels a pending delay. Not for interrupt context.
+* Arguments    : p_delay -
+*                    Delay.
+* Return Value : DEADLINE_SUCCESS, DEADLINE_ERR_NULL_PTR, or DEADLINE_ERR_NOT_ACTIVE if it is not pending.
+***********************************************************************************************************************/
+deadline_err_t R_DEADLINE_Cancel(deadline_delay_t *p_delay)
+{
+    deadline_delay_t **pp_link;
+
+    if (NULL == p_delay)
+    {
+        return DEADLINE_ERR_NULL_PTR;
+    }
+    for (pp_link = &s_p_delays; NULL != *pp_link; pp_link = &(*pp_link)->p_next)
+    {
+        if (p_delay == *pp_link)
+        {
+            *pp_link = p_delay->p_next;
+            p_delay->p_next = NULL;
+            return DEADLINE_SUCCESS;
+        }
+    }
+
+    return DEADLINE_ERR_NOT_ACTIVE;
+}
+/***********************************************************************************************************************
+End of function R_DEADLINE_Cancel
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_DEADLINE_Poll
+* Description  : Calls the function of each delay that is over, soonest first. For the main loop, not for interrupt
+*                context.
+* Arguments    : none
+* Return Value : Number of functions called.
+***********************************************************************************************************************/
+uint32_t R_DEADLINE_Poll(void)
+{
+    deadline_delay_t *p_delay;
+    uint32_t         ran = 0U;
+
+    /* The clock is read again for each delay, as a callback may start a new one after the last reading. */
+    while ((NULL != (p_delay = s_p_delays)) && (true == R_DEADLINE_Expired(&p_delay->deadline)))
+    {
+        s_p_delays = p_delay->p_next;
+        p_delay->p_next = NULL;
+        p_delay->p_callback(p_delay->p_context);
+        ran++;
+    }
+
+    return ran;
+}
+/***********************************************************************************************************************
+End of function R_DEADLINE_Poll
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: deadline_now
+* Description  : Reads the clock, in counts at the rate of R_DEADLINE_Open(). Once half a turn of the clock has passed
+*                since the epoch, moves the epoch up to now.
+* Arguments    : none
+* Return Value : Time in counts.
+***********************************************************************************************************************/
+static uint32_t deadline_now(void)
+{
+    uint32_t psw;
+    uint32_t clock;
+    uint32_t frac;
+    uint32_t now;
+
+    /* At the rate of R_DEADLINE_Open() the counts are the clock's, offset. */
+    if ((1U == s_scale_whole) && (0U == s_scale_frac))
+    {
+        return (s_p_clock() - s_epoch_clock) + s_epoch_time;
+    }
+
+    psw = (uint32_t)get_psw();
+    clrpsw_i();
+    clock = s_p_clock();
+    now = deadline_scaled(clock, &frac);
+    if ((clock - s_epoch_clock) >= DEADLINE_MAX_COUNTS)
+    {
+        s_epoch_clock = clock;
+        s_epoch_time = now;
+        s_epoch_frac = frac;
+    }
+    if (0U != (psw & DEADLINE_PSW_I))
+    {
+        setpsw_i();
+    }
+
+    return now;
+}
+/***********************************************************************************************************************
+End of function deadline_now
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: deadline_scaled
+* Description  : Converts a clock reading to counts at the rate of R_DEADLINE_Open(). Called with interrupts masked.
+* Arguments    : clock -
+*                    Clock reading, less than a turn after the epoch.
+*                p_frac -
+*                    Fraction of a count, in 1/2^32.
+* Return Value : Time in counts.
+***********************************************************************************************************************/
+static uint32_t deadline_scaled(uint32_t clock, uint32_t *p_frac)
+{
+    uint32_t elapsed = clock - s_epoch_clock;
+    uint64_t frac = ((uint64_t)elapsed * s_scale_frac) + s_epoch_frac;
+
+    *p_frac = (uint32_t)frac;
+    return s_epoch_time + (elapsed * s_scale_whole) + (uint32_t)(frac >> 32);
+}
+/***********************************************************************************************************************
+End of function deadline_scaled
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: deadline_rescale
+* Description  : Starts a new epoch now, with a new scale from the clock to counts at the rate of R_DEADLINE_Open().
+*                At the end of an r_clock switch, first takes the counts since it started at the slower scale.
+* Arguments    : counts -
+*                    Counts at the rate of R_DEADLINE_Open() ...
+*                per -
+*                    ... per this many clock counts.
+* Return Value : none
+***********************************************************************************************************************/
+static void deadline_rescale(uint32_t counts, uint32_t per)
+{
+    uint32_t psw = (uint32_t)get_psw();
+    uint32_t whole = counts / per;
+    uint32_t frac = (uint32_t)((((uint64_t)(counts % per)) << 32) / per);
+    uint32_t clock;
+
+    clrpsw_i();
+    if (true == s_switching)
+    {
+        /* The counts since the switch started, at the slower of the two rates. */
+        s_switching = false;
+        if ((s_switch_whole < whole) || ((s_switch_whole == whole) && (s_switch_frac < frac)))
+        {
+            s_scale_whole = s_switch_whole;
+            s_scale_frac = s_switch_frac;
+        }
+        else
+        {
+            s_scale_whole = whole;
+            s_scale_frac = frac;
+        }
+    }
+    clock = s_p_clock();
+    s_epoch_time = deadline_scaled(clock, &s_epoch_frac);
+    s_epoch_clock = clock;
+    s_scale_whole = whole;
+    s_scale_frac = frac;
+    if (0U != (psw & DEADLINE_PSW_I))
+    {
+        setpsw_i();
+    }
+}
+/***********************************************************************************************************************
+End of function deadline_rescale
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: deadline_clock_changed
+* Description  : The r_clock subscriber: holds the time just before its source clock switches, and scales the clock
+*                to the frequency the source has after it.
+* Arguments    : changed -
+*                    CLOCK_BIT() of each clock that changes, with CLOCK_BEFORE before the switch.
+*                p_context -
+*                    Not used.
+* Return Value : none
+***********************************************************************************************************************/
+static void deadline_clock_changed(uint32_t changed, void *p_context)
+{
+    uint32_t psw;
+    uint32_t clock;
+    uint32_t hz;
+
+    (void)p_context;
+    if ((NULL == s_p_clock) || (DEADLINE_FIXED_RATE == s_source) || (0U == (changed & CLOCK_BIT(s_source))))
+    {
+        return;
+    }
+
+    if (0U != (changed & CLOCK_BEFORE))
+    {
+        psw = (uint32_t)get_psw();
+        clrpsw_i();
+        clock = s_p_clock();
+        s_epoch_time = deadline_scaled(clock, &s_epoch_frac);
+        s_epoch_clock = clock;
+        s_switch_whole = s_scale_whole;
+        s_switch_frac = s_scale_frac;
+        s_scale_whole = 0U;
+        s_scale_frac = 0U;
+        s_switching = true;
+        if (0U != (psw & DEADLINE_PSW_I))
+        {
+            setpsw_i();
+        }
+        return;
+    }
+
+    hz = R_CLOCK_GetHz(s_source);
+    if (0U != hz)
+    {
+        deadline_rescale(s_source_hz, hz);
+    }
+}
+/***********************************************************************************************************************
+End of function deadline_clock_changed
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: deadline_remaining
+* Description  : Returns the counts left to a deadline.
+* Arguments    : p_deadline -
+*                    Deadline.
+*                now -
+*                    Clock reading, no earlier than the deadline was set.
+* Return Value : Clock counts, 0 if it has expired.
+***********************************************************************************************************************/
+static uint32_t deadline_remaining(const deadline_t *p_deadline, uint32_t now)
+{
+    uint32_t elapsed = now - p_deadline->start;
+
+    return (elapsed < p_deadline->counts) ? (p_deadline->counts - elapsed) : 0U;
+}
+/***********************************************************************************************************************
+End of function deadline_remaining
+***********************************************************************************************************************/
@@ -0,0 +1,100 @@
+/***********************************************************************
+*
+*  FILE        : r_deadline.h
+*  DESCRIPTION : Deadlines and non-blocking delays on a free-running
+*                32-bit clock.
+*
+*  NOTE: A deadline_t is set with R_DEADLINE_Set() and polled with
+*        R_DEADLINE_Expired(), so a wait for hardware can give the
+*        main loop back between polls instead of spinning in
+*        R_BSP_SoftwareDelay(). R_DEADLINE_DelayAsync() calls a
+*        function once a delay is over, from R_DEADLINE_Poll() in
+*        the main loop, for instance from an R_SCHED task posted by an
+*        r_timer tick; a pending delay does not itself wake
+*        R_IDLE_Enter().
+*        The clock is set with R_DEADLINE_Open(), normally the PCLKB/8
+*        count of R_Config_CMT1_GetCount32(). Deadlines are counted as
+*        clock differences, so they are right across its wrap-around;
+*        they may be up to half a turn long (10 minutes at PCLKB
+*        27 MHz) and stay expired for at least half a turn after
+*        they expire, or for good once R_DEADLINE_Expired() has
+*        seen it. A deadline never expires early: it is rounded up to
+*        whole counts, plus one for the count already under way.
+*        Deadlines are kept in counts at the rate given to
+*        R_DEADLINE_Open(). When the clock it counts changes
+*        (R_CLOCK_SetPerformance() on PCLKB), r_deadline, as an
+*        r_clock subscriber, scales the clock's counts since to that
+*        rate, so the deadlines and delays already set stay right;
+*        R_DEADLINE_SetRate() does the same for a clock r_clock does
+*        not know. The counts made during the switch are taken at
+*        the slower of the two rates, so no deadline expires early
+*        across it. Once the rate has changed the clock must be read
+*        (a deadline set or checked) at least once per turn of it.
+*
+***********************************************************************/
+
+#ifndef R_DEADLINE_H
+#define R_DEADLINE_H
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+#include "r_clock.h"
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* Longest deadline, in clock counts: half a turn of the clock. */
+#define DEADLINE_MAX_COUNTS         (0x80000000UL)
+
+/* Source of R_DEADLINE_Open() for a clock whose rate r_clock does not change. */
+#define DEADLINE_FIXED_RATE         (CLOCKS)
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+typedef enum e_deadline_err
+{
+    DEADLINE_SUCCESS = 0,
+    DEADLINE_ERR_NULL_PTR,
+    DEADLINE_ERR_INVALID_ARG,   /* Longer than DEADLINE_MAX_COUNTS */
+    DEADLINE_ERR_NO_CLOCK,      /* R_DEADLINE_Open() has not been given a clock */
+    DEADLINE_ERR_IN_USE,        /* The delay is already pending */
+    DEADLINE_ERR_NOT_ACTIVE     /* The delay is not pending */
+} deadline_err_t;
+
+typedef uint32_t (*r_deadline_clock_t)(void);
+
+typedef void (*r_deadline_callback_t)(void *p_context);
+
+/* Deadline, owned by the caller. Fields are private to r_deadline.c. */
+typedef struct st_deadline
+{
+    uint32_t    start;      /* Clock when it was set */
+    uint32_t    counts;     /* Clock counts to expiry, 0 once it has expired */
+} deadline_t;
+
+/* Non-blocking delay, owned by the caller. Fields are private to r_deadline.c. */
+typedef struct st_deadline_delay
+{
+    struct st_deadline_delay    *p_next;
+    deadline_t                  deadline;
+    r_deadline_callback_t       p_callback;
+    void                        *p_context;
+} deadline_delay_t;
+
+/***********************************************************************************************************************
+Exported global functions (to be accessed by other files)
+***********************************************************************************************************************/
+void           R_DEADLINE_Open(r_deadline_clock_t p_clock, uint32_t hz, clock_id_t source);
+deadline_err_t R_DEADLINE_SetRate(uint32_t hz);
+deadline_err_t R_DEADLINE_Set(deadline_t *p_deadline, uint32_t us);
+bool           R_DEADLINE_Expired(deadline_t *p_deadline);
+deadline_err_t R_DEADLINE_DelayAsync(deadline_delay_t *p_delay, uint32_t us, r_deadline_callback_t p_callback,
+                                     void *p_context);
+deadline_err_t R_DEADLINE_Cancel(deadline_delay_t *p_delay);
+uint32_t       R_DEADLINE_Poll(void);
+
+#endif /* R_DEADLINE_H */
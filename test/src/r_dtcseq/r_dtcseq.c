@@ -0,0 +1,163 @@
+/***********************************************************************
+*
+*  FILE        : r_dtcseq.c
+*  DESCRIPTION : PORTD output pattern sequencer driven by the DTC from
+*                CMT2 compare matches.
+*
+*  NOTE: R_DTCSEQ_Start() sets CMCOR to 0, so the first compare
+*        match follows one count after the start and transfers step
+*        0; until then PORTD keeps its previous output. In repeat
+*        mode the DTC returns the source addresses to the start of
+*        the tables after the last step, and never interrupts the
+*        CPU.
+*
+***********************************************************************/
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include "platform.h"
+#include "Config_CMT2.h"
+#include "r_dtcseq.h"
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* The DTC vector table holds one transfer information address per vector, on a 1 Kbyte boundary. Only the entries
+   up to CMT2 CMI2 are reserved. */
+#define DTCSEQ_VECTOR_ALIGN     (0x400U)
+#define DTCSEQ_VECTOR           (VECT_CMT2_CMI2)
+#define DTCSEQ_VECTOR_WORDS     (DTCSEQ_VECTOR + 1U)
+
+/* DTCVBR is a pointer in iodefine.h; the host variant holds the 32-bit RX address as an integer. */
+#if defined(RX_HOST_BUILD)
+#define DTCSEQ_VBR(p)           ((uint32_t)(uintptr_t)(p))
+#else
+#define DTCSEQ_VBR(p)           ((void *)(p))
+#endif
+
+#define DTCSEQ_ADDRESS(p)       ((uint32_t)(uintptr_t)(p))
+#define DTCSEQ_MODE(mra, mrb)   (((uint32_t)(mra) << 24) | ((uint32_t)(mrb) << 16))
+
+/***********************************************************************************************************************
+Private global variables and functions
+***********************************************************************************************************************/
+/* Written back by the DTC after every transfer, so it must be in RAM. */
+static dtcseq_transfer_t    s_chain[DTCSEQ_TRANSFERS];
+
+/* The linker places the DTCVECT section on a 1 Kbyte boundary (BDTCVECT/0FC00, the last Kbyte of RAM, followed by
+   the other uninitialized sections). */
+#if defined(RX_HOST_BUILD)
+static uint32_t             s_vectors[DTCSEQ_VECTOR_WORDS] __attribute__((aligned(DTCSEQ_VECTOR_ALIGN)));
+#else
+#pragma section B DTCVECT
+static uint32_t             s_vectors[DTCSEQ_VECTOR_WORDS];
+#pragma section
+#endif
+
+/***********************************************************************************************************************
+* Function Name: R_DTCSEQ_Build
+* Description  : Fills in the transfer information chain of a sequence: a repeat-mode byte transfer from the PODR table
+*                to PORTD.PODR, chained to a repeat-mode word transfer from the CMCOR table to CMT2.CMCOR.
+* Arguments    : p_chain -
+*                    Receives DTCSEQ_TRANSFERS transfer information entries.
+*                p_podr -
+*                    PORTD output of each step.
+*                p_cmcor -
+*                    CMT2 CMCOR value of each step, at least DTCSEQ_CMCOR_MIN; the step lasts CMCOR + 1 counts.
+*                steps -
+*                    Number of steps (1 to DTCSEQ_STEPS_MAX).
+* Return Value : false if a pointer is NULL or steps or a CMCOR value is out of range.
+***********************************************************************************************************************/
+bool R_DTCSEQ_Build(dtcseq_transfer_t *p_chain, const uint8_t *p_podr, const uint16_t *p_cmcor, uint32_t steps)
+{
+    uint32_t count;
+    uint32_t i;
+
+    if ((NULL == p_chain) || (NULL == p_podr) || (NULL == p_cmcor) || (0U == steps) || (steps > DTCSEQ_STEPS_MAX))
+    {
+        return false;
+    }
+    for (i = 0; i < steps; i++)
+    {
+        if (p_cmcor[i] < DTCSEQ_CMCOR_MIN)
+        {
+            return false;
+        }
+    }
+
+    /* Repeat size and counter both start at the step count. */
+    count = (((steps & 0xFFU) << 8) | (steps & 0xFFU)) << 16;
+
+    p_chain[0].mode = DTCSEQ_MODE(DTCSEQ_MRA_MD_REPEAT | DTCSEQ_MRA_SZ_BYTE | DTCSEQ_MRA_SM_INCR,
+                                  DTCSEQ_MRB_CHNE | DTCSEQ_MRB_DTS | DTCSEQ_MRB_DM_FIXED);
+    p_chain[0].sar = DTCSEQ_ADDRESS(p_podr);
+    p_chain[0].dar = DTCSEQ_ADDRESS(&PORTD.PODR.BYTE);
+    p_chain[0].count = count;
+
+    p_chain[1].mode = DTCSEQ_MODE(DTCSEQ_MRA_MD_REPEAT | DTCSEQ_MRA_SZ_WORD | DTCSEQ_MRA_SM_INCR,
+                                  DTCSEQ_MRB_DTS | DTCSEQ_MRB_DM_FIXED);
+    p_chain[1].sar = DTCSEQ_ADDRESS(p_cmcor);
+    p_chain[1].dar = DTCSEQ_ADDRESS(&CMT2.CMCOR);
+    p_chain[1].count = count;
+
+    return true;
+}
+/***********************************************************************************************************************
+End of function R_DTCSEQ_Build
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_DTCSEQ_Start
+* Description  : Stops any running sequence and starts a new one from step 0.
+* Arguments    : p_podr -
+*                    PORTD output of each step.
+*                p_cmcor -
+*                    CMT2 CMCOR value of each step.
+*                steps -
+*                    Number of steps.
+* Return Value : false if the sequence is invalid (see R_DTCSEQ_Build); nothing is started.
+***********************************************************************************************************************/
+bool R_DTCSEQ_Start(const uint8_t *p_podr, const uint16_t *p_cmcor, uint32_t steps)
+{
+    R_DTCSEQ_Stop();
+
+    /* The read skip must be off while transfer information changes. */
+    DTC.DTCCR.BIT.RRS = 0U;
+    if (false == R_DTCSEQ_Build(s_chain, p_podr, p_cmcor, steps))
+    {
+        return false;
+    }
+
+    s_vectors[DTCSEQ_VECTOR] = DTCSEQ_ADDRESS(s_chain);
+    DTC.DTCADMOD.BIT.SHORT = 0U;
+    DTC.DTCVBR = DTCSEQ_VBR(s_vectors);
+    DTC.DTCCR.BIT.RRS = 1U;
+    DTC.DTCST.BIT.DTCST = 1U;
+
+    CMT2.CMCNT = 0U;
+    CMT2.CMCOR = 0U;
+    IR(CMT2,CMI2) = 0U;
+    DTCE(CMT2,CMI2) = 1U;
+    R_Config_CMT2_Start();
+
+    return true;
+}
+/***********************************************************************************************************************
+End of function R_DTCSEQ_Start
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_DTCSEQ_Stop
+* Description  : Stops the sequence; PORTD keeps the output of the current step.
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+void R_DTCSEQ_Stop(void)
+{
+    R_Config_CMT2_Stop();
+    DTCE(CMT2,CMI2) = 0U;
+}
+/***********************************************************************************************************************
+End of function R_DTCSEQ_Stop
+***********************************************************************************************************************/
@@ -0,0 +1,83 @@
+/***********************************************************************
+*
+*  FILE        : r_dtcseq.h
+*  DESCRIPTION : PORTD output pattern sequencer driven by the DTC from
+*                CMT2 compare matches.
+*
+*  NOTE: A sequence is a table of PORTD.PODR bytes and a table of
+*        CMT2 CMCOR values of the same length: step n drives
+*        podr[n] for cmcor[n] + 1 CMT2 counts (PCLKB/32). Each
+*        compare match activates a chain of two repeat-mode DTC
+*        transfers, the next PODR byte and the next CMCOR value, so
+*        the sequence replays from the tables without the CPU; the
+*        tables must stay in place until R_DTCSEQ_Stop().
+*        The DTC writes the whole PODR byte: while a sequence runs,
+*        PORTD must not be updated by r_port or bitfield writes, and
+*        R_PORT_Open() must be called again after R_DTCSEQ_Stop()
+*        before r_port is used on PORTD. This module owns the DTC
+*        vector table (DTCVBR).
+*
+***********************************************************************/
+
+#ifndef R_DTCSEQ_H
+#define R_DTCSEQ_H
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* Longest sequence: the repeat-mode transfer counter is 8 bits wide (256 is written as 0). */
+#define DTCSEQ_STEPS_MAX        (256U)
+
+/* Shortest step, as a CMCOR value: two counts leave the chained transfer time to rewrite CMCOR before CMCNT passes
+   it. */
+#define DTCSEQ_CMCOR_MIN        (1U)
+
+/* Transfer information chain: PODR transfer, then CMCOR transfer. */
+#define DTCSEQ_TRANSFERS        (2U)
+
+/* Mode register A (MRA): transfer mode, data size and source addressing. */
+#define DTCSEQ_MRA_MD_NORMAL    (0x00U)
+#define DTCSEQ_MRA_MD_REPEAT    (0x40U)
+#define DTCSEQ_MRA_MD_BLOCK     (0x80U)
+#define DTCSEQ_MRA_SZ_BYTE      (0x00U)
+#define DTCSEQ_MRA_SZ_WORD      (0x10U)
+#define DTCSEQ_MRA_SZ_LONG      (0x20U)
+#define DTCSEQ_MRA_SM_FIXED     (0x00U)
+#define DTCSEQ_MRA_SM_INCR      (0x08U)
+#define DTCSEQ_MRA_SM_DECR      (0x0CU)
+
+/* Mode register B (MRB): chaining, interrupt selection, repeat area and destination addressing. */
+#define DTCSEQ_MRB_CHNE         (0x80U)     /* Chain to the next transfer information */
+#define DTCSEQ_MRB_CHNS         (0x40U)     /* Chain only when the transfer counter reaches 0 */
+#define DTCSEQ_MRB_DISEL        (0x20U)     /* Interrupt the CPU after every transfer */
+#define DTCSEQ_MRB_DTS          (0x10U)     /* Source is the repeat or block area */
+#define DTCSEQ_MRB_DM_FIXED     (0x00U)
+#define DTCSEQ_MRB_DM_INCR      (0x08U)
+#define DTCSEQ_MRB_DM_DECR      (0x0CU)
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+/* Transfer information in full-address mode, as the DTC reads it from memory on a little-endian RX. */
+typedef struct st_dtcseq_transfer
+{
+    uint32_t    mode;       /* MRA << 24 | MRB << 16 */
+    uint32_t    sar;        /* Source address */
+    uint32_t    dar;        /* Destination address */
+    uint32_t    count;      /* CRA << 16 | CRB; in repeat mode CRA is the repeat size (CRAH) and counter (CRAL) */
+} dtcseq_transfer_t;
+
+/***********************************************************************************************************************
+Exported global functions (to be accessed by other files)
+***********************************************************************************************************************/
+bool R_DTCSEQ_Build(dtcseq_transfer_t *p_chain, const uint8_t *p_podr, const uint16_t *p_cmcor, uint32_t steps);
+bool R_DTCSEQ_Start(const uint8_t *p_podr, const uint16_t *p_cmcor, uint32_t steps);
+void R_DTCSEQ_Stop(void);
+
+#endif /* R_DTCSEQ_H */
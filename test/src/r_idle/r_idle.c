@@ -0,0 +1,159 @@
+/***********************************************************************
+*
+*  FILE        : r_idle.c
+*  DESCRIPTION : Low-power idle with sleep accounting.
+*
+*  NOTE: The statistics are kept by the main loop only; read them
+*        with R_IDLE_GetStats() from the main loop, not from an
+*        interrupt. The wake interrupt runs before WAIT returns, so
+*        its time is counted as asleep.
+*
+***********************************************************************/
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include "platform.h"
+#include "r_idle.h"
+
+/***********************************************************************************************************************
+Private global variables and functions
+***********************************************************************************************************************/
+static r_idle_clock_t   s_p_clock;
+static bool             s_standby_allowed;
+static uint64_t         s_awake_since;      /* Clock at the last wake-up, or at R_IDLE_Open() */
+static idle_stats_t     s_stats;
+
+/***********************************************************************************************************************
+* Function Name: R_IDLE_Open
+* Description  : Sets the accounting time source and clears the statistics. Standby is not allowed until
+*                R_IDLE_AllowStandby() is called.
+* Arguments    : p_clock -
+*                    Time source, or NULL for no time accounting.
+* Return Value : none
+***********************************************************************************************************************/
+void R_IDLE_Open(r_idle_clock_t p_clock)
+{
+    uint32_t mode;
+
+    s_p_clock = p_clock;
+    s_standby_allowed = false;
+    s_awake_since = (NULL != p_clock) ? p_clock() : 0U;
+    s_stats.awake = 0U;
+    for (mode = 0; mode < IDLE_MODES; mode++)
+    {
+        s_stats.asleep[mode] = 0U;
+        s_stats.entries[mode] = 0U;
+    }
+}
+/***********************************************************************************************************************
+End of function R_IDLE_Open
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_IDLE_AllowStandby
+* Description  : Allows or forbids software standby. Allow it only while an interrupt that works in standby (IRQ pin,
+*                RTC, LVD or IWDT) is enabled to wake the CPU.
+* Arguments    : allow -
+*                    true to allow software standby.
+* Return Value : none
+***********************************************************************************************************************/
+void R_IDLE_AllowStandby(bool allow)
+{
+    s_standby_allowed = allow;
+}
+/***********************************************************************************************************************
+End of function R_IDLE_AllowStandby
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_IDLE_SelectMode
+* Description  : Returns the mode R_IDLE_Enter() would use now.
+* Arguments    : none
+* Return Value : IDLE_MODE_STANDBY if allowed and no CMT channel or TMR0/TMR1 is counting, IDLE_MODE_SLEEP otherwise.
+***********************************************************************************************************************/
+idle_mode_t R_IDLE_SelectMode(void)
+{
+    if ((true == s_standby_allowed) && (0 == CMT.CMSTR0.BIT.STR0) && (0 == CMT.CMSTR0.BIT.STR1) &&
+        (0 == CMT.CMSTR1.BIT.STR2) && (0 == CMT.CMSTR1.BIT.STR3) && (0 == TMR0.TCCR.BIT.CSS) &&
+        (0 == TMR1.TCCR.BIT.CSS))
+    {
+        return IDLE_MODE_STANDBY;
+    }
+
+    return IDLE_MODE_SLEEP;
+}
+/***********************************************************************************************************************
+End of function R_IDLE_SelectMode
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_IDLE_Enter
+* Description  : Sleeps until an interrupt has been serviced. Called with interrupts masked, normally as the scheduler
+*                idle hook; WAIT unmasks them, and they are masked again on return.
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+void R_IDLE_Enter(void)
+{
+    idle_mode_t mode = R_IDLE_SelectMode();
+    uint64_t    start = 0U;
+    uint64_t    end;
+
+    if ((uint16_t)mode != SYSTEM.SBYCR.BIT.SSBY)
+    {
+        R_BSP_RegisterProtectDisable(BSP_REG_PROTECT_LPC_CGC_SWR);
+        SYSTEM.SBYCR.BIT.SSBY = (uint16_t)mode;
+
+        /* Reads back so that the write has completed before WAIT. */
+        if ((uint16_t)mode != SYSTEM.SBYCR.BIT.SSBY)
+        {
+            nop();
+        }
+        R_BSP_RegisterProtectEnable(BSP_REG_PROTECT_LPC_CGC_SWR);
+    }
+
+    if (NULL != s_p_clock)
+    {
+        start = s_p_clock();
+    }
+
+    wait();
+    clrpsw_i();
+
+    s_stats.entries[mode]++;
+    if (NULL != s_p_clock)
+    {
+        end = s_p_clock();
+        s_stats.asleep[mode] += end - start;
+        s_stats.awake += start - s_awake_since;
+        s_awake_since = end;
+    }
+}
+/***********************************************************************************************************************
+End of function R_IDLE_Enter
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_IDLE_GetStats
+* Description  : Returns the time spent asleep in each mode and awake since R_IDLE_Open().
+* Arguments    : p_stats -
+*                    Receives the statistics.
+* Return Value : none
+***********************************************************************************************************************/
+void R_IDLE_GetStats(idle_stats_t *p_stats)
+{
+    if (NULL == p_stats)
+    {
+        return;
+    }
+
+    *p_stats = s_stats;
+    if (NULL != s_p_clock)
+    {
+        p_stats->awake += s_p_clock() - s_awake_since;
+    }
+}
+/***********************************************************************************************************************
+End of function R_IDLE_GetStats
+***********************************************************************************************************************/
@@ -0,0 +1,56 @@
+/***********************************************************************
+*
+*  FILE        : r_idle.h
+*  DESCRIPTION : Low-power idle for the scheduler, with accounting of
+*                the time spent asleep and awake.
+*
+*  NOTE: R_IDLE_Enter() is the scheduler idle hook. It picks sleep
+*        mode, in which peripherals keep running and any interrupt
+*        wakes the CPU, or software standby, in which every clock but
+*        the sub-clock and IWDT stops. Standby is used only when the
+*        application allows it and no CMT channel or TMR0/TMR1 is
+*        counting, since they stop in standby: the CMT could not wake
+*        the CPU and the TMR-driven ELC outputs would freeze.
+*
+***********************************************************************/
+
+#ifndef R_IDLE_H
+#define R_IDLE_H
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+/* Values match SBYCR.SSBY. */
+typedef enum e_idle_mode
+{
+    IDLE_MODE_SLEEP = 0,
+    IDLE_MODE_STANDBY,
+    IDLE_MODES
+} idle_mode_t;
+
+/* Time source for the accounting, in any unit; it may stop in software standby. */
+typedef uint64_t (*r_idle_clock_t)(void);
+
+typedef struct st_idle_stats
+{
+    uint64_t    awake;                  /* Clock units outside R_IDLE_Enter() since R_IDLE_Open() */
+    uint64_t    asleep[IDLE_MODES];     /* Clock units from entering each mode to returning from the wake interrupt */
+    uint32_t    entries[IDLE_MODES];
+} idle_stats_t;
+
+/***********************************************************************************************************************
+Exported global functions (to be accessed by other files)
+***********************************************************************************************************************/
+void        R_IDLE_Open(r_idle_clock_t p_clock);
+void        R_IDLE_AllowStandby(bool allow);
+idle_mode_t R_IDLE_SelectMode(void);
+void        R_IDLE_Enter(void);
+void        R_IDLE_GetStats(idle_stats_t *p_stats);
+
+#endif /* R_IDLE_H */
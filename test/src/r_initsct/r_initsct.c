@@ -0,0 +1,353 @@
+/***********************************************************************
+*
+*  FILE        : r_initsct.c
+*  DESCRIPTION : C runtime section initialization.
+*
+*  NOTE: The string instructions take their operands in R1 (dest),
+*        R2 (source or value) and R3 (count), the registers the
+*        first three arguments are passed in, so each inline
+*        assembly function is a single instruction.
+*
+***********************************************************************/
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include "platform.h"
+#include "r_initsct.h"
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+#define INITSCT_WORD            (4U)
+#define INITSCT_MISALIGNED(p)   ((uint32_t)(uintptr_t)(p) & (INITSCT_WORD - 1U))
+
+/* LZ4 block format: a token byte holds the literal count (high nibble) and the match length - 4 (low nibble); 15 in
+   either is continued by bytes added on up to the first that is not 255. */
+#define INITSCT_LZ4_MORE        (15U)
+#define INITSCT_LZ4_MATCH_MIN   (4U)
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+/* Entries of the C$DSEC (_DTBL) and C$BSEC (_BTBL) tables in dbsct.c. */
+typedef struct st_initsct_dtbl
+{
+    uint8_t     *rom_s;
+    uint8_t     *rom_e;
+    uint8_t     *ram_s;
+} initsct_dtbl_t;
+
+typedef struct st_initsct_btbl
+{
+    uint8_t     *b_s;
+    uint8_t     *b_e;
+} initsct_btbl_t;
+
+/* Entries of the C$ZSEC table (_ZTBL) written by zsect. */
+typedef struct st_initsct_ztbl
+{
+    uint8_t     *packed_s;
+    uint8_t     *packed_e;
+    uint8_t     *ram_s;
+    uint8_t     *ram_e;
+} initsct_ztbl_t;
+
+/***********************************************************************************************************************
+Private global variables and functions
+***********************************************************************************************************************/
+#if INITSCT_CFG_STRING == 1
+#pragma inline_asm initsct_smovf
+static void initsct_smovf(void *p_dst, const void *p_src, uint32_t size)
+{
+    SMOVF
+}
+
+#pragma inline_asm initsct_sstr_l
+static void initsct_sstr_l(void *p_dst, uint32_t value, uint32_t words)
+{
+    SSTR.L
+}
+#endif
+
+static bool initsct_lz4_count(const uint8_t **pp_src, const uint8_t *p_end, uint32_t *p_count);
+#if INITSCT_CFG_PACKED == 1
+static bool initsct_is_packed(const uint8_t *p_ram);
+#endif
+
+/***********************************************************************************************************************
+* Function Name: R_INITSCT_Run
+* Description  : Initializes the D sections from their ROM images and clears the B sections. Called by
+*                PowerON_Reset_PC in place of _INITSCT().
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+void R_INITSCT_Run(void)
+{
+    const initsct_dtbl_t *p_d = (const initsct_dtbl_t *)__sectop("C$DSEC");
+    const initsct_dtbl_t *p_d_end = (const initsct_dtbl_t *)__secend("C$DSEC");
+    const initsct_btbl_t *p_b = (const initsct_btbl_t *)__sectop("C$BSEC");
+    const initsct_btbl_t *p_b_end = (const initsct_btbl_t *)__secend("C$BSEC");
+
+    for (; p_d < p_d_end; p_d++)
+    {
+#if INITSCT_CFG_PACKED == 1
+        /* An R section that is packed is left to the unpacker, its ROM image not read. */
+        if (true == initsct_is_packed(p_d->ram_s))
+        {
+            continue;
+        }
+#endif
+        R_INITSCT_Copy(p_d->ram_s, p_d->rom_s, (uint32_t)(p_d->rom_e - p_d->rom_s));
+    }
+    for (; p_b < p_b_end; p_b++)
+    {
+        R_INITSCT_Zero(p_b->b_s, (uint32_t)(p_b->b_e - p_b->b_s));
+    }
+#if INITSCT_CFG_PACKED == 1
+    {
+        const initsct_ztbl_t *p_z = (const initsct_ztbl_t *)__sectop("C$ZSEC");
+        const initsct_ztbl_t *p_z_end = (const initsct_ztbl_t *)__secend("C$ZSEC");
+
+        /* An area whose stream is damaged is left cleared rather than part written. */
+        for (; p_z < p_z_end; p_z++)
+        {
+            if (false == R_INITSCT_Unpack(p_z->ram_s, (uint32_t)(p_z->ram_e - p_z->ram_s), p_z->packed_s,
+                                          (uint32_t)(p_z->packed_e - p_z->packed_s)))
+            {
+                R_INITSCT_Zero(p_z->ram_s, (uint32_t)(p_z->ram_e - p_z->ram_s));
+            }
+        }
+    }
+#endif
+}
+/***********************************************************************************************************************
+End of function R_INITSCT_Run
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_INITSCT_Copy
+* Description  : Copies memory forwards. The areas must not overlap.
+* Arguments    : p_dst -
+*                    Destination, any alignment.
+*                p_src -
+*                    Source, any alignment.
+*                size -
+*                    Bytes to copy.
+* Return Value : none
+***********************************************************************************************************************/
+void R_INITSCT_Copy(void *p_dst, const void *p_src, uint32_t size)
+{
+#if INITSCT_CFG_STRING == 1
+    initsct_smovf(p_dst, p_src, size);
+#else
+    uint8_t       *p_d = (uint8_t *)p_dst;
+    const uint8_t *p_s = (const uint8_t *)p_src;
+
+    /* Words once the destination is aligned, if that aligns the source too. */
+    if (INITSCT_MISALIGNED(p_d) == INITSCT_MISALIGNED(p_s))
+    {
+        for (; (0U != INITSCT_MISALIGNED(p_d)) && (0U != size); size--)
+        {
+            *p_d++ = *p_s++;
+        }
+        for (; size >= INITSCT_WORD; size -= INITSCT_WORD)
+        {
+            *(uint32_t *)p_d = *(const uint32_t *)p_s;
+            p_d += INITSCT_WORD;
+            p_s += INITSCT_WORD;
+        }
+    }
+    for (; 0U != size; size--)
+    {
+        *p_d++ = *p_s++;
+    }
+#endif
+}
+/***********************************************************************************************************************
+End of function R_INITSCT_Copy
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_INITSCT_Zero
+* Description  : Clears memory.
+* Arguments    : p_dst -
+*                    Start, any alignment.
+*                size -
+*                    Bytes to clear.
+* Return Value : none
+***********************************************************************************************************************/
+void R_INITSCT_Zero(void *p_dst, uint32_t size)
+{
+    uint8_t *p_d = (uint8_t *)p_dst;
+
+    for (; (0U != INITSCT_MISALIGNED(p_d)) && (0U != size); size--)
+    {
+        *p_d++ = 0U;
+    }
+#if INITSCT_CFG_STRING == 1
+    initsct_sstr_l(p_d, 0U, size / INITSCT_WORD);
+    p_d += size & ~(INITSCT_WORD - 1U);
+    size &= INITSCT_WORD - 1U;
+#else
+    for (; size >= INITSCT_WORD; size -= INITSCT_WORD)
+    {
+        *(uint32_t *)p_d = 0U;
+        p_d += INITSCT_WORD;
+    }
+#endif
+    for (; 0U != size; size--)
+    {
+        *p_d++ = 0U;
+    }
+}
+/***********************************************************************************************************************
+End of function R_INITSCT_Zero
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_INITSCT_Unpack
+* Description  : Decompresses an LZ4 block stream straight into RAM. Matches copy from the bytes already written, so
+*                no buffer is needed.
+* Arguments    : p_dst -
+*                    Destination, any alignment.
+*                size -
+*                    Size of the unpacked data.
+*                p_packed -
+*                    LZ4 block stream.
+*                packed_size -
+*                    Size of the stream.
+* Return Value : false if the stream is malformed, or does not unpack to exactly size bytes; nothing outside the
+*                destination is written either way.
+***********************************************************************************************************************/
+bool R_INITSCT_Unpack(void *p_dst, uint32_t size, const void *p_packed, uint32_t packed_size)
+{
+    uint8_t       *p_d = (uint8_t *)p_dst;
+    uint8_t       *p_d_end = p_d + size;
+    const uint8_t *p_s = (const uint8_t *)p_packed;
+    const uint8_t *p_s_end = p_s + packed_size;
+    const uint8_t *p_match;
+    uint32_t      token;
+    uint32_t      count;
+    uint32_t      offset;
+
+    while (p_s < p_s_end)
+    {
+        token = *p_s++;
+
+        /* Literals */
+        count = token >> 4;
+        if ((INITSCT_LZ4_MORE == count) && (false == initsct_lz4_count(&p_s, p_s_end, &count)))
+        {
+            return false;
+        }
+        if ((count > (uint32_t)(p_s_end - p_s)) || (count > (uint32_t)(p_d_end - p_d)))
+        {
+            return false;
+        }
+        R_INITSCT_Copy(p_d, p_s, count);
+        p_d += count;
+        p_s += count;
+
+        /* The last sequence has no match. */
+        if (p_s == p_s_end)
+        {
+            break;
+        }
+
+        /* Match */
+        if ((uint32_t)(p_s_end - p_s) < 2U)
+        {
+            return false;
+        }
+        offset = (uint32_t)p_s[0] | ((uint32_t)p_s[1] << 8);
+        p_s += 2;
+        count = token & INITSCT_LZ4_MORE;
+        if ((INITSCT_LZ4_MORE == count) && (false == initsct_lz4_count(&p_s, p_s_end, &count)))
+        {
+            return false;
+        }
+        count += INITSCT_LZ4_MATCH_MIN;
+        if ((0U == offset) || (offset > (uint32_t)(p_d - (uint8_t *)p_dst)) || (count > (uint32_t)(p_d_end - p_d)))
+        {
+            return false;
+        }
+
+        /* A match closer than its length repeats its first offset bytes; each copy of them doubles the distance
+           the next copy can take from, so the copies never overlap. */
+        p_match = p_d - offset;
+        while (count > offset)
+        {
+            R_INITSCT_Copy(p_d, p_match, offset);
+            p_d += offset;
+            count -= offset;
+            offset += offset;
+        }
+        R_INITSCT_Copy(p_d, p_match, count);
+        p_d += count;
+    }
+
+    return (p_d == p_d_end);
+}
+/***********************************************************************************************************************
+End of function R_INITSCT_Unpack
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: initsct_lz4_count
+* Description  : Adds the continuation bytes of a literal count or match length.
+* Arguments    : pp_src -
+*                    Stream position, advanced past the continuation bytes.
+*                p_end -
+*                    End of the stream.
+*                p_count -
+*                    Count to add to.
+* Return Value : false if the stream ends in the continuation or the count overflows.
+***********************************************************************************************************************/
+static bool initsct_lz4_count(const uint8_t **pp_src, const uint8_t *p_end, uint32_t *p_count)
+{
+    uint32_t more;
+
+    do
+    {
+        if ((*pp_src >= p_end) || (*p_count > 0x7FFFFFFFUL))
+        {
+            return false;
+        }
+        more = *(*pp_src)++;
+        *p_count += more;
+    } while (255U == more);
+
+    return true;
+}
+/***********************************************************************************************************************
+End of function initsct_lz4_count
+***********************************************************************************************************************/
+
+#if INITSCT_CFG_PACKED == 1
+/***********************************************************************************************************************
+* Function Name: initsct_is_packed
+* Description  : Checks whether RAM lies in an area of the C$ZSEC table.
+* Arguments    : p_ram -
+*                    RAM address.
+* Return Value : true if an area holds it.
+***********************************************************************************************************************/
+static bool initsct_is_packed(const uint8_t *p_ram)
+{
+    const initsct_ztbl_t *p_z = (const initsct_ztbl_t *)__sectop("C$ZSEC");
+    const initsct_ztbl_t *p_z_end = (const initsct_ztbl_t *)__secend("C$ZSEC");
+
+    for (; p_z < p_z_end; p_z++)
+    {
+        if ((p_ram >= p_z->ram_s) && (p_ram < p_z->ram_e))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+/***********************************************************************************************************************
+End of function initsct_is_packed
+***********************************************************************************************************************/
+#endif
@@ -0,0 +1,71 @@
+/***********************************************************************
+*
+*  FILE        : r_initsct.h
+*  DESCRIPTION : C runtime section initialization, in place of the
+*                toolchain's byte-by-byte _INITSCT().
+*
+*  NOTE: R_INITSCT_Run() walks the dbsct.c tables once: it copies
+*        every D section to its R section and clears every B
+*        section. On the RX the copy is one SMOVF and the clear one
+*        SSTR.L between byte heads and tails; elsewhere the portable
+*        copy moves words when source and destination are equally
+*        aligned, bytes otherwise. Sections may start and end at any
+*        byte (D_1/R_1 and B_1 are byte-aligned).
+*        With INITSCT_CFG_PACKED it then fills the areas listed in
+*        the C$ZSEC table (_ZTBL) from LZ4 block streams in ROM. The
+*        areas are uninitialized data, cleared with the B sections
+*        first; host/tools/zsect packs their initial contents and
+*        writes the streams and the table as a C source file:
+*            const struct { uint8_t *packed_s; uint8_t *packed_e;
+*                           uint8_t *ram_s; uint8_t *ram_e; } _ZTBL[];
+*        An area may also be a whole R section: the e2 studio
+*        HardwareDebugPacked configuration packs D, D_2 and D_1 of
+*        the link, relinking once with them (host/Makefile,
+*        zsect-image), and leaves them out of the image. The C$DSEC
+*        entry of an R section that an area holds is skipped, so
+*        that ROM image is never read.
+*        It runs before the C runtime is set up, so it uses no
+*        initialized data.
+*
+***********************************************************************/
+
+#ifndef R_INITSCT_H
+#define R_INITSCT_H
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* 1 for PowerON_Reset_PC to call R_INITSCT_Run(), 0 for the toolchain's _INITSCT(). */
+#ifndef INITSCT_CFG_ENABLE
+#define INITSCT_CFG_ENABLE          (1)
+#endif
+
+/* 1 to unpack the areas of the C$ZSEC table, 0 if no zsect output is linked. */
+#ifndef INITSCT_CFG_PACKED
+#define INITSCT_CFG_PACKED          (0)
+#endif
+
+/* 1 to copy and clear with the RX string instructions, 0 for the portable word loops. */
+#ifndef INITSCT_CFG_STRING
+#if defined(RX_HOST_BUILD)
+#define INITSCT_CFG_STRING          (0)
+#else
+#define INITSCT_CFG_STRING          (1)
+#endif
+#endif
+
+/***********************************************************************************************************************
+Exported global functions (to be accessed by other files)
+***********************************************************************************************************************/
+void R_INITSCT_Run(void);
+void R_INITSCT_Copy(void *p_dst, const void *p_src, uint32_t size);
+void R_INITSCT_Zero(void *p_dst, uint32_t size);
+bool R_INITSCT_Unpack(void *p_dst, uint32_t size, const void *p_packed, uint32_t packed_size);
+
+#endif /* R_INITSCT_H */
@@ -0,0 +1,170 @@
+/***********************************************************************
+*
+*  FILE        : r_lathist.c
+*  DESCRIPTION : Log2 histogram of interrupt entry latencies.
+*
+*  NOTE: The RX CPU has no count-leading-zeros instruction; the bin
+*        is found with a five-step binary search on the sample.
+*
+***********************************************************************/
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include "platform.h"
+#include "r_lathist.h"
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+#define LATHIST_PSW_I       (0x00010000UL)
+
+/***********************************************************************************************************************
+* Function Name: R_LATHIST_Clear
+* Description  : Empties a histogram.
+* Arguments    : p_hist -
+*                    Histogram.
+* Return Value : none
+***********************************************************************************************************************/
+void R_LATHIST_Clear(r_lathist_t *p_hist)
+{
+    uint32_t psw = (uint32_t)get_psw();
+    uint32_t bin;
+
+    clrpsw_i();
+    for (bin = 0; bin < LATHIST_BINS; bin++)
+    {
+        p_hist->bins[bin] = 0U;
+    }
+    p_hist->count = 0U;
+    p_hist->min = UINT32_MAX;
+    p_hist->max = 0U;
+    if (0 != (psw & LATHIST_PSW_I))
+    {
+        setpsw_i();
+    }
+}
+/***********************************************************************************************************************
+End of function R_LATHIST_Clear
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_LATHIST_Record
+* Description  : Adds a sample. Called from the instrumented interrupt; not reentrant for one histogram.
+* Arguments    : p_hist -
+*                    Histogram.
+*                sample -
+*                    Latency in timer counts.
+* Return Value : none
+***********************************************************************************************************************/
+void R_LATHIST_Record(r_lathist_t *p_hist, uint32_t sample)
+{
+    p_hist->bins[R_LATHIST_Bin(sample)]++;
+    p_hist->count++;
+    if (sample < p_hist->min)
+    {
+        p_hist->min = sample;
+    }
+    if (sample > p_hist->max)
+    {
+        p_hist->max = sample;
+    }
+}
+/***********************************************************************************************************************
+End of function R_LATHIST_Record
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_LATHIST_Snapshot
+* Description  : Copies a histogram with interrupts masked, so that the copy is consistent.
+* Arguments    : p_hist -
+*                    Histogram being recorded.
+*                p_copy -
+*                    Receives the copy.
+* Return Value : none
+***********************************************************************************************************************/
+void R_LATHIST_Snapshot(const r_lathist_t *p_hist, r_lathist_t *p_copy)
+{
+    uint32_t psw = (uint32_t)get_psw();
+
+    clrpsw_i();
+    *p_copy = *(const volatile r_lathist_t *)p_hist;
+    if (0 != (psw & LATHIST_PSW_I))
+    {
+        setpsw_i();
+    }
+}
+/***********************************************************************************************************************
+End of function R_LATHIST_Snapshot
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_LATHIST_Bin
+* Description  : Returns the bin of a sample: the number of significant bits in it.
+* Arguments    : sample -
+*                    Latency in timer counts.
+* Return Value : Bin index (0 to LATHIST_BINS - 1).
+***********************************************************************************************************************/
+uint32_t R_LATHIST_Bin(uint32_t sample)
+{
+    uint32_t bin = 0U;
+    uint32_t shift;
+
+    for (shift = 16U; 0U != shift; shift >>= 1)
+    {
+        if (0U != (sample >> shift))
+        {
+            sample >>= shift;
+            bin += shift;
+        }
+    }
+
+    return bin + sample;
+}
+/***********************************************************************************************************************
+End of function R_LATHIST_Bin
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_LATHIST_Percentile
+* Description  : Returns an upper bound for a percentile of a histogram snapshot.
+* Arguments    : p_hist -
+*                    Snapshot from R_LATHIST_Snapshot().
+*                percent -
+*                    Percentile (0 to 100); 0 gives the minimum and 100 the maximum.
+* Return Value : Latency in timer counts, or 0 for an empty histogram.
+***********************************************************************************************************************/
+uint32_t R_LATHIST_Percentile(const r_lathist_t *p_hist, uint32_t percent)
+{
+    uint32_t rank;
+    uint32_t seen = 0U;
+    uint32_t bin;
+    uint32_t edge;
+
+    if (0U == p_hist->count)
+    {
+        return 0U;
+    }
+
+    if (0U == percent)
+    {
+        return p_hist->min;
+    }
+
+    /* Rank of the sample at the percentile, rounded up (nearest-rank method). */
+    rank = (uint32_t)((((uint64_t)p_hist->count * ((percent < 100U) ? percent : 100U)) + 99U) / 100U);
+    for (bin = 0; bin < (LATHIST_BINS - 1U); bin++)
+    {
+        seen += p_hist->bins[bin];
+        if (seen >= rank)
+        {
+            break;
+        }
+    }
+
+    edge = (0U == bin) ? 0U : ((uint32_t)(((uint64_t)1U << bin) - 1U));
+    return (edge < p_hist->max) ? edge : p_hist->max;
+}
+/***********************************************************************************************************************
+End of function R_LATHIST_Percentile
+***********************************************************************************************************************/
@@ -0,0 +1,50 @@
+/***********************************************************************
+*
+*  FILE        : r_lathist.h
+*  DESCRIPTION : Log2 histogram of interrupt entry latencies.
+*
+*  NOTE: An instrumented interrupt reads its timer counter as its
+*        first action, and passes the time since the compare match
+*        to R_LATHIST_Record(). Bin 0 holds samples of 0 and bin n
+*        samples from 2^(n-1) to 2^n - 1. Percentiles are given as
+*        the upper edge of their bin, capped at the maximum, so they
+*        are never below the true value and less than twice it.
+*
+***********************************************************************/
+
+#ifndef R_LATHIST_H
+#define R_LATHIST_H
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+#define LATHIST_BINS                (33U)
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+/* Histogram, owned by the caller. Written by one interrupt; read with R_LATHIST_Snapshot(). */
+typedef struct st_r_lathist
+{
+    uint32_t    bins[LATHIST_BINS];
+    uint32_t    count;
+    uint32_t    min;
+    uint32_t    max;
+} r_lathist_t;
+
+/***********************************************************************************************************************
+Exported global functions (to be accessed by other files)
+***********************************************************************************************************************/
+void     R_LATHIST_Clear(r_lathist_t *p_hist);
+void     R_LATHIST_Record(r_lathist_t *p_hist, uint32_t sample);
+void     R_LATHIST_Snapshot(const r_lathist_t *p_hist, r_lathist_t *p_copy);
+uint32_t R_LATHIST_Bin(uint32_t sample);
+uint32_t R_LATHIST_Percentile(const r_lathist_t *p_hist, uint32_t percent);
+
+#endif /* R_LATHIST_H */
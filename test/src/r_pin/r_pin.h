@@ -0,0 +1,84 @@
+/***********************************************************************
+*
+*  FILE        : r_pin.h
+*  DESCRIPTION : Compile-time typed I/O pins and pin groups.
+*
+*  NOTE: A pin is a 'port, bit' pair and a group a 'port, mask' pair,
+*        each defined once as a macro:
+*            #define LED0_IO     D, 7
+*            #define LED_IO      D, 0xC0U
+*        and passed whole to the R_PIN_ and R_PIN_GROUP_ macros,
+*        which paste it into the iodefine.h register names; a port
+*        or bit the MCU does not have is a compile error, and no
+*        table is consulted at run time.
+*        Pin operations are single-bit bit field writes, one BSET,
+*        BCLR or BNOT instruction on the port's register byte, so
+*        they need no interrupt masking. Group operations are one
+*        read-modify-write per register, or one write for a group of
+*        all eight pins, with their masks folded at compile time; mask
+*        interrupts around them if an interrupt updates the same
+*        register.
+*        PORT0 and PORT4 have no DSCR (drive capacity) register.
+*        Pin writes bypass the r_port shadow: update the PODR of a
+*        port through either r_pin or r_port, not both.
+*
+***********************************************************************/
+
+#ifndef R_PIN_H
+#define R_PIN_H
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <stdint.h>
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* Port registers of a pin or group, and the mask of a pin. */
+#define R_PIN_PORT(pin)                     R_PIN_PORT_(pin)
+#define R_PIN_MASK(pin)                     R_PIN_MASK_(pin)
+
+/* Output of a pin. */
+#define R_PIN_SET(pin)                      R_PIN_WRITE_(pin, PODR, 1U)
+#define R_PIN_CLEAR(pin)                    R_PIN_WRITE_(pin, PODR, 0U)
+#define R_PIN_WRITE(pin, level)             R_PIN_WRITE_(pin, PODR, (0U != (level)) ? 1U : 0U)
+#define R_PIN_TOGGLE(pin)                   R_PIN_TOGGLE_(pin)
+#define R_PIN_READ(pin)                     R_PIN_READ_(pin)
+
+/* Setup of a pin. R_PIN_OUTPUT sets the output level before the pin becomes an output. */
+#define R_PIN_OUTPUT(pin, level)            do { R_PIN_WRITE_(pin, PODR, (0U != (level)) ? 1U : 0U);                \
+                                                 R_PIN_WRITE_(pin, PMR, 0U); R_PIN_WRITE_(pin, PDR, 1U); } while (0)
+#define R_PIN_INPUT(pin)                    do { R_PIN_WRITE_(pin, PMR, 0U); R_PIN_WRITE_(pin, PDR, 0U); } while (0)
+#define R_PIN_PERIPHERAL(pin)               R_PIN_WRITE_(pin, PMR, 1U)
+#define R_PIN_DRIVE(pin, high)              R_PIN_WRITE_(pin, DSCR, (0U != (high)) ? 1U : 0U)
+
+/* Output of a group; levels gives the output of each pin of the group. */
+#define R_PIN_GROUP_SET(group)              R_PIN_GROUP_UPDATE_(group, PODR, 0xFFU)
+#define R_PIN_GROUP_CLEAR(group)            R_PIN_GROUP_UPDATE_(group, PODR, 0x00U)
+#define R_PIN_GROUP_WRITE(group, levels)    R_PIN_GROUP_UPDATE_(group, PODR, (levels))
+#define R_PIN_GROUP_TOGGLE(group)           R_PIN_GROUP_TOGGLE_(group)
+
+/* Setup of a group, one write per register. */
+#define R_PIN_GROUP_OUTPUT(group, levels)   do { R_PIN_GROUP_UPDATE_(group, PODR, (levels));                        \
+                                                 R_PIN_GROUP_UPDATE_(group, PMR, 0x00U);                            \
+                                                 R_PIN_GROUP_UPDATE_(group, PDR, 0xFFU); } while (0)
+#define R_PIN_GROUP_INPUT(group)            do { R_PIN_GROUP_UPDATE_(group, PMR, 0x00U);                            \
+                                                 R_PIN_GROUP_UPDATE_(group, PDR, 0x00U); } while (0)
+#define R_PIN_GROUP_PERIPHERAL(group)       R_PIN_GROUP_UPDATE_(group, PMR, 0xFFU)
+#define R_PIN_GROUP_DRIVE(group, high)      R_PIN_GROUP_UPDATE_(group, DSCR, (0U != (high)) ? 0xFFU : 0x00U)
+
+/* Implementation. A pin or group argument expands to two arguments before these are invoked, so the macros above
+   pass it on only to these, never to each other. */
+#define R_PIN_PORT_(port, bit)              (PORT ## port)
+#define R_PIN_MASK_(port, bit)              ((uint8_t)(1U << (bit)))
+#define R_PIN_WRITE_(port, bit, reg, value) (PORT ## port.reg.BIT.B ## bit = (value))
+#define R_PIN_TOGGLE_(port, bit)            (PORT ## port.PODR.BIT.B ## bit ^= 1U)
+#define R_PIN_READ_(port, bit)              ((uint8_t)PORT ## port.PIDR.BIT.B ## bit)
+#define R_PIN_GROUP_UPDATE_(port, mask, reg, value)                                                                  \
+    (PORT ## port.reg.BYTE = (uint8_t)((0xFFU == (uint8_t)(mask)) ? (value) :                                        \
+                                       ((PORT ## port.reg.BYTE & (uint8_t)~(uint8_t)(mask)) |                        \
+                                        ((value) & (uint8_t)(mask)))))
+#define R_PIN_GROUP_TOGGLE_(port, mask)     (PORT ## port.PODR.BYTE ^= (uint8_t)(mask))
+
+#endif /* R_PIN_H */
@@ -0,0 +1,164 @@
+/***********************************************************************
+*
+*  FILE        : r_port.c
+*  DESCRIPTION : Multi-pin port output with one register write per
+*                port update.
+*
+*  NOTE: Interrupts are masked from the shadow read to the PODR
+*        store, so an update made by an interrupt between the two
+*        cannot be overwritten with a stale shadow value.
+*
+***********************************************************************/
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include "platform.h"
+#include "r_port.h"
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+#define PORT_PSW_I          (0x00010000UL)
+
+/* Ports present on the RX231, one bit per port number. */
+#define PORT_PRESENT        (0x00067C3FUL)
+#define PORT_IS_PRESENT(port)   (((port) < PORT_IDS) && (0U != ((PORT_PRESENT >> (port)) & 1U)))
+
+/* PODR of a port; the ports' PODR registers are consecutive bytes from PORT0.PODR. */
+#define PORT_PODR(port)     (*(&PORT0.PODR.BYTE + (port)))
+
+/***********************************************************************************************************************
+Private global variables and functions
+***********************************************************************************************************************/
+static uint8_t s_podr[PORT_IDS];
+
+/***********************************************************************************************************************
+* Function Name: R_PORT_Open
+* Description  : Loads the shadow of every port from its PODR. Call after the port initial values are set, before the
+*                first update.
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+void R_PORT_Open(void)
+{
+    uint32_t psw = (uint32_t)get_psw();
+    uint8_t  port;
+
+    clrpsw_i();
+    for (port = 0; port < PORT_IDS; port++)
+    {
+        s_podr[port] = PORT_IS_PRESENT(port) ? PORT_PODR(port) : 0U;
+    }
+    if (0 != (psw & PORT_PSW_I))
+    {
+        setpsw_i();
+    }
+}
+/***********************************************************************************************************************
+End of function R_PORT_Open
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_PORT_Modify
+* Description  : Clears, sets and toggles pins of one port with one PODR write.
+* Arguments    : port -
+*                    Port number (PORT_ID_x).
+*                clear -
+*                    Pins driven low.
+*                set -
+*                    Pins driven high; set wins over clear.
+*                toggle -
+*                    Pins inverted after clear and set.
+* Return Value : false if the port does not exist.
+***********************************************************************************************************************/
+bool R_PORT_Modify(uint8_t port, uint8_t clear, uint8_t set, uint8_t toggle)
+{
+    uint32_t psw;
+    uint8_t  podr;
+
+    if (!PORT_IS_PRESENT(port))
+    {
+        return false;
+    }
+
+    psw = (uint32_t)get_psw();
+    clrpsw_i();
+    podr = (uint8_t)((((uint32_t)s_podr[port] & ~(uint32_t)clear) | set) ^ toggle);
+    s_podr[port] = podr;
+    PORT_PODR(port) = podr;
+    if (0 != (psw & PORT_PSW_I))
+    {
+        setpsw_i();
+    }
+
+    return true;
+}
+/***********************************************************************************************************************
+End of function R_PORT_Modify
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_PORT_ModifyMany
+* Description  : Applies several port updates with interrupts masked once, so that no interrupt sees part of them. An
+*                update of a port that does not exist stops the batch before any port is written.
+* Arguments    : p_updates -
+*                    Updates, applied in order; a port may appear more than once.
+*                count -
+*                    Number of updates.
+* Return Value : false if p_updates is NULL or a port does not exist.
+***********************************************************************************************************************/
+bool R_PORT_ModifyMany(const port_update_t *p_updates, uint32_t count)
+{
+    uint32_t psw;
+    uint32_t i;
+    uint8_t  port;
+    uint8_t  podr;
+
+    if ((NULL == p_updates) && (0U != count))
+    {
+        return false;
+    }
+    for (i = 0; i < count; i++)
+    {
+        if (!PORT_IS_PRESENT(p_updates[i].port))
+        {
+            return false;
+        }
+    }
+
+    psw = (uint32_t)get_psw();
+    clrpsw_i();
+    for (i = 0; i < count; i++)
+    {
+        port = p_updates[i].port;
+        podr = (uint8_t)((((uint32_t)s_podr[port] & ~(uint32_t)p_updates[i].clear) | p_updates[i].set) ^
+                         p_updates[i].toggle);
+        s_podr[port] = podr;
+        PORT_PODR(port) = podr;
+    }
+    if (0 != (psw & PORT_PSW_I))
+    {
+        setpsw_i();
+    }
+
+    return true;
+}
+/***********************************************************************************************************************
+End of function R_PORT_ModifyMany
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_PORT_Read
+* Description  : Returns the output data last written to a port, without a register read.
+* Arguments    : port -
+*                    Port number (PORT_ID_x).
+* Return Value : PODR value, or 0 if the port does not exist.
+***********************************************************************************************************************/
+uint8_t R_PORT_Read(uint8_t port)
+{
+    return PORT_IS_PRESENT(port) ? s_podr[port] : 0U;
+}
+/***********************************************************************************************************************
+End of function R_PORT_Read
+***********************************************************************************************************************/
@@ -0,0 +1,71 @@
+/***********************************************************************
+*
+*  FILE        : r_port.h
+*  DESCRIPTION : Multi-pin port output with one register write per
+*                port update.
+*
+*  NOTE: Each port's output data (PODR) is kept in a shadow byte,
+*        so an update sets, clears and toggles any pins of a port
+*        with one byte store and no register read. After
+*        R_PORT_Open(), every PODR write to a port must go through
+*        this API, from the main loop or from interrupts; bitfield
+*        writes such as 'PORTD.PODR.BIT.B7 = 1' would be undone by
+*        the next update of the port.
+*
+***********************************************************************/
+
+#ifndef R_PORT_H
+#define R_PORT_H
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* Port numbers: the register offset of each port from PORT0. */
+#define PORT_ID_0           (0x00U)
+#define PORT_ID_1           (0x01U)
+#define PORT_ID_2           (0x02U)
+#define PORT_ID_3           (0x03U)
+#define PORT_ID_4           (0x04U)
+#define PORT_ID_5           (0x05U)
+#define PORT_ID_A           (0x0AU)
+#define PORT_ID_B           (0x0BU)
+#define PORT_ID_C           (0x0CU)
+#define PORT_ID_D           (0x0DU)
+#define PORT_ID_E           (0x0EU)
+#define PORT_ID_H           (0x11U)
+#define PORT_ID_J           (0x12U)
+#define PORT_IDS            (0x13U)
+
+#define PORT_PIN(n)         ((uint8_t)(1U << (n)))
+
+#define R_PORT_Set(port, pins)      R_PORT_Modify((port), 0U, (pins), 0U)
+#define R_PORT_Clear(port, pins)    R_PORT_Modify((port), (pins), 0U, 0U)
+#define R_PORT_Toggle(port, pins)   R_PORT_Modify((port), 0U, 0U, (pins))
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+/* One port update: PODR = ((PODR & ~clear) | set) ^ toggle. */
+typedef struct st_port_update
+{
+    uint8_t     port;
+    uint8_t     clear;
+    uint8_t     set;
+    uint8_t     toggle;
+} port_update_t;
+
+/***********************************************************************************************************************
+Exported global functions (to be accessed by other files)
+***********************************************************************************************************************/
+void    R_PORT_Open(void);
+bool    R_PORT_Modify(uint8_t port, uint8_t clear, uint8_t set, uint8_t toggle);
+bool    R_PORT_ModifyMany(const port_update_t *p_updates, uint32_t count);
+uint8_t R_PORT_Read(uint8_t port);
+
+#endif /* R_PORT_H */
@@ -0,0 +1,137 @@
+/***********************************************************************
+*
+*  FILE        : r_profile.c
+*  DESCRIPTION : Function-level profiling table.
+*
+*  NOTE: A site may be profiled from the main loop and from
+*        interrupts; each update masks interrupts for a few
+*        instructions.
+*
+***********************************************************************/
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include "platform.h"
+#include "r_profile.h"
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+#define PROFILE_PSW_I       (0x00010000UL)
+
+/***********************************************************************************************************************
+Private global variables and functions
+***********************************************************************************************************************/
+static r_profile_clock_t    s_p_clock;
+static profile_site_t       s_sites[PROFILE_CFG_SITES];
+
+/***********************************************************************************************************************
+* Function Name: R_PROFILE_Open
+* Description  : Sets the clock and clears every site.
+* Arguments    : p_clock -
+*                    Free-running 32-bit clock, or NULL to stop timing (scopes then record 0).
+* Return Value : none
+***********************************************************************************************************************/
+void R_PROFILE_Open(r_profile_clock_t p_clock)
+{
+    uint32_t psw = (uint32_t)get_psw();
+    uint32_t site;
+
+    clrpsw_i();
+    s_p_clock = p_clock;
+    for (site = 0; site < PROFILE_CFG_SITES; site++)
+    {
+        s_sites[site].calls = 0U;
+        s_sites[site].max = 0U;
+        s_sites[site].total = 0U;
+    }
+    if (0 != (psw & PROFILE_PSW_I))
+    {
+        setpsw_i();
+    }
+}
+/***********************************************************************************************************************
+End of function R_PROFILE_Open
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_PROFILE_Now
+* Description  : Reads the profiling clock.
+* Arguments    : none
+* Return Value : Clock counts, or 0 without a clock.
+***********************************************************************************************************************/
+uint32_t R_PROFILE_Now(void)
+{
+    return (NULL != s_p_clock) ? s_p_clock() : 0U;
+}
+/***********************************************************************************************************************
+End of function R_PROFILE_Now
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_PROFILE_Record
+* Description  : Adds one scope to a site. Called by PROFILE_END.
+* Arguments    : site -
+*                    Site number (0 to PROFILE_CFG_SITES - 1); others are ignored.
+*                elapsed -
+*                    Length of the scope in clock counts.
+* Return Value : none
+***********************************************************************************************************************/
+void R_PROFILE_Record(uint32_t site, uint32_t elapsed)
+{
+    uint32_t psw;
+
+    if (site >= PROFILE_CFG_SITES)
+    {
+        return;
+    }
+
+    psw = (uint32_t)get_psw();
+    clrpsw_i();
+    s_sites[site].calls++;
+    s_sites[site].total += elapsed;
+    if (elapsed > s_sites[site].max)
+    {
+        s_sites[site].max = elapsed;
+    }
+    if (0 != (psw & PROFILE_PSW_I))
+    {
+        setpsw_i();
+    }
+}
+/***********************************************************************************************************************
+End of function R_PROFILE_Record
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_PROFILE_GetSite
+* Description  : Copies the statistics of a site.
+* Arguments    : site -
+*                    Site number.
+*                p_site -
+*                    Receives the statistics.
+* Return Value : false if the site number or p_site is invalid.
+***********************************************************************************************************************/
+bool R_PROFILE_GetSite(uint32_t site, profile_site_t *p_site)
+{
+    uint32_t psw;
+
+    if ((site >= PROFILE_CFG_SITES) || (NULL == p_site))
+    {
+        return false;
+    }
+
+    psw = (uint32_t)get_psw();
+    clrpsw_i();
+    *p_site = s_sites[site];
+    if (0 != (psw & PROFILE_PSW_I))
+    {
+        setpsw_i();
+    }
+
+    return true;
+}
+/***********************************************************************************************************************
+End of function R_PROFILE_GetSite
+***********************************************************************************************************************/
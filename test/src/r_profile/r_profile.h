@@ -0,0 +1,67 @@
+/***********************************************************************
+*
+*  FILE        : r_profile.h
+*  DESCRIPTION : Function-level profiling scopes with per-site call
+*                counts, total and maximum durations.
+*
+*  NOTE: PROFILE_BEGIN(site) opens a block and PROFILE_END(site)
+*        closes it, so a missing or misplaced end does not compile;
+*        both must be given the same site token (a macro or a const
+*        variable naming the site number).
+*        Durations are differences of a free-running 32-bit clock
+*        set with R_PROFILE_Open(), normally the PCLKB/8 count of
+*        R_Config_CMT1_GetCount32(); a scope must end within one
+*        turn of that clock (21 minutes at PCLKB 27 MHz). With
+*        PROFILE_CFG_ENABLE 0 the scopes cost nothing.
+*
+***********************************************************************/
+
+#ifndef R_PROFILE_H
+#define R_PROFILE_H
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* 1 to compile PROFILE_BEGIN/END scopes in, 0 to leave them empty. */
+#ifndef PROFILE_CFG_ENABLE
+#define PROFILE_CFG_ENABLE          (0)
+#endif
+
+/* Sites in the table; site numbers are assigned by the application from 0. */
+#define PROFILE_CFG_SITES           (16U)
+
+#if PROFILE_CFG_ENABLE == 1
+#define PROFILE_BEGIN(site)         { uint32_t const r_profile_begin_ ## site = R_PROFILE_Now();
+#define PROFILE_END(site)           R_PROFILE_Record((site), R_PROFILE_Now() - r_profile_begin_ ## site); }
+#else
+#define PROFILE_BEGIN(site)         {
+#define PROFILE_END(site)           }
+#endif
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+typedef uint32_t (*r_profile_clock_t)(void);
+
+typedef struct st_profile_site
+{
+    uint32_t    calls;
+    uint32_t    max;        /* Longest scope, in clock counts */
+    uint64_t    total;      /* Sum of all scopes, in clock counts */
+} profile_site_t;
+
+/***********************************************************************************************************************
+Exported global functions (to be accessed by other files)
+***********************************************************************************************************************/
+void     R_PROFILE_Open(r_profile_clock_t p_clock);
+uint32_t R_PROFILE_Now(void);
+void     R_PROFILE_Record(uint32_t site, uint32_t elapsed);
+bool     R_PROFILE_GetSite(uint32_t site, profile_site_t *p_site);
+
+#endif /* R_PROFILE_H */
@@ -0,0 +1,356 @@
+/***********************************************************************
+*
+*  FILE        : r_retain.c
+*  DESCRIPTION : Data retained over software and watchdog resets.
+*
+*  NOTE: R_RETAIN_Open() runs before _INITSCT(), so it uses no
+*        initialized data; its record lives in the RETAIN section
+*        itself and is left out of the checksum.
+*        CC-RX places RETAIN objects by alignment, in BRETAIN (4),
+*        BRETAIN_2 (2) and BRETAIN_1 (1); the three are cleared,
+*        sized and checksummed as one section.
+*
+***********************************************************************/
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include "platform.h"
+#include "r_initsct.h"
+#include "r_retain.h"
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+#define RETAIN_MAGIC            (0x52544E31UL)
+
+/* Fletcher-32 over bytes: the sums are reduced once per block, before the second can overflow. */
+#define RETAIN_SUM_MOD          (65535UL)
+#define RETAIN_SUM_BLOCK        (4096U)
+
+/* Reset flags in RSTSR0 and RSTSR2 */
+#define RETAIN_RSTSR0_PORF      (0x01U)
+#define RETAIN_RSTSR0_LVDRF     (0x0EU)
+#define RETAIN_RSTSR2_IWDTRF    (0x01U)
+#define RETAIN_RSTSR2_WDTRF     (0x02U)
+#define RETAIN_RSTSR2_SWRF      (0x04U)
+
+/* BRETAIN, BRETAIN_2 and BRETAIN_1 */
+#define RETAIN_AREAS            (3U)
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+typedef struct st_retain_record
+{
+    uint32_t    magic;
+    uint32_t    size;                           /* Size of the section when sealed */
+    uint32_t    sum;                            /* Fletcher-32 of the section less this record */
+    uint8_t     cause;                          /* retain_cause_t of the last reset */
+    uint8_t     start;                          /* retain_start_t of the last reset */
+} retain_record_t;
+
+/***********************************************************************************************************************
+Private global variables and functions
+***********************************************************************************************************************/
+#if defined(RX_HOST_BUILD)
+static retain_record_t s_record __attribute__((section("rx_retain")));
+#else
+#pragma section B RETAIN
+static retain_record_t s_record;
+#pragma section
+#endif
+
+static uint8_t  *retain_area(uint32_t area, uint32_t *p_size);
+static uint32_t retain_size(void);
+static uint32_t retain_sum(void);
+static void     retain_sum_area(const uint8_t *p_area, uint32_t size, uint32_t *p_a, uint32_t *p_b);
+
+/***********************************************************************************************************************
+* Function Name: R_RETAIN_Open
+* Description  : Keeps or clears the RETAIN section according to the cause of the reset, then seals it. Called at
+*                reset entry, before _INITSCT().
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+void R_RETAIN_Open(void)
+{
+    uint8_t        *p_area;
+    uint32_t       size;
+    uint32_t       area;
+    uint8_t        rstsr0 = SYSTEM.RSTSR0.BYTE;
+    uint8_t        rstsr2 = SYSTEM.RSTSR2.BYTE;
+    retain_cause_t cause;
+    retain_start_t start;
+
+    if ((0U == SYSTEM.RSTSR1.BIT.CWSF) || (0U != (rstsr0 & RETAIN_RSTSR0_PORF)))
+    {
+        cause = RETAIN_CAUSE_POWER_ON;
+    }
+    else if (0U != (rstsr0 & RETAIN_RSTSR0_LVDRF))
+    {
+        cause = RETAIN_CAUSE_LVD;
+    }
+    else if (0U != (rstsr2 & RETAIN_RSTSR2_IWDTRF))
+    {
+        cause = RETAIN_CAUSE_IWDT;
+    }
+    else if (0U != (rstsr2 & RETAIN_RSTSR2_WDTRF))
+    {
+        cause = RETAIN_CAUSE_WDT;
+    }
+    else if (0U != (rstsr2 & RETAIN_RSTSR2_SWRF))
+    {
+        cause = RETAIN_CAUSE_SOFTWARE;
+    }
+    else
+    {
+        cause = RETAIN_CAUSE_PIN;
+    }
+
+    if (cause < RETAIN_CAUSE_SOFTWARE)
+    {
+        start = RETAIN_START_COLD;
+    }
+    else
+    {
+        start = (true == R_RETAIN_IsSealed()) ? RETAIN_START_WARM : RETAIN_START_INVALID;
+    }
+    if (RETAIN_START_WARM != start)
+    {
+        for (area = 0U; area < RETAIN_AREAS; area++)
+        {
+            p_area = retain_area(area, &size);
+            R_INITSCT_Zero(p_area, size);
+        }
+    }
+
+    /* The flags are cleared by writing 0 after reading them as 1; CWSF is set by writing 1 and only a power-on
+       reset clears it. */
+    SYSTEM.RSTSR0.BYTE = 0U;
+    SYSTEM.RSTSR2.BYTE = 0U;
+    SYSTEM.RSTSR1.BIT.CWSF = 1U;
+
+    s_record.cause = (uint8_t)cause;
+    s_record.start = (uint8_t)start;
+    R_RETAIN_Seal();
+}
+/***********************************************************************************************************************
+End of function R_RETAIN_Open
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_RETAIN_Cause
+* Description  : Returns the cause of the last reset, as R_RETAIN_Open() found it.
+* Arguments    : none
+* Return Value : Cause.
+***********************************************************************************************************************/
+retain_cause_t R_RETAIN_Cause(void)
+{
+    return (retain_cause_t)s_record.cause;
+}
+/***********************************************************************************************************************
+End of function R_RETAIN_Cause
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_RETAIN_Start
+* Description  : Returns whether R_RETAIN_Open() kept the RETAIN section at the last reset.
+* Arguments    : none
+* Return Value : RETAIN_START_WARM if it was kept.
+***********************************************************************************************************************/
+retain_start_t R_RETAIN_Start(void)
+{
+    return (retain_start_t)s_record.start;
+}
+/***********************************************************************************************************************
+End of function R_RETAIN_Start
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_RETAIN_Seal
+* Description  : Records the checksum of the RETAIN section, for the next reset to check.
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+void R_RETAIN_Seal(void)
+{
+    s_record.magic = RETAIN_MAGIC;
+    s_record.size = retain_size();
+    s_record.sum = retain_sum();
+}
+/***********************************************************************************************************************
+End of function R_RETAIN_Seal
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_RETAIN_IsSealed
+* Description  : Checks the RETAIN section against the last R_RETAIN_Seal().
+* Arguments    : none
+* Return Value : true if it is unchanged since.
+***********************************************************************************************************************/
+bool R_RETAIN_IsSealed(void)
+{
+    return ((RETAIN_MAGIC == s_record.magic) &&
+            (s_record.size == retain_size()) &&
+            (s_record.sum == retain_sum()));
+}
+/***********************************************************************************************************************
+End of function R_RETAIN_IsSealed
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_RETAIN_Reset
+* Description  : Seals the RETAIN section and makes a software reset, after which it is kept.
+* Arguments    : none
+* Return Value : Does not return.
+***********************************************************************************************************************/
+void R_RETAIN_Reset(void)
+{
+    R_RETAIN_Seal();
+
+    /* Left disabled: the reset clears PRCR and the BSP's nesting counts with it. */
+    R_BSP_RegisterProtectDisable(BSP_REG_PROTECT_LPC_CGC_SWR);
+    SYSTEM.SWRR = 0xA501U;
+
+    for (;;)
+    {
+        nop();
+    }
+}
+/***********************************************************************************************************************
+End of function R_RETAIN_Reset
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: retain_area
+* Description  : Returns one of the sections that make up the RETAIN section.
+* Arguments    : area -
+*                    0 for BRETAIN, 1 for BRETAIN_2, 2 for BRETAIN_1.
+*                p_size -
+*                    Size of the section.
+* Return Value : Start of the section.
+***********************************************************************************************************************/
+static uint8_t *retain_area(uint32_t area, uint32_t *p_size)
+{
+    uint8_t *p_top;
+    uint8_t *p_end;
+
+    if (0U == area)
+    {
+        p_top = (uint8_t *)__sectop("BRETAIN");
+        p_end = (uint8_t *)__secend("BRETAIN");
+    }
+    else if (1U == area)
+    {
+        p_top = (uint8_t *)__sectop("BRETAIN_2");
+        p_end = (uint8_t *)__secend("BRETAIN_2");
+    }
+    else
+    {
+        p_top = (uint8_t *)__sectop("BRETAIN_1");
+        p_end = (uint8_t *)__secend("BRETAIN_1");
+    }
+
+    *p_size = (uint32_t)(p_end - p_top);
+    return p_top;
+}
+/***********************************************************************************************************************
+End of function retain_area
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: retain_size
+* Description  : Returns the size of the RETAIN section.
+* Arguments    : none
+* Return Value : Total size of BRETAIN, BRETAIN_2 and BRETAIN_1.
+***********************************************************************************************************************/
+static uint32_t retain_size(void)
+{
+    uint32_t total = 0U;
+    uint32_t size;
+    uint32_t area;
+
+    for (area = 0U; area < RETAIN_AREAS; area++)
+    {
+        (void)retain_area(area, &size);
+        total += size;
+    }
+    return total;
+}
+/***********************************************************************************************************************
+End of function retain_size
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: retain_sum
+* Description  : Computes the Fletcher-32 checksum of the RETAIN section, less the record.
+* Arguments    : none
+* Return Value : Checksum.
+***********************************************************************************************************************/
+static uint32_t retain_sum(void)
+{
+    const uint8_t *p_rec = (const uint8_t *)&s_record;
+    const uint8_t *p_top;
+    uint32_t      size;
+    uint32_t      area;
+    uint32_t      a = 0U;
+    uint32_t      b = 0U;
+
+    for (area = 0U; area < RETAIN_AREAS; area++)
+    {
+        p_top = retain_area(area, &size);
+        if ((p_rec >= p_top) && (p_rec < (p_top + size)))
+        {
+            retain_sum_area(p_top, (uint32_t)(p_rec - p_top), &a, &b);
+            retain_sum_area(p_rec + sizeof(s_record), (uint32_t)((p_top + size) - (p_rec + sizeof(s_record))), &a,
+                            &b);
+        }
+        else
+        {
+            retain_sum_area(p_top, size, &a, &b);
+        }
+    }
+
+    return (b << 16) | a;
+}
+/***********************************************************************************************************************
+End of function retain_sum
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: retain_sum_area
+* Description  : Adds bytes to the Fletcher-32 sums.
+* Arguments    : p_area -
+*                    Bytes.
+*                size -
+*                    Number of bytes.
+*                p_a, p_b -
+*                    Sums, each below 65535.
+* Return Value : none
+***********************************************************************************************************************/
+static void retain_sum_area(const uint8_t *p_area, uint32_t size, uint32_t *p_a, uint32_t *p_b)
+{
+    uint32_t a = *p_a;
+    uint32_t b = *p_b;
+    uint32_t block;
+
+    while (0U != size)
+    {
+        block = (size < RETAIN_SUM_BLOCK) ? size : RETAIN_SUM_BLOCK;
+        size -= block;
+        for (; 0U != block; block--)
+        {
+            a += *p_area++;
+            b += a;
+        }
+        a %= RETAIN_SUM_MOD;
+        b %= RETAIN_SUM_MOD;
+    }
+
+    *p_a = a;
+    *p_b = b;
+}
+/***********************************************************************************************************************
+End of function retain_sum_area
+***********************************************************************************************************************/
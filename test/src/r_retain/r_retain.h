@@ -0,0 +1,84 @@
+/***********************************************************************
+*
+*  FILE        : r_retain.h
+*  DESCRIPTION : Data retained over software and watchdog resets.
+*
+*  NOTE: Variables placed in the RETAIN section keep their values over
+*        a software, WDT or IWDT reset:
+*            #pragma section B RETAIN
+*            static uint32_t s_fault_count;
+*            #pragma section
+*        CC-RX puts them in BRETAIN, BRETAIN_2 or BRETAIN_1 by
+*        alignment; the linker places the three together and they
+*        are handled as one section. _INITSCT() does not initialize
+*        it. RETAIN_OPEN() at reset entry reads the cause from
+*        RSTSR0-2 and keeps the section only if the reset was a
+*        software or watchdog reset of a warm-started MCU
+*        (RSTSR1.CWSF) and the section still matches the checksum of
+*        the last R_RETAIN_Seal(); otherwise it clears the section.
+*        Either way it clears the reset flags for the next reset and
+*        seals the section.
+*        Call R_RETAIN_Seal() after each change to the section, with
+*        interrupts masked if an interrupt changes it too; a watchdog
+*        reset before the seal loses the section. Every RX231 reset
+*        returns the clock registers to their reset values, so the
+*        clock set-up runs after warm resets as well.
+*        With RETAIN_CFG_ENABLE 0 the section is never cleared.
+*
+***********************************************************************/
+
+#ifndef R_RETAIN_H
+#define R_RETAIN_H
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* 1 to keep the RETAIN section over software and watchdog resets, 0 to leave it to the application. */
+#ifndef RETAIN_CFG_ENABLE
+#define RETAIN_CFG_ENABLE           (0)
+#endif
+
+#if RETAIN_CFG_ENABLE == 1
+#define RETAIN_OPEN()               R_RETAIN_Open()
+#else
+#define RETAIN_OPEN()
+#endif
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+/* Cause of the last reset, from the reset status registers. */
+typedef enum e_retain_cause
+{
+    RETAIN_CAUSE_POWER_ON = 0,      /* RSTSR0.PORF, or RSTSR1.CWSF still 0 */
+    RETAIN_CAUSE_LVD,               /* RSTSR0.LVD0RF, LVD1RF or LVD2RF */
+    RETAIN_CAUSE_PIN,               /* No flag: the RES# pin */
+    RETAIN_CAUSE_SOFTWARE,          /* RSTSR2.SWRF */
+    RETAIN_CAUSE_WDT,               /* RSTSR2.WDTRF */
+    RETAIN_CAUSE_IWDT               /* RSTSR2.IWDTRF */
+} retain_cause_t;
+
+typedef enum e_retain_start
+{
+    RETAIN_START_COLD = 0,          /* Cleared: not a software or watchdog reset */
+    RETAIN_START_WARM,              /* Kept */
+    RETAIN_START_INVALID            /* Cleared: a warm reset, but the section did not match its checksum */
+} retain_start_t;
+
+/***********************************************************************************************************************
+Exported global functions (to be accessed by other files)
+***********************************************************************************************************************/
+void            R_RETAIN_Open(void);
+retain_cause_t  R_RETAIN_Cause(void);
+retain_start_t  R_RETAIN_Start(void);
+void            R_RETAIN_Seal(void);
+bool            R_RETAIN_IsSealed(void);
+void            R_RETAIN_Reset(void);
+
+#endif /* R_RETAIN_H */
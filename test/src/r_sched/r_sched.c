@@ -0,0 +1,279 @@
+/***********************************************************************
+*
+*  FILE        : r_sched.c
+*  DESCRIPTION : Run-to-completion task scheduler.
+*
+*  NOTE: The RX CPU has no count-leading-zeros instruction, so the
+*        highest priority ready task is found by isolating the lowest
+*        set bit of the bitmap and looking up its position with a
+*        de Bruijn multiply. The state is in zero-initialised data,
+*        so tasks can be created before main() is entered.
+*
+***********************************************************************/
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include "platform.h"
+#include "r_sched.h"
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+#define SCHED_PSW_I         (0x00010000UL)
+#define SCHED_DE_BRUIJN     (0x077CB531U)
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+typedef struct st_sched_task
+{
+    r_sched_task_t  p_task;
+    void            *p_context;
+} sched_task_t;
+
+/***********************************************************************************************************************
+Private global variables and functions
+***********************************************************************************************************************/
+/* Bit position of a power of two, indexed by the top five bits of its product with SCHED_DE_BRUIJN. */
+static const uint8_t s_bit_index[32] =
+{
+    0U,  1U,  28U, 2U,  29U, 14U, 24U, 3U,  30U, 22U, 20U, 15U, 25U, 17U, 4U,  8U,
+    31U, 27U, 13U, 23U, 21U, 19U, 16U, 7U,  26U, 12U, 18U, 6U,  11U, 5U,  10U, 9U
+};
+
+static sched_task_t         s_tasks[SCHED_PRIORITIES];
+static volatile uint32_t    s_ready;                /* Bit n set when the task at priority n is to run */
+static r_sched_idle_hook_t  s_p_idle_hook;
+
+static uint32_t sched_lock(void);
+static void     sched_unlock(uint32_t psw);
+
+/***********************************************************************************************************************
+* Function Name: R_SCHED_Create
+* Description  : Assigns a task to a free priority level.
+* Arguments    : priority -
+*                    Priority level (0, the highest, to SCHED_PRIORITIES - 1).
+*                p_task -
+*                    Function run each time the task is posted.
+*                p_context -
+*                    Argument passed to p_task.
+* Return Value : SCHED_SUCCESS, SCHED_ERR_NULL_PTR, SCHED_ERR_INVALID_ARG or SCHED_ERR_IN_USE.
+***********************************************************************************************************************/
+sched_err_t R_SCHED_Create(uint32_t priority, r_sched_task_t p_task, void *p_context)
+{
+    uint32_t    psw;
+    sched_err_t err = SCHED_SUCCESS;
+
+    if (NULL == p_task)
+    {
+        return SCHED_ERR_NULL_PTR;
+    }
+
+    if (priority >= SCHED_PRIORITIES)
+    {
+        return SCHED_ERR_INVALID_ARG;
+    }
+
+    psw = sched_lock();
+    if (NULL != s_tasks[priority].p_task)
+    {
+        err = SCHED_ERR_IN_USE;
+    }
+    else
+    {
+        s_tasks[priority].p_task = p_task;
+        s_tasks[priority].p_context = p_context;
+    }
+    sched_unlock(psw);
+
+    return err;
+}
+/***********************************************************************************************************************
+End of function R_SCHED_Create
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_SCHED_Delete
+* Description  : Frees a priority level. A pending post of its task is discarded.
+* Arguments    : priority -
+*                    Priority level of the task.
+* Return Value : SCHED_SUCCESS, SCHED_ERR_INVALID_ARG or SCHED_ERR_NO_TASK.
+***********************************************************************************************************************/
+sched_err_t R_SCHED_Delete(uint32_t priority)
+{
+    uint32_t    psw;
+    sched_err_t err = SCHED_SUCCESS;
+
+    if (priority >= SCHED_PRIORITIES)
+    {
+        return SCHED_ERR_INVALID_ARG;
+    }
+
+    psw = sched_lock();
+    if (NULL == s_tasks[priority].p_task)
+    {
+        err = SCHED_ERR_NO_TASK;
+    }
+    else
+    {
+        s_ready &= ~(1UL << priority);
+        s_tasks[priority].p_task = NULL;
+        s_tasks[priority].p_context = NULL;
+    }
+    sched_unlock(psw);
+
+    return err;
+}
+/***********************************************************************************************************************
+End of function R_SCHED_Delete
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_SCHED_Post
+* Description  : Makes a task ready to run. May be called from an interrupt.
+* Arguments    : priority -
+*                    Priority level of the task.
+* Return Value : SCHED_SUCCESS, SCHED_ERR_INVALID_ARG or SCHED_ERR_NO_TASK.
+***********************************************************************************************************************/
+sched_err_t R_SCHED_Post(uint32_t priority)
+{
+    uint32_t    psw;
+    sched_err_t err = SCHED_SUCCESS;
+
+    if (priority >= SCHED_PRIORITIES)
+    {
+        return SCHED_ERR_INVALID_ARG;
+    }
+
+    psw = sched_lock();
+    if (NULL == s_tasks[priority].p_task)
+    {
+        err = SCHED_ERR_NO_TASK;
+    }
+    else
+    {
+        s_ready |= (1UL << priority);
+    }
+    sched_unlock(psw);
+
+    return err;
+}
+/***********************************************************************************************************************
+End of function R_SCHED_Post
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_SCHED_RunOnce
+* Description  : Runs the highest priority ready task, if any. Its bit is cleared first, so a post made while it runs
+*                makes it ready again.
+* Arguments    : none
+* Return Value : true if a task ran.
+***********************************************************************************************************************/
+bool R_SCHED_RunOnce(void)
+{
+    uint32_t        psw;
+    uint32_t        ready;
+    uint32_t        priority;
+    r_sched_task_t  p_task;
+    void            *p_context;
+
+    psw = sched_lock();
+    ready = s_ready;
+    if (0U == ready)
+    {
+        sched_unlock(psw);
+        return false;
+    }
+
+    priority = s_bit_index[(uint32_t)((ready & (0U - ready)) * SCHED_DE_BRUIJN) >> 27];
+    s_ready = ready & ~(1UL << priority);
+    p_task = s_tasks[priority].p_task;
+    p_context = s_tasks[priority].p_context;
+    sched_unlock(psw);
+
+    p_task(p_context);
+
+    return true;
+}
+/***********************************************************************************************************************
+End of function R_SCHED_RunOnce
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_SCHED_Run
+* Description  : Runs ready tasks, and the idle hook when there are none. Does not return.
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+void R_SCHED_Run(void)
+{
+    uint32_t psw;
+
+    while (1)
+    {
+        if (false == R_SCHED_RunOnce())
+        {
+            /* Checked again with interrupts masked, so that a post cannot slip in before the hook waits. */
+            psw = sched_lock();
+            if ((0U == s_ready) && (NULL != s_p_idle_hook))
+            {
+                s_p_idle_hook();
+            }
+            sched_unlock(psw);
+        }
+    }
+}
+/***********************************************************************************************************************
+End of function R_SCHED_Run
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_SCHED_SetIdleHook
+* Description  : Sets the function R_SCHED_Run() calls when no task is ready.
+* Arguments    : p_hook -
+*                    Idle hook, or NULL to spin.
+* Return Value : none
+***********************************************************************************************************************/
+void R_SCHED_SetIdleHook(r_sched_idle_hook_t p_hook)
+{
+    s_p_idle_hook = p_hook;
+}
+/***********************************************************************************************************************
+End of function R_SCHED_SetIdleHook
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: sched_lock
+* Description  : Masks interrupts.
+* Arguments    : none
+* Return Value : PSW before masking, for sched_unlock().
+***********************************************************************************************************************/
+static uint32_t sched_lock(void)
+{
+    uint32_t psw = (uint32_t)get_psw();
+
+    clrpsw_i();
+    return psw;
+}
+/***********************************************************************************************************************
+End of function sched_lock
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: sched_unlock
+* Description  : Unmasks interrupts if they were enabled when sched_lock() was called.
+* Arguments    : psw -
+*                    Value returned by sched_lock().
+* Return Value : none
+***********************************************************************************************************************/
+static void sched_unlock(uint32_t psw)
+{
+    if (0 != (psw & SCHED_PSW_I))
+    {
+        setpsw_i();
+    }
+}
+/***********************************************************************************************************************
+End of function sched_unlock
+***********************************************************************************************************************/
@@ -0,0 +1,59 @@
+/***********************************************************************
+*
+*  FILE        : r_sched.h
+*  DESCRIPTION : Run-to-completion task scheduler with fixed priority
+*                levels, for the main loop.
+*
+*  NOTE: There is one task per priority level, 0 being the highest.
+*        Posting a task, from an interrupt or from another task, sets
+*        its bit in a ready bitmap; the main loop runs the highest
+*        ready task to completion, found in constant time from the
+*        lowest set bit. Posts to a task that is already ready are
+*        merged into one run. With nothing ready, the idle hook runs.
+*
+***********************************************************************/
+
+#ifndef R_SCHED_H
+#define R_SCHED_H
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* Priority levels, one bit each in the ready bitmap. */
+#define SCHED_PRIORITIES            (32U)
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+typedef enum e_sched_err
+{
+    SCHED_SUCCESS = 0,
+    SCHED_ERR_NULL_PTR,
+    SCHED_ERR_INVALID_ARG,
+    SCHED_ERR_IN_USE,
+    SCHED_ERR_NO_TASK
+} sched_err_t;
+
+typedef void (*r_sched_task_t)(void *p_context);
+
+/* Called by R_SCHED_Run() with interrupts masked when no task is ready. It may wait for an interrupt, provided it
+   unmasks interrupts only as part of the wait; the scheduler restores them on return. */
+typedef void (*r_sched_idle_hook_t)(void);
+
+/***********************************************************************************************************************
+Exported global functions (to be accessed by other files)
+***********************************************************************************************************************/
+sched_err_t R_SCHED_Create(uint32_t priority, r_sched_task_t p_task, void *p_context);
+sched_err_t R_SCHED_Delete(uint32_t priority);
+sched_err_t R_SCHED_Post(uint32_t priority);
+bool        R_SCHED_RunOnce(void);
+void        R_SCHED_Run(void);
+void        R_SCHED_SetIdleHook(r_sched_idle_hook_t p_hook);
+
+#endif /* R_SCHED_H */
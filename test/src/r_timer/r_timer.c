@@ -0,0 +1,560 @@
+/***********************************************************************
+*
+*  FILE        : r_timer.c
+*  DESCRIPTION : Software timers on a hierarchical timing wheel.
+*
+*  NOTE: Level n holds timers by their expiry tick divided by 64^n.
+*        When a unit of level n starts, the slot for the unit after it
+*        is spliced onto the level's cascade list, and its timers are
+*        re-filed into level n-1 a few per tick during the unit, so
+*        they are in place before the first of them is due.
+*
+***********************************************************************/
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include "platform.h"
+#include "r_timer.h"
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+#define TIMER_SLOT_MASK     (TIMER_WHEEL_SLOTS - 1U)
+#define TIMER_SHIFT(level)  (TIMER_WHEEL_BITS * (level))
+#define TIMER_TOP           (TIMER_WHEEL_LEVELS - 1)
+#define TIMER_PSW_I         (0x00010000UL)
+
+/***********************************************************************************************************************
+Private global variables and functions
+***********************************************************************************************************************/
+static timer_link_t s_wheel[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+static timer_link_t s_cascade[TIMER_TOP];  /* Timers waiting to be re-filed from level n + 1 */
+static timer_link_t s_expired;              /* Timers waiting for their callback */
+static uint32_t     s_now;
+static uint32_t     s_wake;                 /* Tick at which the next tick interrupt is due, when tickless */
+static r_timer_idle_hook_t s_p_idle_hook;
+
+static void     list_init(timer_link_t *p_head);
+static void     list_append(timer_link_t *p_head, timer_link_t *p_link);
+static void     list_remove(timer_link_t *p_link);
+static void     list_splice(timer_link_t *p_head, timer_link_t *p_from);
+static void     timer_file(r_timer_t *p_timer);
+static bool     list_is_empty(const timer_link_t *p_head);
+static uint32_t timer_lock(void);
+static void     timer_unlock(uint32_t psw);
+
+/***********************************************************************************************************************
+* Function Name: R_TIMER_Open
+* Description  : Empties the wheel and sets the tick count to 0. Timers started before are forgotten.
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+void R_TIMER_Open(void)
+{
+    uint32_t level;
+    uint32_t slot;
+    uint32_t psw = timer_lock();
+
+    for (level = 0; level < TIMER_WHEEL_LEVELS; level++)
+    {
+        for (slot = 0; slot < TIMER_WHEEL_SLOTS; slot++)
+        {
+            list_init(&s_wheel[level][slot]);
+        }
+    }
+    for (level = 0; level < TIMER_TOP; level++)
+    {
+        list_init(&s_cascade[level]);
+    }
+    list_init(&s_expired);
+    s_now = 0;
+    s_wake = 1U;
+
+    timer_unlock(psw);
+}
+/***********************************************************************************************************************
+End of function R_TIMER_Open
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_TIMER_Init
+* Description  : Sets up a timer control block as not started. Called once before the timer is first started, and
+*                again for one started before R_TIMER_Open(), which forgets it.
+* Arguments    : p_timer -
+*                    Timer control block.
+* Return Value : TIMER_SUCCESS or TIMER_ERR_NULL_PTR.
+***********************************************************************************************************************/
+timer_err_t R_TIMER_Init(r_timer_t *p_timer)
+{
+    if (NULL == p_timer)
+    {
+        return TIMER_ERR_NULL_PTR;
+    }
+
+    p_timer->link.p_next = NULL;
+    p_timer->link.p_prev = NULL;
+
+    return TIMER_SUCCESS;
+}
+/***********************************************************************************************************************
+End of function R_TIMER_Init
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_TIMER_Start
+* Description  : Starts or restarts a timer. May be called from a timer callback.
+* Arguments    : p_timer -
+*                    Timer control block set up with R_TIMER_Init(), owned by the caller until the timer expires or
+*                    is cancelled.
+*                delay -
+*                    Ticks until the first expiry (1 to 2^31 - 1, less the ticks the wheel is behind when tickless).
+*                period -
+*                    Ticks between further expiries, or 0 for a one-shot timer.
+*                p_callback -
+*                    Function called from the CMT0 interrupt on expiry.
+*                p_context -
+*                    Argument passed to p_callback.
+* Return Value : TIMER_SUCCESS, TIMER_ERR_NULL_PTR or TIMER_ERR_INVALID_ARG.
+***********************************************************************************************************************/
+timer_err_t R_TIMER_Start(r_timer_t *p_timer, uint32_t delay, uint32_t period, r_timer_callback_t p_callback,
+                          void *p_context)
+{
+    uint32_t psw;
+
+    if ((NULL == p_timer) || (NULL == p_callback))
+    {
+        return TIMER_ERR_NULL_PTR;
+    }
+
+    if ((0 == delay) || (delay > INT32_MAX) || (period > INT32_MAX))
+    {
+        return TIMER_ERR_INVALID_ARG;
+    }
+
+    psw = timer_lock();
+
+    /* When tickless, the delay counts from the current tick, which may be ahead of the last one processed. */
+    if (NULL != s_p_idle_hook)
+    {
+        delay += s_p_idle_hook(0);
+        if (delay > INT32_MAX)
+        {
+            timer_unlock(psw);
+            return TIMER_ERR_INVALID_ARG;
+        }
+    }
+
+    if (NULL != p_timer->link.p_next)
+    {
+        list_remove(&p_timer->link);
+    }
+    p_timer->expiry = s_now + delay;
+    p_timer->period = period;
+    p_timer->p_callback = p_callback;
+    p_timer->p_context = p_context;
+    timer_file(p_timer);
+
+    if ((NULL != s_p_idle_hook) && (delay < (s_wake - s_now)))
+    {
+        s_wake = p_timer->expiry;
+        (void)s_p_idle_hook(delay);
+    }
+
+    timer_unlock(psw);
+    return TIMER_SUCCESS;
+}
+/***********************************************************************************************************************
+End of function R_TIMER_Start
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_TIMER_Cancel
+* Description  : Stops a timer. May be called from a timer callback, including the timer's own.
+* Arguments    : p_timer -
+*                    Timer control block.
+* Return Value : TIMER_SUCCESS, TIMER_ERR_NULL_PTR or TIMER_ERR_NOT_ACTIVE.
+***********************************************************************************************************************/
+timer_err_t R_TIMER_Cancel(r_timer_t *p_timer)
+{
+    timer_err_t err = TIMER_SUCCESS;
+    uint32_t    psw;
+
+    if (NULL == p_timer)
+    {
+        return TIMER_ERR_NULL_PTR;
+    }
+
+    psw = timer_lock();
+
+    if (NULL == p_timer->link.p_next)
+    {
+        err = TIMER_ERR_NOT_ACTIVE;
+    }
+    else
+    {
+        list_remove(&p_timer->link);
+    }
+
+    timer_unlock(psw);
+    return err;
+}
+/***********************************************************************************************************************
+End of function R_TIMER_Cancel
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_TIMER_IsActive
+* Description  : Returns whether a timer is started and has not expired (one-shot) or been cancelled.
+* Arguments    : p_timer -
+*                    Timer control block.
+* Return Value : true when active.
+***********************************************************************************************************************/
+bool R_TIMER_IsActive(const r_timer_t *p_timer)
+{
+    return (NULL != p_timer) && (NULL != p_timer->link.p_next);
+}
+/***********************************************************************************************************************
+End of function R_TIMER_IsActive
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_TIMER_GetTicks
+* Description  : Returns the ticks counted since R_TIMER_Open.
+* Arguments    : none
+* Return Value : Tick count (wraps at 2^32).
+***********************************************************************************************************************/
+uint32_t R_TIMER_GetTicks(void)
+{
+    return s_now;
+}
+/***********************************************************************************************************************
+End of function R_TIMER_GetTicks
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_TIMER_Tick
+* Description  : Advances the wheel by one tick and runs a batch of expired timers. Called from the CMT0 compare match
+*                interrupt.
+* Arguments    : none
+* Return Value : none
+***********************************************************************************************************************/
+void R_TIMER_Tick(void)
+{
+    r_timer_t *p_timer;
+    uint32_t  level;
+    uint32_t  count;
+    uint32_t  psw = timer_lock();
+
+    s_now++;
+
+    /* A unit of level n starts whenever the tick count is a multiple of 64^n. */
+    for (level = 1; level < TIMER_WHEEL_LEVELS; level++)
+    {
+        if (0 != (s_now & ((1UL << TIMER_SHIFT(level)) - 1U)))
+        {
+            break;
+        }
+        list_splice(&s_cascade[level - 1], &s_wheel[level][((s_now >> TIMER_SHIFT(level)) + 1U) & TIMER_SLOT_MASK]);
+    }
+
+    /* Lower levels first: their timers are due soonest. */
+    level = 0;
+    for (count = 0; count < TIMER_CFG_CASCADE_MAX; count++)
+    {
+        while ((level < TIMER_TOP) && (true == list_is_empty(&s_cascade[level])))
+        {
+            level++;
+        }
+        if (TIMER_TOP == level)
+        {
+            break;
+        }
+        p_timer = (r_timer_t *)s_cascade[level].p_next;
+        list_remove(&p_timer->link);
+        timer_file(p_timer);
+    }
+
+    list_splice(&s_expired, &s_wheel[0][s_now & TIMER_SLOT_MASK]);
+
+    for (count = 0; (count < TIMER_CFG_DISPATCH_MAX) && (false == list_is_empty(&s_expired)); count++)
+    {
+        p_timer = (r_timer_t *)s_expired.p_next;
+        list_remove(&p_timer->link);
+
+        /* Re-arm before the callback so that it may cancel or restart its own timer. */
+        if (0 != p_timer->period)
+        {
+            p_timer->expiry += p_timer->period;
+            timer_file(p_timer);
+        }
+
+        timer_unlock(psw);
+        p_timer->p_callback(p_timer->p_context);
+        psw = timer_lock();
+    }
+
+    timer_unlock(psw);
+}
+/***********************************************************************************************************************
+End of function R_TIMER_Tick
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_TIMER_GetIdleTicks
+* Description  : Returns how many ticks may pass before R_TIMER_Tick() has work to do, so that a tickless tick source
+*                can skip the tick interrupts in between and call R_TIMER_Tick() for each of them on the next one.
+*                Called from the tick interrupt after the ticks due have been processed.
+* Arguments    : max -
+*                    Longest interval the tick source can count, in ticks (at least 1).
+* Return Value : Ticks until the next tick with work (1 to max).
+***********************************************************************************************************************/
+uint32_t R_TIMER_GetIdleTicks(uint32_t max)
+{
+    uint32_t idle = max;
+    uint32_t ticks;
+    uint32_t unit;
+    uint32_t level;
+    uint32_t psw = timer_lock();
+
+    if ((false == list_is_empty(&s_expired)) || (1U >= max))
+    {
+        idle = 1U;
+    }
+
+    for (level = 0; (level < TIMER_TOP) && (1U != idle); level++)
+    {
+        if (false == list_is_empty(&s_cascade[level]))
+        {
+            idle = 1U;
+        }
+    }
+
+    /* Level 0 holds every timer due up to the end of the next 64-tick unit. */
+    ticks = ((((s_now >> TIMER_WHEEL_BITS) + 2U) << TIMER_WHEEL_BITS) - 1U) - s_now;
+    for (unit = 1U; (unit < idle) && (unit <= ticks); unit++)
+    {
+        if (false == list_is_empty(&s_wheel[0][(s_now + unit) & TIMER_SLOT_MASK]))
+        {
+            idle = unit;
+        }
+    }
+
+    /* Timers in a higher level are due no earlier than the unit spliced at the next boundary of that level. */
+    for (level = 1; level < TIMER_WHEEL_LEVELS; level++)
+    {
+        unit = (s_now >> TIMER_SHIFT(level)) + 1U;
+        ticks = ((unit + 1U) << TIMER_SHIFT(level)) - s_now;
+        while (ticks < idle)
+        {
+            if (false == list_is_empty(&s_wheel[level][(unit + 1U) & TIMER_SLOT_MASK]))
+            {
+                idle = ticks;
+            }
+            unit++;
+            ticks += 1UL << TIMER_SHIFT(level);
+        }
+    }
+
+    s_wake = s_now + idle;
+
+    timer_unlock(psw);
+    return idle;
+}
+/***********************************************************************************************************************
+End of function R_TIMER_GetIdleTicks
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_TIMER_SetIdleHook
+* Description  : Registers the tick source's hook, called by R_TIMER_Start() so that delays count from the current
+*                tick rather than the last one processed, and timers due before the planned tick interrupt bring it
+*                forward.
+* Arguments    : p_hook -
+*                    Hook, or NULL to count delays from the last tick processed.
+* Return Value : none
+***********************************************************************************************************************/
+void R_TIMER_SetIdleHook(r_timer_idle_hook_t p_hook)
+{
+    uint32_t psw = timer_lock();
+
+    s_p_idle_hook = p_hook;
+    s_wake = s_now + 1U;
+
+    timer_unlock(psw);
+}
+/***********************************************************************************************************************
+End of function R_TIMER_SetIdleHook
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: timer_file
+* Description  : Puts a timer in the wheel slot for its expiry, or on the expired list if it is due.
+* Arguments    : p_timer -
+*                    Timer control block (not on any list).
+* Return Value : none
+***********************************************************************************************************************/
+static void timer_file(r_timer_t *p_timer)
+{
+    uint32_t delta = p_timer->expiry - s_now;
+    uint32_t unit;
+    uint32_t level;
+
+    if ((0 == delta) || (delta > INT32_MAX))
+    {
+        list_append(&s_expired, &p_timer->link);
+        return;
+    }
+
+    /* Use the lowest level whose units up to the expiry are no longer filed in the level above. */
+    for (level = 0; level < TIMER_TOP; level++)
+    {
+        if ((((s_now & ((1UL << TIMER_SHIFT(level + 1)) - 1U)) + delta) >> TIMER_SHIFT(level + 1)) <= 1U)
+        {
+            break;
+        }
+    }
+
+    unit = p_timer->expiry >> TIMER_SHIFT(level);
+    if ((TIMER_TOP == level) &&
+        ((((s_now & ((1UL << TIMER_SHIFT(TIMER_TOP)) - 1U)) + delta) >> TIMER_SHIFT(TIMER_TOP)) > TIMER_SLOT_MASK))
+    {
+        /* Beyond the top level: park it in the last unit reachable and re-file it from there. */
+        unit = (s_now >> TIMER_SHIFT(TIMER_TOP)) + TIMER_SLOT_MASK;
+    }
+
+    list_append(&s_wheel[level][unit & TIMER_SLOT_MASK], &p_timer->link);
+}
+/***********************************************************************************************************************
+End of function timer_file
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: list_is_empty
+* Description  : Returns whether a list is empty.
+* Arguments    : p_head -
+*                    List head.
+* Return Value : true when empty.
+***********************************************************************************************************************/
+static bool list_is_empty(const timer_link_t *p_head)
+{
+    return (p_head->p_next == p_head);
+}
+/***********************************************************************************************************************
+End of function list_is_empty
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: list_init
+* Description  : Makes an empty circular list.
+* Arguments    : p_head -
+*                    List head.
+* Return Value : none
+***********************************************************************************************************************/
+static void list_init(timer_link_t *p_head)
+{
+    p_head->p_next = p_head;
+    p_head->p_prev = p_head;
+}
+/***********************************************************************************************************************
+End of function list_init
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: list_append
+* Description  : Adds a node at the tail of a list.
+* Arguments    : p_head -
+*                    List head.
+*                p_link -
+*                    Node to add.
+* Return Value : none
+***********************************************************************************************************************/
+static void list_append(timer_link_t *p_head, timer_link_t *p_link)
+{
+    p_link->p_next = p_head;
+    p_link->p_prev = p_head->p_prev;
+    p_head->p_prev->p_next = p_link;
+    p_head->p_prev = p_link;
+}
+/***********************************************************************************************************************
+End of function list_append
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: list_remove
+* Description  : Removes a node from its list and marks it inactive.
+* Arguments    : p_link -
+*                    Node to remove.
+* Return Value : none
+***********************************************************************************************************************/
+static void list_remove(timer_link_t *p_link)
+{
+    p_link->p_prev->p_next = p_link->p_next;
+    p_link->p_next->p_prev = p_link->p_prev;
+    p_link->p_next = NULL;
+    p_link->p_prev = NULL;
+}
+/***********************************************************************************************************************
+End of function list_remove
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: list_splice
+* Description  : Moves all nodes of one list to the tail of another.
+* Arguments    : p_head -
+*                    Destination list head.
+*                p_from -
+*                    Source list head, left empty.
+* Return Value : none
+***********************************************************************************************************************/
+static void list_splice(timer_link_t *p_head, timer_link_t *p_from)
+{
+    if (p_from->p_next == p_from)
+    {
+        return;
+    }
+
+    p_from->p_next->p_prev = p_head->p_prev;
+    p_head->p_prev->p_next = p_from->p_next;
+    p_from->p_prev->p_next = p_head;
+    p_head->p_prev = p_from->p_prev;
+    list_init(p_from);
+}
+/***********************************************************************************************************************
+End of function list_splice
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: timer_lock
+* Description  : Masks interrupts so the CMT0 interrupt cannot change the wheel.
+* Arguments    : none
+* Return Value : PSW before masking, for timer_unlock().
+***********************************************************************************************************************/
+static uint32_t timer_lock(void)
+{
+    uint32_t psw = (uint32_t)get_psw();
+
+    clrpsw_i();
+    return psw;
+}
+/***********************************************************************************************************************
+End of function timer_lock
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: timer_unlock
+* Description  : Unmasks interrupts if they were enabled when timer_lock() was called.
+* Arguments    : psw -
+*                    Value returned by timer_lock().
+* Return Value : none
+***********************************************************************************************************************/
+static void timer_unlock(uint32_t psw)
+{
+    if (0 != (psw & TIMER_PSW_I))
+    {
+        setpsw_i();
+    }
+}
+/***********************************************************************************************************************
+End of function timer_unlock
+***********************************************************************************************************************/
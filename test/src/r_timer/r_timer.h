@@ -0,0 +1,93 @@
+/***********************************************************************
+*
+*  FILE        : r_timer.h
+*  DESCRIPTION : Software timers on a hierarchical timing wheel, driven
+*                by the CMT0 compare match interrupt (one tick per
+*                compare match).
+*
+*  NOTE: Start, cancel and expiry are O(1). Each tick moves at most
+*        TIMER_CFG_CASCADE_MAX timers between wheel levels and runs at
+*        most TIMER_CFG_DISPATCH_MAX callbacks, so the time spent in
+*        the interrupt does not depend on the number of timers. Work
+*        left over is carried to the next tick. Timers are moved down
+*        one unit of the upper level ahead of time, so they expire on
+*        time unless more than 64 * TIMER_CFG_CASCADE_MAX of them fall
+*        in one 64-tick unit.
+*
+***********************************************************************/
+
+#ifndef R_TIMER_H
+#define R_TIMER_H
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* Callbacks run per tick. */
+#define TIMER_CFG_DISPATCH_MAX      (8)
+
+/* Timers moved from a higher wheel level per tick. */
+#define TIMER_CFG_CASCADE_MAX       (16)
+
+/* Level n counts in units of 64^n ticks. Each level has two turns of 64 slots so that the next unit of the level
+   above can be re-filed into it while the current one runs out. Four levels reach 2^25 ticks; longer delays are
+   parked at the top level and re-filed, and delays must be below 2^31 ticks. */
+#define TIMER_WHEEL_BITS            (6)
+#define TIMER_WHEEL_SLOTS           (2U << TIMER_WHEEL_BITS)
+#define TIMER_WHEEL_LEVELS          (4)
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+typedef enum e_timer_err
+{
+    TIMER_SUCCESS = 0,
+    TIMER_ERR_NULL_PTR,
+    TIMER_ERR_INVALID_ARG,
+    TIMER_ERR_NOT_ACTIVE
+} timer_err_t;
+
+typedef void (*r_timer_callback_t)(void *p_context);
+
+/* Tick source hook, see R_TIMER_SetIdleHook(). Returns the ticks the hardware has counted since the last
+   R_TIMER_Tick() call; when wake is not 0, also makes the tick interrupt come no later than wake ticks after it. */
+typedef uint32_t (*r_timer_idle_hook_t)(uint32_t wake);
+
+/* Doubly linked list node; also the head of every wheel slot list. */
+typedef struct st_timer_link
+{
+    struct st_timer_link *p_next;
+    struct st_timer_link *p_prev;
+} timer_link_t;
+
+/* Timer control block, owned by the caller. Fields are private to r_timer.c; set up with R_TIMER_Init() before the
+   first R_TIMER_Start(), as a block that was not zeroed would look started. */
+typedef struct st_r_timer
+{
+    timer_link_t        link;       /* Must be first */
+    uint32_t            expiry;     /* Tick at which the timer expires */
+    uint32_t            period;     /* Re-arm interval in ticks, 0 for a one-shot timer */
+    r_timer_callback_t  p_callback;
+    void                *p_context;
+} r_timer_t;
+
+/***********************************************************************************************************************
+Exported global functions (to be accessed by other files)
+***********************************************************************************************************************/
+void        R_TIMER_Open(void);
+timer_err_t R_TIMER_Init(r_timer_t *p_timer);
+timer_err_t R_TIMER_Start(r_timer_t *p_timer, uint32_t delay, uint32_t period, r_timer_callback_t p_callback,
+                          void *p_context);
+timer_err_t R_TIMER_Cancel(r_timer_t *p_timer);
+bool        R_TIMER_IsActive(const r_timer_t *p_timer);
+uint32_t    R_TIMER_GetTicks(void);
+void        R_TIMER_Tick(void);
+uint32_t    R_TIMER_GetIdleTicks(uint32_t max);
+void        R_TIMER_SetIdleHook(r_timer_idle_hook_t p_hook);
+
+#endif /* R_TIMER_H */
@@ -0,0 +1,175 @@
+/***********************************************************************
+*
+*  FILE        : r_workq.c
+*  DESCRIPTION : Single-producer, single-consumer work queue.
+*
+*  NOTE: head and tail are free-running counts; head - tail is the
+*        number of queued items, and an index is a count masked by
+*        the power-of-two item count. The item slots are volatile so
+*        that their stores are not moved after the head update; on
+*        the RX, with one core, that is all the ordering needed. On
+*        the host the producer is a thread that may run on another
+*        core, so head and tail are stored with release and loaded
+*        with acquire ordering there.
+*
+***********************************************************************/
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include "platform.h"
+#include "r_workq.h"
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* Stores a count that hands items or slots to the other side, and loads one the other side stores. */
+#if defined(RX_HOST_BUILD)
+#define WORKQ_PUBLISH(p_count, value)   __atomic_store_n((p_count), (value), __ATOMIC_RELEASE)
+#define WORKQ_OBSERVE(p_count)          __atomic_load_n((p_count), __ATOMIC_ACQUIRE)
+#else
+#define WORKQ_PUBLISH(p_count, value)   (*(p_count) = (value))
+#define WORKQ_OBSERVE(p_count)          (*(p_count))
+#endif
+
+/***********************************************************************************************************************
+* Function Name: R_WORKQ_Open
+* Description  : Sets up an empty queue on a caller-provided item array.
+* Arguments    : p_queue -
+*                    Queue control block.
+*                p_items -
+*                    Item storage, owned by the queue until it is no longer used.
+*                count -
+*                    Number of items in p_items (a power of two, 2 or more).
+* Return Value : WORKQ_SUCCESS, WORKQ_ERR_NULL_PTR or WORKQ_ERR_INVALID_ARG.
+***********************************************************************************************************************/
+workq_err_t R_WORKQ_Open(r_workq_t *p_queue, r_workq_item_t *p_items, uint32_t count)
+{
+    if ((NULL == p_queue) || (NULL == p_items))
+    {
+        return WORKQ_ERR_NULL_PTR;
+    }
+
+    if ((count < 2U) || (0U != (count & (count - 1U))))
+    {
+        return WORKQ_ERR_INVALID_ARG;
+    }
+
+    p_queue->p_items = p_items;
+    p_queue->mask = count - 1U;
+    p_queue->head = 0U;
+    p_queue->tail = 0U;
+    p_queue->dropped = 0U;
+
+    return WORKQ_SUCCESS;
+}
+/***********************************************************************************************************************
+End of function R_WORKQ_Open
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_WORKQ_Post
+* Description  : Queues a handler call. Called from the producer only.
+* Arguments    : p_queue -
+*                    Queue control block.
+*                p_handler -
+*                    Function the consumer calls.
+*                p_context -
+*                    Argument passed to p_handler.
+* Return Value : WORKQ_SUCCESS, WORKQ_ERR_NULL_PTR, or WORKQ_ERR_FULL (the item is dropped and counted).
+***********************************************************************************************************************/
+workq_err_t R_WORKQ_Post(r_workq_t *p_queue, r_workq_handler_t p_handler, void *p_context)
+{
+    uint32_t                head;
+    volatile r_workq_item_t *p_item;
+
+    if ((NULL == p_queue) || (NULL == p_handler))
+    {
+        return WORKQ_ERR_NULL_PTR;
+    }
+
+    head = p_queue->head;
+    if ((head - WORKQ_OBSERVE(&p_queue->tail)) > p_queue->mask)
+    {
+        p_queue->dropped++;
+        return WORKQ_ERR_FULL;
+    }
+
+    p_item = &p_queue->p_items[head & p_queue->mask];
+    p_item->p_handler = p_handler;
+    p_item->p_context = p_context;
+
+    /* Publishes the item. */
+    WORKQ_PUBLISH(&p_queue->head, head + 1U);
+
+    return WORKQ_SUCCESS;
+}
+/***********************************************************************************************************************
+End of function R_WORKQ_Post
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_WORKQ_Drain
+* Description  : Calls the handlers of queued items in the order they were posted. Called from the consumer only.
+* Arguments    : p_queue -
+*                    Queue control block.
+*                max -
+*                    Most items to process in this call.
+* Return Value : Number of items processed.
+***********************************************************************************************************************/
+uint32_t R_WORKQ_Drain(r_workq_t *p_queue, uint32_t max)
+{
+    uint32_t                tail;
+    uint32_t                head;
+    uint32_t                count = 0U;
+    r_workq_handler_t       p_handler;
+    void                    *p_context;
+    volatile r_workq_item_t *p_item;
+
+    if (NULL == p_queue)
+    {
+        return 0U;
+    }
+
+    tail = p_queue->tail;
+    head = WORKQ_OBSERVE(&p_queue->head);
+    while ((count < max) && (tail != head))
+    {
+        p_item = &p_queue->p_items[tail & p_queue->mask];
+        p_handler = p_item->p_handler;
+        p_context = p_item->p_context;
+
+        /* Frees the slot before the handler runs, so the producer can reuse it meanwhile. */
+        tail++;
+        WORKQ_PUBLISH(&p_queue->tail, tail);
+
+        p_handler(p_context);
+        count++;
+
+        /* Picks up items posted while the handler ran. */
+        if (tail == head)
+        {
+            head = WORKQ_OBSERVE(&p_queue->head);
+        }
+    }
+
+    return count;
+}
+/***********************************************************************************************************************
+End of function R_WORKQ_Drain
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* Function Name: R_WORKQ_IsEmpty
+* Description  : Returns whether a queue has no items.
+* Arguments    : p_queue -
+*                    Queue control block.
+* Return Value : true when empty.
+***********************************************************************************************************************/
+bool R_WORKQ_IsEmpty(const r_workq_t *p_queue)
+{
+    return (NULL == p_queue) || (WORKQ_OBSERVE(&p_queue->head) == p_queue->tail);
+}
+/***********************************************************************************************************************
+End of function R_WORKQ_IsEmpty
+***********************************************************************************************************************/
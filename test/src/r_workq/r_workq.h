@@ -0,0 +1,60 @@
+/***********************************************************************
+*
+*  FILE        : r_workq.h
+*  DESCRIPTION : Single-producer, single-consumer work queue for
+*                deferring work from an interrupt to the main loop.
+*
+*  NOTE: The producer (one interrupt) only writes head and the item
+*        slots, the consumer (the main loop) only writes tail, and
+*        each is a single aligned 32-bit store. Neither side masks
+*        interrupts. Use one queue per producing interrupt.
+*
+***********************************************************************/
+
+#ifndef R_WORKQ_H
+#define R_WORKQ_H
+
+/***********************************************************************************************************************
+Includes   <System Includes> , "Project Includes"
+***********************************************************************************************************************/
+#include <stdint.h>
+#include <stdbool.h>
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+typedef enum e_workq_err
+{
+    WORKQ_SUCCESS = 0,
+    WORKQ_ERR_NULL_PTR,
+    WORKQ_ERR_INVALID_ARG,
+    WORKQ_ERR_FULL
+} workq_err_t;
+
+typedef void (*r_workq_handler_t)(void *p_context);
+
+typedef struct st_r_workq_item
+{
+    r_workq_handler_t   p_handler;
+    void                *p_context;
+} r_workq_item_t;
+
+/* Queue control block, owned by the caller. Fields are private to r_workq.c. */
+typedef struct st_r_workq
+{
+    volatile r_workq_item_t *p_items;
+    uint32_t                mask;       /* Item count - 1 */
+    volatile uint32_t       head;       /* Items posted; written by the producer only */
+    volatile uint32_t       tail;       /* Items taken; written by the consumer only */
+    volatile uint32_t       dropped;    /* Posts refused because the queue was full; written by the producer only */
+} r_workq_t;
+
+/***********************************************************************************************************************
+Exported global functions (to be accessed by other files)
+***********************************************************************************************************************/
+workq_err_t R_WORKQ_Open(r_workq_t *p_queue, r_workq_item_t *p_items, uint32_t count);
+workq_err_t R_WORKQ_Post(r_workq_t *p_queue, r_workq_handler_t p_handler, void *p_context);
+uint32_t    R_WORKQ_Drain(r_workq_t *p_queue, uint32_t max);
+bool        R_WORKQ_IsEmpty(const r_workq_t *p_queue);
+
+#endif /* R_WORKQ_H */
@@ -44,6 +44,10 @@ Includes
 Global variables and functions
 ***********************************************************************************************************************/
 /* Start user code for global. Do not edit comment generated here */
+
+/* Stops the build if CMT0_PERIOD_US cannot be reached at BSP_PCLKB_HZ. */
+CMT_PERIOD_ASSERT(cmt0_period, CMT0_PERIOD_US, BSP_PCLKB_HZ, CMT0_PERIOD_TOLERANCE_PPM);
+
 /* End user code. Do not edit comment generated here */
 
 /***********************************************************************************************************************
@@ -62,10 +66,10 @@ void R_Config_CMT0_Create(void)
     MSTP(CMT0) = 0U;
     
     /* Set control registers */  
-    CMT0.CMCR.WORD = _0003_CMT_CMCR_CLOCK_PCLK512 | _0040_CMT_CMCR_CMIE_ENABLE | _0080_CMT_CMCR_DEFAULT;
+    CMT0.CMCR.WORD = CMT0_CMCR_CKS | _0040_CMT_CMCR_CMIE_ENABLE | _0080_CMT_CMCR_DEFAULT;
     
     /* Set compare match register */
-    CMT0.CMCOR = _66FE_CMT0_CMCOR_VALUE;
+    CMT0.CMCOR = CMT0_CMCOR_VALUE;
     
     /* Set CMI0 priority level */
     IPR(CMT0,CMI0) = _01_CMT_PRIORITY_LEVEL1;
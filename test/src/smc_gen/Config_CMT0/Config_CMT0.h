@@ -40,8 +40,13 @@ Macro definitions (Register bit)
 /***********************************************************************************************************************
 Macro definitions
 ***********************************************************************************************************************/
+/* Compare match period; CMCR.CKS and CMCOR are solved from it and BSP_PCLKB_HZ at build time (see r_cg_cmt.h) */
+#define CMT0_PERIOD_US                      (500000UL)
+#define CMT0_PERIOD_TOLERANCE_PPM           (100U)
+#define CMT0_CMCR_CKS                       ((uint16_t)CMT_PERIOD_CKS(CMT0_PERIOD_US, BSP_PCLKB_HZ))
+
 /* Compare Match Constant Register (CMCOR) */
-#define _66FE_CMT0_CMCOR_VALUE              (0x66FEU)
+#define CMT0_CMCOR_VALUE                    ((uint16_t)CMT_PERIOD_CMCOR(CMT0_PERIOD_US, BSP_PCLKB_HZ))
 
 /***********************************************************************************************************************
 Typedef definitions
@@ -55,6 +60,25 @@ void R_Config_CMT0_Start(void);
 void R_Config_CMT0_Stop(void);
 void R_Config_CMT0_Create_UserInit(void);
 /* Start user code for function. Do not edit comment generated here */
+#include "r_workq.h"
+#include "r_sched.h"
+#include "r_lathist.h"
+#include "r_profile.h"
+
+/* CMT0 count clock divisor, matching the CKS setting in R_Config_CMT0_Create. */
+#define CMT0_COUNT_CLOCK_DIVISOR            ((uint32_t)CMT_PERIOD_DIVISOR(CMT0_CMCR_CKS))
+
+uint64_t R_Config_CMT0_GetTicks64(void);
+uint64_t R_Config_CMT0_GetTimeNs(void);
+void R_Config_CMT0_SetTickless(bool enable);
+
+/* Work posted by the CMI0 interrupt, drained by a scheduler task at this priority. */
+#define CMT0_WORK_TASK_PRIORITY             (0U)
+#define CMT0_WORK_PROFILE_SITE              (0U)
+extern r_workq_t g_cmt0_workq;
+
+/* CMI0 entry latency in PCLKB/8 cycles (CMCNT at entry, scaled to the clock it counted), one sample per interrupt. */
+extern r_lathist_t g_cmt0_latency;
 /* End user code. Do not edit comment generated here */
 #endif
 
@@ -37,6 +37,8 @@ Includes
 #include "r_cg_macrodriver.h"
 #include "Config_CMT0.h"
 /* Start user code for include. Do not edit comment generated here */
+#include "r_timer.h"
+#include "r_clock.h"
 /* End user code. Do not edit comment generated here */
 #include "r_cg_userdefine.h"
 
@@ -45,7 +47,68 @@ Global variables and functions
 ***********************************************************************************************************************/
 /* Start user code for global. Do not edit comment generated here */
 
-unsigned int Count;
+/* Compare matches since R_Config_CMT0_Create. Incremented after every update of s_cmt0_tick_base, so it also serves
+   as the sequence number for R_Config_CMT0_GetTicks64(). */
+volatile unsigned int Count;
+
+/* Time is kept in PCLK/8 units (CKS = 0 count clocks) of the current PCLKB; one count clock at CKS = n is 4^n of
+   them. R_Config_CMT0_GetTicks64() returns count clocks at CMT0_NOMINAL_CKS and BSP_PCLKB_HZ whatever the clock. */
+#define CMT0_FINE_SHIFT(cks)    (2U * (cks))
+#define CMT0_NOMINAL_CKS        (CMT0_CMCR_CKS)
+#define CMT0_TICK_FINE          (((uint32_t)CMT0_CMCOR_VALUE + 1U) << CMT0_FINE_SHIFT(CMT0_NOMINAL_CKS))
+
+/* Longest tickless interval: 2^16 counts at PCLK/512. */
+#define CMT0_MAX_IDLE_FINE      (0x10000UL << CMT0_FINE_SHIFT(3U))
+#define CMT0_MAX_IDLE_TICKS     (CMT0_MAX_IDLE_FINE / CMT0_TICK_FINE)
+
+/* Counts CMCNT may advance between reading it and rewriting CMCOR. */
+#define CMT0_REPROGRAM_MARGIN   (2U)
+
+/* Time up to the last compare match, the length of the current compare match period, and its clock select. */
+static volatile uint64_t s_cmt0_tick_base;
+static volatile uint32_t s_cmt0_period_fine;
+static volatile uint16_t s_cmt0_cks;
+
+/* Time of the last tick passed to R_TIMER_Tick(); ticks fall on multiples of s_cmt0_tick_fine. */
+static uint64_t s_cmt0_wheel_base;
+static volatile bool s_cmt0_tickless;
+static bool s_cmt0_servicing;
+
+/* The tick at the current PCLKB: its length, the clock select it was solved at, and the longest tickless interval. */
+static uint32_t s_cmt0_hz;
+static uint32_t s_cmt0_tick_fine;
+static uint16_t s_cmt0_tick_cks;
+static uint32_t s_cmt0_max_idle;
+
+/* Time of the last PCLKB change, in fine units of the current and of the nominal PCLKB, and the nominal fine units
+   per current one (BSP_PCLKB_HZ / PCLKB) as an integer part and a 32-bit binary fraction. */
+static uint64_t s_cmt0_epoch_fine;
+static uint64_t s_cmt0_epoch_nominal;
+static uint32_t s_cmt0_scale_int;
+static uint32_t s_cmt0_scale_frac;
+static clock_subscriber_t s_cmt0_clock;
+
+#define CMT0_PSW_I              (0x00010000UL)
+
+/* Nanoseconds per count clock, as an integer part and a 32-bit binary fraction. */
+#define CMT0_NS_PER_TICK_NUM    (1000000000ULL * CMT0_COUNT_CLOCK_DIVISOR)
+#define CMT0_NS_PER_TICK_INT    (CMT0_NS_PER_TICK_NUM / (uint64_t)(BSP_PCLKB_HZ))
+#define CMT0_NS_PER_TICK_FRAC   (((CMT0_NS_PER_TICK_NUM % (uint64_t)(BSP_PCLKB_HZ)) << 32) / (uint64_t)(BSP_PCLKB_HZ))
+
+/* Work deferred from the CMI0 interrupt to the main loop. */
+#define CMT0_WORKQ_SIZE         (8U)
+#define CMT0_WORK_BATCH         (4U)
+r_workq_t g_cmt0_workq;
+static r_workq_item_t s_cmt0_work[CMT0_WORKQ_SIZE];
+
+r_lathist_t g_cmt0_latency;
+
+static uint64_t cmt0_nominal(uint64_t fine);
+static void cmt0_clock_changed(uint32_t changed, void *p_context);
+static void cmt0_program_next(uint32_t idle);
+static uint32_t cmt0_idle_hook(uint32_t wake);
+static void cmt0_work_task(void *p_context);
+static void cmt0_toggle_leds(void *p_context);
 
 /* End user code. Do not edit comment generated here */
 
@@ -59,6 +122,29 @@ unsigned int Count;
 void R_Config_CMT0_Create_UserInit(void)
 {
     /* Start user code for user init. Do not edit comment generated here */
+
+    Count = 0U;
+    s_cmt0_tick_base = 0U;
+    s_cmt0_period_fine = CMT0_TICK_FINE;
+    s_cmt0_cks = CMT0_NOMINAL_CKS;
+    s_cmt0_wheel_base = 0U;
+    s_cmt0_tickless = false;
+    s_cmt0_servicing = false;
+    s_cmt0_hz = BSP_PCLKB_HZ;
+    s_cmt0_tick_fine = CMT0_TICK_FINE;
+    s_cmt0_tick_cks = CMT0_NOMINAL_CKS;
+    s_cmt0_max_idle = CMT0_MAX_IDLE_TICKS;
+    s_cmt0_epoch_fine = 0U;
+    s_cmt0_epoch_nominal = 0U;
+    s_cmt0_scale_int = 1U;
+    s_cmt0_scale_frac = 0U;
+    (void)R_CLOCK_Subscribe(&s_cmt0_clock, cmt0_clock_changed, NULL);
+    R_TIMER_Open();
+    R_TIMER_SetIdleHook(cmt0_idle_hook);
+    (void)R_WORKQ_Open(&g_cmt0_workq, s_cmt0_work, CMT0_WORKQ_SIZE);
+    (void)R_SCHED_Create(CMT0_WORK_TASK_PRIORITY, cmt0_work_task, &g_cmt0_workq);
+    R_LATHIST_Clear(&g_cmt0_latency);
+
     /* End user code. Do not edit comment generated here */
 }
 
@@ -78,14 +164,378 @@ static void r_Config_CMT0_cmi0_interrupt(void)
 {
     /* Start user code for r_Config_CMT0_cmi0_interrupt. Do not edit comment generated here */
 
-	LED0 = ~LED0;
-	LED1 = ~LED1;
+	/* First, so that CMCNT, cleared by the compare match, gives the entry latency. */
+	R_LATHIST_Record(&g_cmt0_latency, (uint32_t)CMT0.CMCNT << CMT0_FINE_SHIFT(s_cmt0_cks));
+
+	(void)R_WORKQ_Post(&g_cmt0_workq, cmt0_toggle_leds, NULL);
+	(void)R_SCHED_Post(CMT0_WORK_TASK_PRIORITY);
+	s_cmt0_tick_base += s_cmt0_period_fine;
+	s_cmt0_servicing = true;
+
+	/* One compare match per tick, or several ticks at once after a tickless interval. */
+	while ((s_cmt0_tick_base - s_cmt0_wheel_base) >= s_cmt0_tick_fine)
+	{
+		s_cmt0_wheel_base += s_cmt0_tick_fine;
+		R_TIMER_Tick();
+	}
+
+	cmt0_program_next(R_TIMER_GetIdleTicks((true == s_cmt0_tickless) ? s_cmt0_max_idle : 1U));
+	s_cmt0_servicing = false;
 	Count++;
 
 	/* End user code. Do not edit comment generated here */
 }
 
 /* Start user code for adding. Do not edit comment generated here */
+
+/***********************************************************************************************************************
+* Function Name: R_Config_CMT0_GetTicks64
+* Description  : This function returns the CMT0 count clocks elapsed since R_Config_CMT0_Create. It combines the count
+*                kept by the CMI0 interrupt with CMT0.CMCNT without disabling interrupts, and includes a compare match
+*                whose interrupt has not been serviced yet. Time counted after a PCLKB change is scaled to the
+*                nominal count clock.
+* Arguments    : None
+* Return Value : Count clocks (BSP_PCLKB_HZ/CMT0_COUNT_CLOCK_DIVISOR)
+***********************************************************************************************************************/
+
+uint64_t R_Config_CMT0_GetTicks64(void)
+{
+    unsigned int sequence;
+    uint64_t base;
+    uint32_t period;
+    uint16_t cks;
+    uint16_t cnt;
+    uint8_t pending;
+
+    do
+    {
+        sequence = Count;
+        base = s_cmt0_tick_base;
+        period = s_cmt0_period_fine;
+        cks = s_cmt0_cks;
+        pending = IR(CMT0,CMI0);
+        cnt = CMT0.CMCNT;
+        if ((0U == pending) && (0U != IR(CMT0,CMI0)))
+        {
+            /* The counter wrapped between the two flag reads, so CMCNT is read again in the new period. */
+            pending = 1U;
+            cnt = CMT0.CMCNT;
+        }
+    } while (sequence != Count);
+
+    if (0U != pending)
+    {
+        base += period;
+    }
+
+    return cmt0_nominal(base + ((uint64_t)cnt << CMT0_FINE_SHIFT(cks))) >> CMT0_FINE_SHIFT(CMT0_NOMINAL_CKS);
+}
+
+/***********************************************************************************************************************
+* Function Name: R_Config_CMT0_GetTimeNs
+* Description  : This function returns the time elapsed since R_Config_CMT0_Create in nanoseconds.
+* Arguments    : None
+* Return Value : Nanoseconds (rounded down, within 1 ns)
+***********************************************************************************************************************/
+
+uint64_t R_Config_CMT0_GetTimeNs(void)
+{
+    uint64_t ticks = R_Config_CMT0_GetTicks64();
+
+    /* ticks * (INT + FRAC / 2^32), with the fractional product split so that it cannot overflow. */
+    return (ticks * CMT0_NS_PER_TICK_INT) + ((ticks >> 32) * CMT0_NS_PER_TICK_FRAC) +
+           (((ticks & 0xFFFFFFFFULL) * CMT0_NS_PER_TICK_FRAC) >> 32);
+}
+
+/***********************************************************************************************************************
+* Function Name: R_Config_CMT0_SetTickless
+* Description  : This function switches between a CMI0 interrupt on every tick and tickless operation, where CMCOR
+*                (and CKS, for intervals beyond 2^16 counts) is rewritten at each compare match so that the next one
+*                comes when r_timer next has work. The change takes effect at the next compare match. Each
+*                interval is set from the tick grid rather than from the previous compare match, so the rounding to
+*                whole counts and the counts passed while reprogramming do not accumulate.
+* Arguments    : enable -
+*                    true for tickless operation
+* Return Value : None
+***********************************************************************************************************************/
+
+void R_Config_CMT0_SetTickless(bool enable)
+{
+    s_cmt0_tickless = enable;
+}
+
+/***********************************************************************************************************************
+* Function Name: cmt0_nominal
+* Description  : This function converts a time in fine units of the current PCLKB to fine units of BSP_PCLKB_HZ.
+* Arguments    : fine -
+*                    Time, at or after the last PCLKB change
+* Return Value : Time in fine units of BSP_PCLKB_HZ (rounded down)
+***********************************************************************************************************************/
+
+static uint64_t cmt0_nominal(uint64_t fine)
+{
+    uint64_t delta = fine - s_cmt0_epoch_fine;
+
+    if ((1U == s_cmt0_scale_int) && (0U == s_cmt0_scale_frac))
+    {
+        return s_cmt0_epoch_nominal + delta;
+    }
+
+    /* delta * (INT + FRAC / 2^32), split as in R_Config_CMT0_GetTimeNs(). */
+    return s_cmt0_epoch_nominal + (delta * s_cmt0_scale_int) + ((delta >> 32) * s_cmt0_scale_frac) +
+           (((delta & 0xFFFFFFFFULL) * s_cmt0_scale_frac) >> 32);
+}
+
+/***********************************************************************************************************************
+* Function Name: cmt0_clock_changed
+* Description  : This function is the r_clock subscriber. After a PCLKB change it solves the tick period again for
+*                the new clock, carries the time and the whole ticks since the last tick passed to R_TIMER_Tick over
+*                to it, scales the part tick, and sets the next compare match. The counts made between the switch and
+*                this call are taken at the old rate.
+* Arguments    : changed -
+*                    CLOCK_BIT() of each clock that changed; with CLOCK_BEFORE, ignored
+*                p_context -
+*                    Not used
+* Return Value : None
+***********************************************************************************************************************/
+
+static void cmt0_clock_changed(uint32_t changed, void *p_context)
+{
+    uint32_t psw = (uint32_t)get_psw();
+    uint32_t hz = R_CLOCK_GetHz(CLOCK_PCLKB);
+    uint64_t error;
+    uint64_t best = 0xFFFFFFFFFFFFFFFFULL;
+    uint64_t now;
+    uint64_t whole;
+    uint32_t part;
+    uint32_t counts = 1U;
+    uint32_t idle;
+    uint16_t cks;
+    uint16_t cnt;
+    uint8_t started;
+    uint8_t pending;
+
+    (void)p_context;
+    if ((0U != (changed & CLOCK_BEFORE)) || (0U == (changed & CLOCK_BIT(CLOCK_PCLKB))) || (hz == s_cmt0_hz))
+    {
+        return;
+    }
+
+    clrpsw_i();
+    started = CMT.CMSTR0.BIT.STR0;
+    CMT.CMSTR0.BIT.STR0 = 0U;
+    pending = IR(CMT0,CMI0);
+    cnt = CMT0.CMCNT;
+    CMT0.CMCNT = 0U;
+    now = s_cmt0_tick_base + ((0U != pending) ? s_cmt0_period_fine : 0U) +
+          ((uint64_t)cnt << CMT0_FINE_SHIFT(s_cmt0_cks));
+    s_cmt0_epoch_nominal = cmt0_nominal(now);
+    whole = (now - s_cmt0_wheel_base) / s_cmt0_tick_fine;
+    part = (uint32_t)((now - s_cmt0_wheel_base) % s_cmt0_tick_fine);
+
+    /* The clock select with the smallest period error, as CMT_PERIOD_CKS() solves it at build time. */
+    for (cks = 0U; cks <= 3U; cks++)
+    {
+        error = CMT_PERIOD_ERROR(CMT0_PERIOD_US, hz, cks);
+        if (error < best)
+        {
+            best = error;
+            s_cmt0_tick_cks = cks;
+            counts = (uint32_t)CMT_PERIOD_COUNTS(CMT0_PERIOD_US, hz, cks);
+        }
+    }
+    part = (uint32_t)(((uint64_t)part * (counts << CMT0_FINE_SHIFT(s_cmt0_tick_cks))) / s_cmt0_tick_fine);
+    s_cmt0_tick_fine = counts << CMT0_FINE_SHIFT(s_cmt0_tick_cks);
+    s_cmt0_max_idle = CMT0_MAX_IDLE_FINE / s_cmt0_tick_fine;
+
+    s_cmt0_tick_base = s_cmt0_wheel_base + (whole * s_cmt0_tick_fine) + part;
+    s_cmt0_epoch_fine = s_cmt0_tick_base;
+    s_cmt0_scale_int = BSP_PCLKB_HZ / hz;
+    s_cmt0_scale_frac = (uint32_t)((((uint64_t)BSP_PCLKB_HZ % hz) << 32) / hz);
+    s_cmt0_hz = hz;
+
+    if ((0U != pending) || (0U == started))
+    {
+        /* One tick from now; with a compare match pending the interrupt sets the next one itself. */
+        CMT0.CMCR.WORD = s_cmt0_tick_cks | _0040_CMT_CMCR_CMIE_ENABLE | _0080_CMT_CMCR_DEFAULT;
+        CMT0.CMCOR = (uint16_t)(counts - 1U);
+        s_cmt0_cks = s_cmt0_tick_cks;
+        s_cmt0_period_fine = (0U != pending) ? 0U : s_cmt0_tick_fine;
+    }
+    else
+    {
+        idle = R_TIMER_GetIdleTicks((true == s_cmt0_tickless) ? s_cmt0_max_idle : 1U);
+        if (idle <= whole)
+        {
+            idle = (uint32_t)whole + 1U;
+        }
+        s_cmt0_period_fine = 0U;
+        cmt0_program_next(idle);
+    }
+    CMT.CMSTR0.BIT.STR0 = started;
+
+    if (0U != (psw & CMT0_PSW_I))
+    {
+        setpsw_i();
+    }
+}
+
+/***********************************************************************************************************************
+* Function Name: cmt0_program_next
+* Description  : This function sets the next compare match to the first count at or after the given tick. It is
+*                called from the CMI0 interrupt, after the compare match has cleared CMCNT. CMCOR is rewritten while
+*                counting; the counter is only stopped to change CKS.
+* Arguments    : idle -
+*                    Ticks after the last tick passed to R_TIMER_Tick (1 to s_cmt0_max_idle)
+* Return Value : None
+***********************************************************************************************************************/
+
+static void cmt0_program_next(uint32_t idle)
+{
+    uint64_t target = s_cmt0_wheel_base + ((uint64_t)idle * s_cmt0_tick_fine);
+    uint32_t interval = (uint32_t)(target - s_cmt0_tick_base);
+    uint16_t cks = s_cmt0_tick_cks;
+    uint32_t counts;
+    uint16_t cnt;
+
+    /* Use the nominal clock, or a slower one if the interval does not fit in CMCOR. */
+    while ((cks < 3U) && ((interval >> CMT0_FINE_SHIFT(cks)) >= 0x10000UL))
+    {
+        cks++;
+    }
+
+    if (cks != s_cmt0_cks)
+    {
+        /* The counts passed since the compare match are carried over; only the prescaler phase is lost. */
+        CMT.CMSTR0.BIT.STR0 = 0U;
+        cnt = CMT0.CMCNT;
+        s_cmt0_tick_base += (uint64_t)cnt << CMT0_FINE_SHIFT(s_cmt0_cks);
+        CMT0.CMCNT = 0U;
+        CMT0.CMCR.WORD = cks | _0040_CMT_CMCR_CMIE_ENABLE | _0080_CMT_CMCR_DEFAULT;
+        s_cmt0_cks = cks;
+
+        interval = (target > s_cmt0_tick_base) ? (uint32_t)(target - s_cmt0_tick_base) : 1U;
+        counts = (interval + (1UL << CMT0_FINE_SHIFT(cks)) - 1U) >> CMT0_FINE_SHIFT(cks);
+        CMT0.CMCOR = (uint16_t)(counts - 1U);
+        s_cmt0_period_fine = counts << CMT0_FINE_SHIFT(cks);
+        CMT.CMSTR0.BIT.STR0 = 1U;
+        return;
+    }
+
+    /* Round up so that the compare match never comes before the tick. */
+    counts = (interval + (1UL << CMT0_FINE_SHIFT(cks)) - 1U) >> CMT0_FINE_SHIFT(cks);
+    if ((counts << CMT0_FINE_SHIFT(cks)) == s_cmt0_period_fine)
+    {
+        return;
+    }
+
+    cnt = CMT0.CMCNT;
+    if (counts < ((uint32_t)cnt + 1U + CMT0_REPROGRAM_MARGIN))
+    {
+        counts = (uint32_t)cnt + 1U + CMT0_REPROGRAM_MARGIN;
+    }
+    CMT0.CMCOR = (uint16_t)(counts - 1U);
+    s_cmt0_period_fine = counts << CMT0_FINE_SHIFT(cks);
+}
+
+/***********************************************************************************************************************
+* Function Name: cmt0_idle_hook
+* Description  : This function is the r_timer idle hook, called with interrupts disabled. From a timer callback in
+*                the CMI0 interrupt it does nothing, as the interrupt programs the next compare match on exit.
+* Arguments    : wake -
+*                    0, or ticks after the last tick passed to R_TIMER_Tick by which the next compare match must come
+* Return Value : Ticks counted since the last tick passed to R_TIMER_Tick
+***********************************************************************************************************************/
+
+static uint32_t cmt0_idle_hook(uint32_t wake)
+{
+    uint64_t now;
+    uint64_t tick;
+    uint32_t elapsed = 0U;
+    uint32_t counts;
+    uint16_t cnt;
+    uint8_t pending;
+
+    if (true == s_cmt0_servicing)
+    {
+        return 0U;
+    }
+
+    pending = IR(CMT0,CMI0);
+    cnt = CMT0.CMCNT;
+    if ((0U == pending) && (0U != IR(CMT0,CMI0)))
+    {
+        pending = 1U;
+        cnt = CMT0.CMCNT;
+    }
+
+    now = s_cmt0_tick_base + ((0U != pending) ? s_cmt0_period_fine : 0U) +
+          ((uint64_t)cnt << CMT0_FINE_SHIFT(s_cmt0_cks));
+    for (tick = s_cmt0_wheel_base + s_cmt0_tick_fine; tick <= now; tick += s_cmt0_tick_fine)
+    {
+        elapsed++;
+    }
+
+    /* With a compare match pending, the interrupt reprograms CMT0 as soon as interrupts are enabled again. */
+    if ((0U != wake) && (0U == pending))
+    {
+        tick = s_cmt0_wheel_base + ((uint64_t)wake * s_cmt0_tick_fine);
+        if (tick < (s_cmt0_tick_base + s_cmt0_period_fine))
+        {
+            counts = ((uint32_t)(tick - s_cmt0_tick_base) + (1UL << CMT0_FINE_SHIFT(s_cmt0_cks)) - 1U) >>
+                     CMT0_FINE_SHIFT(s_cmt0_cks);
+            if (counts < ((uint32_t)cnt + 1U + CMT0_REPROGRAM_MARGIN))
+            {
+                counts = (uint32_t)cnt + 1U + CMT0_REPROGRAM_MARGIN;
+            }
+            if ((counts << CMT0_FINE_SHIFT(s_cmt0_cks)) < s_cmt0_period_fine)
+            {
+                CMT0.CMCOR = (uint16_t)(counts - 1U);
+                s_cmt0_period_fine = counts << CMT0_FINE_SHIFT(s_cmt0_cks);
+            }
+        }
+    }
+
+    return elapsed;
+}
+
+/***********************************************************************************************************************
+* Function Name: cmt0_work_task
+* Description  : This function runs work posted by the CMI0 interrupt, a batch at a time so that other tasks are not
+*                held up, and posts itself again while work is left.
+* Arguments    : p_context -
+*                    Work queue
+* Return Value : None
+***********************************************************************************************************************/
+
+static void cmt0_work_task(void *p_context)
+{
+    r_workq_t *p_queue = (r_workq_t *)p_context;
+
+    PROFILE_BEGIN(CMT0_WORK_PROFILE_SITE)
+    (void)R_WORKQ_Drain(p_queue, CMT0_WORK_BATCH);
+    if (false == R_WORKQ_IsEmpty(p_queue))
+    {
+        (void)R_SCHED_Post(CMT0_WORK_TASK_PRIORITY);
+    }
+    PROFILE_END(CMT0_WORK_PROFILE_SITE)
+}
+
+/***********************************************************************************************************************
+* Function Name: cmt0_toggle_leds
+* Description  : This function toggles LED0 and LED1. It is posted by the CMI0 interrupt and runs in the main loop.
+* Arguments    : p_context -
+*                    Not used
+* Return Value : None
+***********************************************************************************************************************/
+
+static void cmt0_toggle_leds(void *p_context)
+{
+    (void)p_context;
+
+    (void)R_PORT_Toggle(LED_PORT, LED0_PIN | LED1_PIN);
+}
+
 /* End user code. Do not edit comment generated here */   
 
 
@@ -0,0 +1,110 @@
+/***********************************************************************************************************************
+* DISCLAIMER
+* This software is supplied by Renesas Electronics Corporation and is only intended for use with Renesas products.
+* No other uses are authorized. This software is owned by Renesas Electronics Corporation and is protected under all
+* applicable laws, including copyright laws. 
+* THIS SOFTWARE IS PROVIDED "AS IS" AND RENESAS MAKES NO WARRANTIES REGARDING THIS SOFTWARE, WHETHER EXPRESS, IMPLIED
+* OR STATUTORY, INCLUDING BUT NOT LIMITED TO WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NON-INFRINGEMENT.  ALL SUCH WARRANTIES ARE EXPRESSLY DISCLAIMED.TO THE MAXIMUM EXTENT PERMITTED NOT PROHIBITED BY
+* LAW, NEITHER RENESAS ELECTRONICS CORPORATION NOR ANY OF ITS AFFILIATED COMPANIES SHALL BE LIABLE FOR ANY DIRECT,
+* INDIRECT, SPECIAL, INCIDENTAL OR CONSEQUENTIAL DAMAGES FOR ANY REASON RELATED TO THIS SOFTWARE, EVEN IF RENESAS OR
+* ITS AFFILIATES HAVE BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+* Renesas reserves the right, without notice, to make changes to this software and to discontinue the availability 
+* of this software. By using this software, you agree to the additional terms and conditions found by accessing the 
+* following link:
+* http://www.renesas.com/disclaimer
+*
+* Copyright (C) 2016, 2017 Renesas Electronics Corporation. All rights reserved.
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* File Name    : Config_CMT1.c
+* Version      : 1.4.0
+* Device(s)    : R5F52318BxFP
+* Description  : This file implements device driver for Config_CMT1.
+* Creation Date: 2018-10-25
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Pragma directive
+***********************************************************************************************************************/
+/* Start user code for pragma. Do not edit comment generated here */
+/* End user code. Do not edit comment generated here */
+
+/***********************************************************************************************************************
+Includes
+***********************************************************************************************************************/
+#include "r_cg_macrodriver.h"
+#include "Config_CMT1.h"
+/* Start user code for include. Do not edit comment generated here */
+/* End user code. Do not edit comment generated here */
+#include "r_cg_userdefine.h"
+
+/***********************************************************************************************************************
+Global variables and functions
+***********************************************************************************************************************/
+/* Start user code for global. Do not edit comment generated here */
+/* End user code. Do not edit comment generated here */
+
+/***********************************************************************************************************************
+* Function Name: R_Config_CMT1_Create
+* Description  : This function initializes the CMT1 channel
+* Arguments    : None
+* Return Value : None
+***********************************************************************************************************************/
+
+void R_Config_CMT1_Create(void)
+{
+    /* Disable CMI1 interrupt */
+    IEN(CMT1,CMI1) = 0U;
+    
+    /* Cancel CMT stop state in LPC */
+    MSTP(CMT1) = 0U;
+    
+    /* Set control registers */  
+    CMT1.CMCR.WORD = _0000_CMT_CMCR_CLOCK_PCLK8 | _0040_CMT_CMCR_CMIE_ENABLE | _0080_CMT_CMCR_DEFAULT;
+    
+    /* Set compare match register */
+    CMT1.CMCOR = _FFFF_CMT1_CMCOR_VALUE;
+    
+    /* Set CMI1 priority level */
+    IPR(CMT1,CMI1) = _0E_CMT_PRIORITY_LEVEL14;
+    
+    R_Config_CMT1_Create_UserInit();
+}
+
+/***********************************************************************************************************************
+* Function Name: R_Config_CMT1_Start
+* Description  : This function starts the CMT1 channel counter
+* Arguments    : None
+* Return Value : None
+***********************************************************************************************************************/
+
+void R_Config_CMT1_Start(void)
+{
+    /* Enable CMI1 interrupt in ICU */
+    IEN(CMT1,CMI1) = 1U;
+    
+    /* Start CMT1 count */
+    CMT.CMSTR0.BIT.STR1 = 1U;
+}
+
+/***********************************************************************************************************************
+* Function Name: R_Config_CMT1_Stop
+* Description  : This function stop the CMT1 channel counter
+* Arguments    : None
+* Return Value : None
+***********************************************************************************************************************/
+
+void R_Config_CMT1_Stop(void)
+{
+    /* Stop CMT1 count */
+    CMT.CMSTR0.BIT.STR1 = 0U;
+    
+    /* Disable CMI1 interrupt in ICU */
+    IEN(CMT1,CMI1) = 0U;
+}
+
+/* Start user code for adding. Do not edit comment generated here */
+/* End user code. Do not edit comment generated here */   
+
@@ -0,0 +1,129 @@
+/***********************************************************************************************************************
+* DISCLAIMER
+* This software is supplied by Renesas Electronics Corporation and is only intended for use with Renesas products.
+* No other uses are authorized. This software is owned by Renesas Electronics Corporation and is protected under all
+* applicable laws, including copyright laws. 
+* THIS SOFTWARE IS PROVIDED "AS IS" AND RENESAS MAKES NO WARRANTIES REGARDING THIS SOFTWARE, WHETHER EXPRESS, IMPLIED
+* OR STATUTORY, INCLUDING BUT NOT LIMITED TO WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NON-INFRINGEMENT.  ALL SUCH WARRANTIES ARE EXPRESSLY DISCLAIMED.TO THE MAXIMUM EXTENT PERMITTED NOT PROHIBITED BY
+* LAW, NEITHER RENESAS ELECTRONICS CORPORATION NOR ANY OF ITS AFFILIATED COMPANIES SHALL BE LIABLE FOR ANY DIRECT,
+* INDIRECT, SPECIAL, INCIDENTAL OR CONSEQUENTIAL DAMAGES FOR ANY REASON RELATED TO THIS SOFTWARE, EVEN IF RENESAS OR
+* ITS AFFILIATES HAVE BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+* Renesas reserves the right, without notice, to make changes to this software and to discontinue the availability 
+* of this software. By using this software, you agree to the additional terms and conditions found by accessing the 
+* following link:
+* http://www.renesas.com/disclaimer
+*
+* Copyright (C) 2016, 2017 Renesas Electronics Corporation. All rights reserved.
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* File Name    : Config_CMT1_user.c
+* Version      : 1.4.0
+* Device(s)    : R5F52318BxFP
+* Description  : This file implements device driver for Config_CMT1.
+* Creation Date: 2018-10-25
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Pragma directive
+***********************************************************************************************************************/
+/* Start user code for pragma. Do not edit comment generated here */
+/* End user code. Do not edit comment generated here */
+
+/***********************************************************************************************************************
+Includes
+***********************************************************************************************************************/
+#include "r_cg_macrodriver.h"
+#include "Config_CMT1.h"
+/* Start user code for include. Do not edit comment generated here */
+/* End user code. Do not edit comment generated here */
+#include "r_cg_userdefine.h"
+
+/***********************************************************************************************************************
+Global variables and functions
+***********************************************************************************************************************/
+/* Start user code for global. Do not edit comment generated here */
+
+/* CMCNT wraps since R_Config_CMT1_Create; the upper 16 bits of R_Config_CMT1_GetCount32(). */
+static volatile uint16_t s_cmt1_wraps;
+
+#define CMT1_PSW_I              (0x00010000UL)
+
+/* End user code. Do not edit comment generated here */
+
+/***********************************************************************************************************************
+* Function Name: R_Config_CMT1_Create_UserInit
+* Description  : This function adds user code after initializing the CMT1 channel
+* Arguments    : None
+* Return Value : None
+***********************************************************************************************************************/
+
+void R_Config_CMT1_Create_UserInit(void)
+{
+    /* Start user code for user init. Do not edit comment generated here */
+
+    s_cmt1_wraps = 0U;
+
+    /* End user code. Do not edit comment generated here */
+}
+
+/***********************************************************************************************************************
+* Function Name: r_Config_CMT1_cmi1_interrupt
+* Description  : This function is CMI1 interrupt service routine
+* Arguments    : None
+* Return Value : None
+***********************************************************************************************************************/
+
+#if FAST_INTERRUPT_VECTOR == VECT_CMT1_CMI1
+#pragma interrupt r_Config_CMT1_cmi1_interrupt(vect=VECT(CMT1,CMI1),fint)
+#else
+#pragma interrupt r_Config_CMT1_cmi1_interrupt(vect=VECT(CMT1,CMI1))
+#endif
+static void r_Config_CMT1_cmi1_interrupt(void)
+{
+    /* Start user code for r_Config_CMT1_cmi1_interrupt. Do not edit comment generated here */
+
+    s_cmt1_wraps++;
+
+    /* End user code. Do not edit comment generated here */
+}
+
+/* Start user code for adding. Do not edit comment generated here */
+
+/***********************************************************************************************************************
+* Function Name: R_Config_CMT1_GetCount32
+* Description  : This function returns a 32-bit count of PCLKB/8 cycles, CMCNT extended by the number of wraps. It
+*                may be called with interrupts masked, from the thread or from an interrupt of any priority.
+* Arguments    : None
+* Return Value : Count clocks since R_Config_CMT1_Start, modulo 2^32
+***********************************************************************************************************************/
+
+uint32_t R_Config_CMT1_GetCount32(void)
+{
+    uint32_t psw = (uint32_t)get_psw();
+    uint16_t wraps;
+    uint16_t count;
+
+    clrpsw_i();
+    wraps = s_cmt1_wraps;
+    count = CMT1.CMCNT;
+
+    /* A wrap whose interrupt is still pending happened before CMCNT was read if CMCNT is in its first half, which
+       holds as long as CMI1 is not held off for half a wrap (about 9.7 ms at PCLKB 27 MHz). */
+    if ((1U == IR(CMT1,CMI1)) && (count < 0x8000U))
+    {
+        wraps++;
+    }
+
+    if (0U != (psw & CMT1_PSW_I))
+    {
+        setpsw_i();
+    }
+
+    return ((uint32_t)wraps << 16) | count;
+}
+
+/* End user code. Do not edit comment generated here */   
+
+
@@ -0,0 +1,101 @@
+/***********************************************************************************************************************
+* DISCLAIMER
+* This software is supplied by Renesas Electronics Corporation and is only intended for use with Renesas products.
+* No other uses are authorized. This software is owned by Renesas Electronics Corporation and is protected under all
+* applicable laws, including copyright laws. 
+* THIS SOFTWARE IS PROVIDED "AS IS" AND RENESAS MAKES NO WARRANTIES REGARDING THIS SOFTWARE, WHETHER EXPRESS, IMPLIED
+* OR STATUTORY, INCLUDING BUT NOT LIMITED TO WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NON-INFRINGEMENT.  ALL SUCH WARRANTIES ARE EXPRESSLY DISCLAIMED.TO THE MAXIMUM EXTENT PERMITTED NOT PROHIBITED BY
+* LAW, NEITHER RENESAS ELECTRONICS CORPORATION NOR ANY OF ITS AFFILIATED COMPANIES SHALL BE LIABLE FOR ANY DIRECT,
+* INDIRECT, SPECIAL, INCIDENTAL OR CONSEQUENTIAL DAMAGES FOR ANY REASON RELATED TO THIS SOFTWARE, EVEN IF RENESAS OR
+* ITS AFFILIATES HAVE BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+* Renesas reserves the right, without notice, to make changes to this software and to discontinue the availability 
+* of this software. By using this software, you agree to the additional terms and conditions found by accessing the 
+* following link:
+* http://www.renesas.com/disclaimer
+*
+* Copyright (C) 2016, 2017 Renesas Electronics Corporation. All rights reserved.
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* File Name    : Config_ELC.c
+* Version      : 1.4.0
+* Device(s)    : R5F52318BxFP
+* Description  : This file implements device driver for Config_ELC.
+* Creation Date: 2018-10-25
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Pragma directive
+***********************************************************************************************************************/
+/* Start user code for pragma. Do not edit comment generated here */
+/* End user code. Do not edit comment generated here */
+
+/***********************************************************************************************************************
+Includes
+***********************************************************************************************************************/
+#include "r_cg_macrodriver.h"
+#include "Config_ELC.h"
+/* Start user code for include. Do not edit comment generated here */
+/* End user code. Do not edit comment generated here */
+#include "r_cg_userdefine.h"
+
+/***********************************************************************************************************************
+Global variables and functions
+***********************************************************************************************************************/
+/* Start user code for global. Do not edit comment generated here */
+/* End user code. Do not edit comment generated here */
+
+/***********************************************************************************************************************
+* Function Name: R_Config_ELC_Create
+* Description  : This function initializes the ELC module
+* Arguments    : None
+* Return Value : None
+***********************************************************************************************************************/
+
+void R_Config_ELC_Create(void)
+{
+    /* Cancel ELC module stop state */
+    MSTP(ELC) = 0U;
+
+    /* Disable all event links */
+    ELC.ELCR.BYTE = _00_ELC_LINK_DISABLE;
+
+    /* Set single port 0: toggle PB0 */
+    ELC.PEL0.BYTE = _08_ELC_PSP_PORTB | _00_ELC_PSB_0 | _40_ELC_PSM_OUTPUT_TOGGLE;
+
+    /* Set event link: TMR0 compare match A0 to single port 0 */
+    ELC.ELSR[ELC_ELSR_SINGLE_PORT0].BYTE = _22_ELC_EVENT_TMR0_CMIA0;
+
+    R_Config_ELC_Create_UserInit();
+}
+
+/***********************************************************************************************************************
+* Function Name: R_Config_ELC_Start
+* Description  : This function enables all event links
+* Arguments    : None
+* Return Value : None
+***********************************************************************************************************************/
+
+void R_Config_ELC_Start(void)
+{
+    /* Enable the ELC function */
+    ELC.ELCR.BYTE = _80_ELC_LINK_ENABLE;
+}
+
+/***********************************************************************************************************************
+* Function Name: R_Config_ELC_Stop
+* Description  : This function disables all event links
+* Arguments    : None
+* Return Value : None
+***********************************************************************************************************************/
+
+void R_Config_ELC_Stop(void)
+{
+    /* Disable the ELC function */
+    ELC.ELCR.BYTE = _00_ELC_LINK_DISABLE;
+}
+
+/* Start user code for adding. Do not edit comment generated here */
+/* End user code. Do not edit comment generated here */   
+
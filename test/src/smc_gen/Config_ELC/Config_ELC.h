@@ -0,0 +1,65 @@
+/***********************************************************************************************************************
+* DISCLAIMER
+* This software is supplied by Renesas Electronics Corporation and is only intended for use with Renesas products.
+* No other uses are authorized. This software is owned by Renesas Electronics Corporation and is protected under all
+* applicable laws, including copyright laws. 
+* THIS SOFTWARE IS PROVIDED "AS IS" AND RENESAS MAKES NO WARRANTIES REGARDING THIS SOFTWARE, WHETHER EXPRESS, IMPLIED
+* OR STATUTORY, INCLUDING BUT NOT LIMITED TO WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NON-INFRINGEMENT.  ALL SUCH WARRANTIES ARE EXPRESSLY DISCLAIMED.TO THE MAXIMUM EXTENT PERMITTED NOT PROHIBITED BY
+* LAW, NEITHER RENESAS ELECTRONICS CORPORATION NOR ANY OF ITS AFFILIATED COMPANIES SHALL BE LIABLE FOR ANY DIRECT,
+* INDIRECT, SPECIAL, INCIDENTAL OR CONSEQUENTIAL DAMAGES FOR ANY REASON RELATED TO THIS SOFTWARE, EVEN IF RENESAS OR
+* ITS AFFILIATES HAVE BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+* Renesas reserves the right, without notice, to make changes to this software and to discontinue the availability 
+* of this software. By using this software, you agree to the additional terms and conditions found by accessing the 
+* following link:
+* http://www.renesas.com/disclaimer
+*
+* Copyright (C) 2016, 2017 Renesas Electronics Corporation. All rights reserved.
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* File Name    : Config_ELC.h
+* Version      : 1.4.0
+* Device(s)    : R5F52318BxFP
+* Description  : This file implements device driver for Config_ELC.
+* Creation Date: 2018-10-25
+***********************************************************************************************************************/
+
+#ifndef Config_ELC_H
+#define Config_ELC_H
+
+/***********************************************************************************************************************
+Includes
+***********************************************************************************************************************/
+#include "r_cg_elc.h"
+
+/***********************************************************************************************************************
+Macro definitions (Register bit)
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Global functions
+***********************************************************************************************************************/
+void R_Config_ELC_Create(void);
+void R_Config_ELC_Start(void);
+void R_Config_ELC_Stop(void);
+void R_Config_ELC_Create_UserInit(void);
+/* Start user code for function. Do not edit comment generated here */
+
+/* Single port 0 toggles PB0 on each TMR0 compare match A, with no interrupt. The ELC reaches PORTB and PORTE only, so
+   the LEDs on PORTD cannot be linked; fit an LED to PB0 to see it. While the link runs, PB0 is driven by the ELC:
+   do not update PORTB with r_port, whose shadow would restore the pin. */
+#define ELC_BLINK_IO                        B, 0
+#define ELC_BLINK_PORT                      R_PIN_PORT(ELC_BLINK_IO)
+#define ELC_BLINK_PIN                       R_PIN_MASK(ELC_BLINK_IO)
+
+/* End user code. Do not edit comment generated here */
+#endif
@@ -0,0 +1,118 @@
+/***********************************************************************************************************************
+* DISCLAIMER
+* This software is supplied by Renesas Electronics Corporation and is only intended for use with Renesas products.
+* No other uses are authorized. This software is owned by Renesas Electronics Corporation and is protected under all
+* applicable laws, including copyright laws. 
+* THIS SOFTWARE IS PROVIDED "AS IS" AND RENESAS MAKES NO WARRANTIES REGARDING THIS SOFTWARE, WHETHER EXPRESS, IMPLIED
+* OR STATUTORY, INCLUDING BUT NOT LIMITED TO WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NON-INFRINGEMENT.  ALL SUCH WARRANTIES ARE EXPRESSLY DISCLAIMED.TO THE MAXIMUM EXTENT PERMITTED NOT PROHIBITED BY
+* LAW, NEITHER RENESAS ELECTRONICS CORPORATION NOR ANY OF ITS AFFILIATED COMPANIES SHALL BE LIABLE FOR ANY DIRECT,
+* INDIRECT, SPECIAL, INCIDENTAL OR CONSEQUENTIAL DAMAGES FOR ANY REASON RELATED TO THIS SOFTWARE, EVEN IF RENESAS OR
+* ITS AFFILIATES HAVE BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+* Renesas reserves the right, without notice, to make changes to this software and to discontinue the availability 
+* of this software. By using this software, you agree to the additional terms and conditions found by accessing the 
+* following link:
+* http://www.renesas.com/disclaimer
+*
+* Copyright (C) 2016, 2017 Renesas Electronics Corporation. All rights reserved.
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* File Name    : Config_TMR0.c
+* Version      : 1.5.0
+* Device(s)    : R5F52318BxFP
+* Description  : This file implements device driver for Config_TMR0.
+* Creation Date: 2018-10-25
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Pragma directive
+***********************************************************************************************************************/
+/* Start user code for pragma. Do not edit comment generated here */
+/* End user code. Do not edit comment generated here */
+
+/***********************************************************************************************************************
+Includes
+***********************************************************************************************************************/
+#include "r_cg_macrodriver.h"
+#include "Config_TMR0.h"
+/* Start user code for include. Do not edit comment generated here */
+/* End user code. Do not edit comment generated here */
+#include "r_cg_userdefine.h"
+
+/***********************************************************************************************************************
+Global variables and functions
+***********************************************************************************************************************/
+/* Start user code for global. Do not edit comment generated here */
+/* End user code. Do not edit comment generated here */
+
+/***********************************************************************************************************************
+* Function Name: R_Config_TMR0_Create
+* Description  : This function initializes the TMR0 and TMR1 channels in 16-bit count mode
+* Arguments    : None
+* Return Value : None
+***********************************************************************************************************************/
+
+void R_Config_TMR0_Create(void)
+{
+    /* Disable TMR0 interrupts */
+    IEN(TMR0,CMIA0) = 0U;
+    IEN(TMR0,CMIB0) = 0U;
+    IEN(TMR0,OVI0) = 0U;
+
+    /* Cancel TMR module stop state */
+    MSTP(TMR01) = 0U;
+
+    /* Stop counting */
+    TMR0.TCCR.BYTE = _00_TMR_CLK_DISABLED;
+    TMR1.TCCR.BYTE = _00_TMR_CLK_DISABLED;
+
+    /* Set counter clear and interrupt settings */
+    TMR0.TCR.BYTE = _08_TMR_CNT_CLR_COMP_MATCH_A | _00_TMR_CMIA_INT_DISABLE | _00_TMR_CMIB_INT_DISABLE |
+                    _00_TMR_OVI_INT_DISABLE;
+    TMR1.TCR.BYTE = _00_TMR_CNT_CLR_DISABLE | _00_TMR_CMIA_INT_DISABLE | _00_TMR_CMIB_INT_DISABLE |
+                    _00_TMR_OVI_INT_DISABLE;
+
+    /* Set compare match output: the TMO0 pin is not used */
+    TMR0.TCSR.BYTE = _00_TMR_COMP_MATCH_OUTPUT_A_NO | _00_TMR_COMP_MATCH_OUTPUT_B_NO;
+
+    /* Set compare match value (TMR0 holds the upper byte) and clear the counter */
+    TMR0.TCORA = (uint8_t)(TMR01_TCORA_VALUE >> 8);
+    TMR1.TCORA = (uint8_t)TMR01_TCORA_VALUE;
+    TMR0.TCNT = 0U;
+    TMR1.TCNT = 0U;
+
+    R_Config_TMR0_Create_UserInit();
+}
+
+/***********************************************************************************************************************
+* Function Name: R_Config_TMR0_Start
+* Description  : This function starts the TMR0 and TMR1 counter
+* Arguments    : None
+* Return Value : None
+***********************************************************************************************************************/
+
+void R_Config_TMR0_Start(void)
+{
+    /* Start counting: TMR1 counts PCLK/8192 and carries into TMR0 */
+    TMR0.TCCR.BYTE = _18_TMR_CLK_TMR1_OVRF;
+    TMR1.TCCR.BYTE = _08_TMR_CLK_SRC_PCLK | _06_TMR_PCLK_DIV_8192;
+}
+
+/***********************************************************************************************************************
+* Function Name: R_Config_TMR0_Stop
+* Description  : This function stops the TMR0 and TMR1 counter
+* Arguments    : None
+* Return Value : None
+***********************************************************************************************************************/
+
+void R_Config_TMR0_Stop(void)
+{
+    /* Disable count clock */
+    TMR1.TCCR.BYTE = _00_TMR_CLK_DISABLED;
+    TMR0.TCCR.BYTE = _00_TMR_CLK_DISABLED;
+}
+
+/* Start user code for adding. Do not edit comment generated here */
+/* End user code. Do not edit comment generated here */   
+
@@ -0,0 +1,66 @@
+/***********************************************************************************************************************
+* DISCLAIMER
+* This software is supplied by Renesas Electronics Corporation and is only intended for use with Renesas products.
+* No other uses are authorized. This software is owned by Renesas Electronics Corporation and is protected under all
+* applicable laws, including copyright laws. 
+* THIS SOFTWARE IS PROVIDED "AS IS" AND RENESAS MAKES NO WARRANTIES REGARDING THIS SOFTWARE, WHETHER EXPRESS, IMPLIED
+* OR STATUTORY, INCLUDING BUT NOT LIMITED TO WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NON-INFRINGEMENT.  ALL SUCH WARRANTIES ARE EXPRESSLY DISCLAIMED.TO THE MAXIMUM EXTENT PERMITTED NOT PROHIBITED BY
+* LAW, NEITHER RENESAS ELECTRONICS CORPORATION NOR ANY OF ITS AFFILIATED COMPANIES SHALL BE LIABLE FOR ANY DIRECT,
+* INDIRECT, SPECIAL, INCIDENTAL OR CONSEQUENTIAL DAMAGES FOR ANY REASON RELATED TO THIS SOFTWARE, EVEN IF RENESAS OR
+* ITS AFFILIATES HAVE BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+* Renesas reserves the right, without notice, to make changes to this software and to discontinue the availability 
+* of this software. By using this software, you agree to the additional terms and conditions found by accessing the 
+* following link:
+* http://www.renesas.com/disclaimer
+*
+* Copyright (C) 2016, 2017 Renesas Electronics Corporation. All rights reserved.
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* File Name    : Config_TMR0.h
+* Version      : 1.5.0
+* Device(s)    : R5F52318BxFP
+* Description  : This file implements device driver for Config_TMR0.
+* Creation Date: 2018-10-25
+***********************************************************************************************************************/
+
+#ifndef Config_TMR0_H
+#define Config_TMR0_H
+
+/***********************************************************************************************************************
+Includes
+***********************************************************************************************************************/
+#include "r_cg_tmr.h"
+
+/***********************************************************************************************************************
+Macro definitions (Register bit)
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+/* 16-bit count mode (TMR0 upper, TMR1 lower) at PCLKB/8192; compare match A every TMR01_PERIOD_US */
+#define TMR01_COUNT_CLOCK_DIVISOR           (8192UL)
+#define TMR01_PERIOD_US                     (500000UL)
+
+/* Time Constant Register A (TCORA), rounded to nearest */
+#define TMR01_TCORA_VALUE                   ((uint16_t)(((((unsigned long long)TMR01_PERIOD_US * \
+                                             (unsigned long long)BSP_PCLKB_HZ) + \
+                                             (TMR01_COUNT_CLOCK_DIVISOR * 500000ULL)) / \
+                                             (TMR01_COUNT_CLOCK_DIVISOR * 1000000ULL)) - 1U))
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Global functions
+***********************************************************************************************************************/
+void R_Config_TMR0_Create(void);
+void R_Config_TMR0_Start(void);
+void R_Config_TMR0_Stop(void);
+void R_Config_TMR0_Create_UserInit(void);
+/* Start user code for function. Do not edit comment generated here */
+/* End user code. Do not edit comment generated here */
+#endif
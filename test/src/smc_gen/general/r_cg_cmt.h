@@ -77,6 +77,52 @@ Typedef definitions
 Global functions
 ***********************************************************************************************************************/
 /* Start user code for function. Do not edit comment generated here */
+
+/*
+    Compare match period solver. Given a period in microseconds and the PCLK frequency in Hz, these expand to constant
+    expressions for the CKS and CMCOR values whose period is closest to it; ties go to the faster count clock. The
+    frequency may be a floating-point expression such as BSP_PCLKB_HZ and is truncated to whole Hz. Use
+    CMT_PERIOD_ASSERT once per channel to reject a period that no CKS setting can reach, or reaches only with an error
+    above the given tolerance.
+*/
+/* Count clock divisor for CKS[1:0] = cks */
+#define CMT_PERIOD_DIVISOR(cks)                 (8ULL << (2U * (cks)))
+
+/* Period in PCLK cycles, scaled by 10^6 so that it is exact */
+#define CMT_PERIOD_TARGET(us, hz)               ((unsigned long long)(us) * (unsigned long long)(hz))
+
+/* Count clocks per period at CKS = cks, rounded to nearest */
+#define CMT_PERIOD_COUNTS(us, hz, cks)          ((CMT_PERIOD_TARGET(us, hz) + (CMT_PERIOD_DIVISOR(cks) * 500000ULL)) / \
+                                                 (CMT_PERIOD_DIVISOR(cks) * 1000000ULL))
+#define CMT_PERIOD_FITS(us, hz, cks)            ((CMT_PERIOD_COUNTS(us, hz, cks) >= 1ULL) && \
+                                                 (CMT_PERIOD_COUNTS(us, hz, cks) <= 0x10000ULL))
+
+/* Period error at CKS = cks, in PCLK cycles scaled by 10^6; all ones when the period does not fit CMCOR */
+#define CMT_PERIOD_ACTUAL(us, hz, cks)          (CMT_PERIOD_COUNTS(us, hz, cks) * CMT_PERIOD_DIVISOR(cks) * 1000000ULL)
+#define CMT_PERIOD_ERROR(us, hz, cks)           ((!CMT_PERIOD_FITS(us, hz, cks)) ? 0xFFFFFFFFFFFFFFFFULL : \
+                                                 (CMT_PERIOD_ACTUAL(us, hz, cks) > CMT_PERIOD_TARGET(us, hz)) ? \
+                                                 (CMT_PERIOD_ACTUAL(us, hz, cks) - CMT_PERIOD_TARGET(us, hz)) : \
+                                                 (CMT_PERIOD_TARGET(us, hz) - CMT_PERIOD_ACTUAL(us, hz, cks)))
+
+/* Solution */
+#define CMT_PERIOD_CKS(us, hz)                  \
+    (((CMT_PERIOD_ERROR(us, hz, 0U) <= CMT_PERIOD_ERROR(us, hz, 1U)) && \
+      (CMT_PERIOD_ERROR(us, hz, 0U) <= CMT_PERIOD_ERROR(us, hz, 2U)) && \
+      (CMT_PERIOD_ERROR(us, hz, 0U) <= CMT_PERIOD_ERROR(us, hz, 3U))) ? 0U : \
+     ((CMT_PERIOD_ERROR(us, hz, 1U) <= CMT_PERIOD_ERROR(us, hz, 2U)) && \
+      (CMT_PERIOD_ERROR(us, hz, 1U) <= CMT_PERIOD_ERROR(us, hz, 3U))) ? 1U : \
+     (CMT_PERIOD_ERROR(us, hz, 2U) <= CMT_PERIOD_ERROR(us, hz, 3U)) ? 2U : 3U)
+#define CMT_PERIOD_CMCOR(us, hz)                (CMT_PERIOD_COUNTS(us, hz, CMT_PERIOD_CKS(us, hz)) - 1ULL)
+
+/* Whether the solution exists and is within ppm parts per million of the period (ppm below 500000) */
+#define CMT_PERIOD_VALID(us, hz, ppm)           (CMT_PERIOD_FITS(us, hz, CMT_PERIOD_CKS(us, hz)) && \
+                                                 ((CMT_PERIOD_ERROR(us, hz, CMT_PERIOD_CKS(us, hz)) * 1000000ULL) <= \
+                                                  (CMT_PERIOD_TARGET(us, hz) * (ppm))))
+
+/* Fails to compile (negative bit-field width) when CMT_PERIOD_VALID is false */
+#define CMT_PERIOD_ASSERT(name, us, hz, ppm)    \
+    typedef struct { unsigned int name : (CMT_PERIOD_VALID(us, hz, ppm) ? 1 : -1); } name##_t
+
 /* End user code. Do not edit comment generated here */
 #endif
 
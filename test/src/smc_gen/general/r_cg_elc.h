@@ -0,0 +1,90 @@
+/***********************************************************************************************************************
+* DISCLAIMER
+* This software is supplied by Renesas Electronics Corporation and is only intended for use with Renesas products.
+* No other uses are authorized. This software is owned by Renesas Electronics Corporation and is protected under all
+* applicable laws, including copyright laws. 
+* THIS SOFTWARE IS PROVIDED "AS IS" AND RENESAS MAKES NO WARRANTIES REGARDING THIS SOFTWARE, WHETHER EXPRESS, IMPLIED
+* OR STATUTORY, INCLUDING BUT NOT LIMITED TO WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NON-INFRINGEMENT.  ALL SUCH WARRANTIES ARE EXPRESSLY DISCLAIMED.TO THE MAXIMUM EXTENT PERMITTED NOT PROHIBITED BY
+* LAW, NEITHER RENESAS ELECTRONICS CORPORATION NOR ANY OF ITS AFFILIATED COMPANIES SHALL BE LIABLE FOR ANY DIRECT,
+* INDIRECT, SPECIAL, INCIDENTAL OR CONSEQUENTIAL DAMAGES FOR ANY REASON RELATED TO THIS SOFTWARE, EVEN IF RENESAS OR
+* ITS AFFILIATES HAVE BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+* Renesas reserves the right, without notice, to make changes to this software and to discontinue the availability 
+* of this software. By using this software, you agree to the additional terms and conditions found by accessing the 
+* following link:
+* http://www.renesas.com/disclaimer
+*
+* Copyright (C) 2016, 2017 Renesas Electronics Corporation. All rights reserved.
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* File Name    : r_cg_elc.h
+* Version      : 1.1.0
+* Device(s)    : R5F52318BxFP
+* Description  : General header file for ELC peripheral.
+* Creation Date: 2018-10-25
+***********************************************************************************************************************/
+
+#ifndef ELC_H
+#define ELC_H
+
+/***********************************************************************************************************************
+Macro definitions (Register bit)
+***********************************************************************************************************************/
+/*
+    Event Link Control Register (ELCR)
+*/
+/* All Event Link Enable (ELCON) */
+#define _00_ELC_LINK_DISABLE                    (0x00U) /* ELC function disabled */
+#define _80_ELC_LINK_ENABLE                     (0x80U) /* ELC function enabled */
+
+/*
+    Event Link Setting Register n (ELSRn)
+*/
+/* Event Link Select (ELS[7:0]) */
+#define _00_ELC_EVENT_NONE                      (0x00U) /* Event output to the module disabled */
+#define _1F_ELC_EVENT_CMT1_CMI1                 (0x1FU) /* CMT1 compare match 1 */
+#define _22_ELC_EVENT_TMR0_CMIA0                (0x22U) /* TMR0 compare match A0 */
+#define _23_ELC_EVENT_TMR0_CMIB0                (0x23U) /* TMR0 compare match B0 */
+#define _24_ELC_EVENT_TMR0_OVI0                 (0x24U) /* TMR0 overflow */
+
+/* ELSRn of the single port event destinations (ELSR24 and ELSR25 are port groups 1 and 2) */
+#define ELC_ELSR_SINGLE_PORT0                   (26U)
+#define ELC_ELSR_SINGLE_PORT1                   (27U)
+#define ELC_ELSR_SINGLE_PORT2                   (28U)
+#define ELC_ELSR_SINGLE_PORT3                   (29U)
+
+/*
+    Event Link Port Setting Register n (PELn)
+*/
+/* Port Bit Select (PSB[2:0]) */
+#define _00_ELC_PSB_0                           (0x00U) /* Bit 0 */
+#define _01_ELC_PSB_1                           (0x01U) /* Bit 1 */
+#define _02_ELC_PSB_2                           (0x02U) /* Bit 2 */
+#define _03_ELC_PSB_3                           (0x03U) /* Bit 3 */
+#define _04_ELC_PSB_4                           (0x04U) /* Bit 4 */
+#define _05_ELC_PSB_5                           (0x05U) /* Bit 5 */
+#define _06_ELC_PSB_6                           (0x06U) /* Bit 6 */
+#define _07_ELC_PSB_7                           (0x07U) /* Bit 7 */
+/* Port Group Select (PSP[1:0]); only PORTB and PORTE are linked to the ELC */
+#define _08_ELC_PSP_PORTB                       (0x08U) /* PORTB */
+#define _10_ELC_PSP_PORTE                       (0x10U) /* PORTE */
+/* Event Link Set Mode (PSM[1:0]) for output ports */
+#define _00_ELC_PSM_OUTPUT_LOW                  (0x00U) /* Output 0 on event */
+#define _20_ELC_PSM_OUTPUT_HIGH                 (0x20U) /* Output 1 on event */
+#define _40_ELC_PSM_OUTPUT_TOGGLE               (0x40U) /* Toggle output on event */
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Global functions
+***********************************************************************************************************************/
+/* Start user code for function. Do not edit comment generated here */
+/* End user code. Do not edit comment generated here */
+#endif
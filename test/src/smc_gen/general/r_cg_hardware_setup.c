@@ -37,6 +37,10 @@ Includes
 #include "r_cg_macrodriver.h"
 #include "Config_PORT.h"
 #include "Config_CMT0.h"
+#include "Config_CMT1.h"
+#include "Config_CMT2.h"
+#include "Config_TMR0.h"
+#include "Config_ELC.h"
 #include "r_smc_cgc.h"
 #include "r_smc_interrupt.h"
 /* Start user code for include. Do not edit comment generated here */
@@ -84,6 +88,10 @@ void R_Systeminit(void)
     /* Set peripheral settings */
     R_Config_PORT_Create();
     R_Config_CMT0_Create();
+    R_Config_CMT1_Create();
+    R_Config_CMT2_Create();
+    R_Config_TMR0_Create();
+    R_Config_ELC_Create();
 
     /* Set interrupt settings */
     R_Interrupt_Create();
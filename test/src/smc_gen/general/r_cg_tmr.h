@@ -0,0 +1,88 @@
+/***********************************************************************************************************************
+* DISCLAIMER
+* This software is supplied by Renesas Electronics Corporation and is only intended for use with Renesas products.
+* No other uses are authorized. This software is owned by Renesas Electronics Corporation and is protected under all
+* applicable laws, including copyright laws. 
+* THIS SOFTWARE IS PROVIDED "AS IS" AND RENESAS MAKES NO WARRANTIES REGARDING THIS SOFTWARE, WHETHER EXPRESS, IMPLIED
+* OR STATUTORY, INCLUDING BUT NOT LIMITED TO WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+* NON-INFRINGEMENT.  ALL SUCH WARRANTIES ARE EXPRESSLY DISCLAIMED.TO THE MAXIMUM EXTENT PERMITTED NOT PROHIBITED BY
+* LAW, NEITHER RENESAS ELECTRONICS CORPORATION NOR ANY OF ITS AFFILIATED COMPANIES SHALL BE LIABLE FOR ANY DIRECT,
+* INDIRECT, SPECIAL, INCIDENTAL OR CONSEQUENTIAL DAMAGES FOR ANY REASON RELATED TO THIS SOFTWARE, EVEN IF RENESAS OR
+* ITS AFFILIATES HAVE BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+* Renesas reserves the right, without notice, to make changes to this software and to discontinue the availability 
+* of this software. By using this software, you agree to the additional terms and conditions found by accessing the 
+* following link:
+* http://www.renesas.com/disclaimer
+*
+* Copyright (C) 2016, 2017 Renesas Electronics Corporation. All rights reserved.
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+* File Name    : r_cg_tmr.h
+* Version      : 1.1.0
+* Device(s)    : R5F52318BxFP
+* Description  : General header file for TMR peripheral.
+* Creation Date: 2018-10-25
+***********************************************************************************************************************/
+
+#ifndef TMR_H
+#define TMR_H
+
+/***********************************************************************************************************************
+Macro definitions (Register bit)
+***********************************************************************************************************************/
+/*
+    Timer Counter Control Register (TCR)
+*/
+/* Compare Match Interrupt Enable B (CMIEB) */
+#define _00_TMR_CMIB_INT_DISABLE                (0x00U) /* Compare match B interrupt (CMIBn) disable */
+#define _80_TMR_CMIB_INT_ENABLE                 (0x80U) /* Compare match B interrupt (CMIBn) enable */
+/* Compare Match Interrupt Enable A (CMIEA) */
+#define _00_TMR_CMIA_INT_DISABLE                (0x00U) /* Compare match A interrupt (CMIAn) disable */
+#define _40_TMR_CMIA_INT_ENABLE                 (0x40U) /* Compare match A interrupt (CMIAn) enable */
+/* Timer Overflow Interrupt Enable (OVIE) */
+#define _00_TMR_OVI_INT_DISABLE                 (0x00U) /* Overflow interrupt (OVIn) disable */
+#define _20_TMR_OVI_INT_ENABLE                  (0x20U) /* Overflow interrupt (OVIn) enable */
+/* Counter Clear (CCLR[1:0]) */
+#define _00_TMR_CNT_CLR_DISABLE                 (0x00U) /* Clearing is disabled */
+#define _08_TMR_CNT_CLR_COMP_MATCH_A            (0x08U) /* Cleared by compare match A */
+#define _10_TMR_CNT_CLR_COMP_MATCH_B            (0x10U) /* Cleared by compare match B */
+#define _18_TMR_CNT_CLR_TMRI                    (0x18U) /* Cleared by the external reset input */
+
+/*
+    Timer Control/Status Register (TCSR)
+*/
+/* Output Select A (OSA[1:0]) */
+#define _00_TMR_COMP_MATCH_OUTPUT_A_NO          (0x00U) /* No change on compare match A */
+/* Output Select B (OSB[1:0]) */
+#define _00_TMR_COMP_MATCH_OUTPUT_B_NO          (0x00U) /* No change on compare match B */
+
+/*
+    Timer Counter Control Register (TCCR)
+*/
+/* Clock Source Select (CSS[1:0]) and Clock Select (CKS[2:0]) */
+#define _00_TMR_CLK_DISABLED                    (0x00U) /* Clock input disabled */
+#define _08_TMR_CLK_SRC_PCLK                    (0x08U) /* Internal clock, divided as CKS[2:0] */
+#define _18_TMR_CLK_TMR1_OVRF                   (0x18U) /* TMR0: counts on TMR1.TCNT overflow (16-bit mode) */
+#define _00_TMR_PCLK_DIV_1                      (0x00U) /* PCLK */
+#define _01_TMR_PCLK_DIV_2                      (0x01U) /* PCLK/2 */
+#define _02_TMR_PCLK_DIV_8                      (0x02U) /* PCLK/8 */
+#define _03_TMR_PCLK_DIV_32                     (0x03U) /* PCLK/32 */
+#define _04_TMR_PCLK_DIV_64                     (0x04U) /* PCLK/64 */
+#define _05_TMR_PCLK_DIV_1024                   (0x05U) /* PCLK/1024 */
+#define _06_TMR_PCLK_DIV_8192                   (0x06U) /* PCLK/8192 */
+
+/***********************************************************************************************************************
+Macro definitions
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Typedef definitions
+***********************************************************************************************************************/
+
+/***********************************************************************************************************************
+Global functions
+***********************************************************************************************************************/
+/* Start user code for function. Do not edit comment generated here */
+/* End user code. Do not edit comment generated here */
+#endif
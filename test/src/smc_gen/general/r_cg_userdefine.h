@@ -32,6 +32,8 @@
 Includes
 ***********************************************************************************************************************/
 /* Start user code for include. Do not edit comment generated here */
+#include "r_port.h"
+#include "r_pin.h"
 /* End user code. Do not edit comment generated here */
 
 /***********************************************************************************************************************
@@ -42,6 +44,15 @@ Macro definitions (Register bit)
 #define LED0	PORTD.PODR.BIT.B7
 #define LED1	PORTD.PODR.BIT.B6
 
+/* LED pins for the r_pin macros. */
+#define LED0_IO		D, 7
+#define LED1_IO		D, 6
+
+/* LED pins for the r_port API, which must be used for PORTD after R_PORT_Open(). */
+#define LED_PORT	PORT_ID_D
+#define LED0_PIN	R_PIN_MASK(LED0_IO)
+#define LED1_PIN	R_PIN_MASK(LED1_IO)
+
 /* End user code. Do not edit comment generated here */
 
 /***********************************************************************************************************************
@@ -34,6 +34,10 @@ Includes
 #include "r_cg_macrodriver.h"
 #include "Config_PORT.h"
 #include "Config_CMT0.h"
+#include "Config_CMT1.h"
+#include "Config_CMT2.h"
+#include "Config_TMR0.h"
+#include "Config_ELC.h"
 
 /***********************************************************************************************************************
 Macro definitions (Register bit)
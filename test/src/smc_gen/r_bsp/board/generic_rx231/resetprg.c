@@ -44,6 +44,21 @@ Includes   <System Includes> , "Project Includes"
 /* Define the target platform */
 #include    "platform.h"
 
+/* Boot timeline, with BOOTTIME_CFG_ENABLE */
+#include    "r_boottime.h"
+
+/* Section initialization, with INITSCT_CFG_ENABLE */
+#include    "r_initsct.h"
+
+/* Data retained over software and watchdog resets, with RETAIN_CFG_ENABLE */
+#include    "r_retain.h"
+
+/* Clock switch after the section initialization, with CLKSTAGE_CFG_ENABLE */
+#include    "r_clkstage.h"
+
+/* Clock registry, with CLOCK_CFG_ENABLE */
+#include    "r_clock.h"
+
 /* When using the user startup program, disable the following code. */
 #if (BSP_CFG_STARTUP_DISABLE == 0)
 
@@ -109,8 +124,10 @@ void PowerON_Reset_PC(void);
 
 /* Main program function declaration */
 void main(void);
+#if CLKSTAGE_CFG_ENABLE == 0
 static void operating_frequency_set(void);
 static void clock_source_select(void);
+#endif
 static void usb_lpc_clock_source_select(void);
 
 /***********************************************************************************************************************
@@ -166,9 +183,26 @@ void PowerON_Reset_PC(void)
 
     set_fpsw(FPSW_init | FPU_ROUND | FPU_DENOM);
     
+    /* Time the stages below from here. */
+    BOOTTIME_START();
+
+    /* The clock registry holds the reset clock until each switch below refreshes it. */
+    CLOCK_REFRESH();
+
     /* Switch to high-speed operation */
+#if CLKSTAGE_CFG_ENABLE == 1
+    /* Start the clock source only; the CPU stays on the LOCO until R_CLKSTAGE_Finish(). */
+    R_CLKSTAGE_Start();
+#else
     operating_frequency_set();
+    CLOCK_REFRESH();
+#endif
+    BOOTTIME_MARK(BOOTTIME_STAGE_CLOCK);
     usb_lpc_clock_source_select();
+    BOOTTIME_MARK(BOOTTIME_STAGE_USB_LPC);
+
+    /* Keep or clear the RETAIN section, which _INITSCT leaves alone, by the cause of this reset. */
+    RETAIN_OPEN();
 
     /* If the warm start Pre C runtime callback is enabled, then call it. */
 #if BSP_CFG_USER_WARM_START_CALLBACK_PRE_INITC_ENABLED == 1
@@ -176,26 +210,44 @@ void PowerON_Reset_PC(void)
 #endif
 
     /* Initialize C runtime environment */
+#if INITSCT_CFG_ENABLE == 1
+    R_INITSCT_Run();
+#else
     _INITSCT();
+#endif
 
     /* If the warm start Post C runtime callback is enabled, then call it. */
 #if BSP_CFG_USER_WARM_START_CALLBACK_POST_INITC_ENABLED == 1
      BSP_CFG_USER_WARM_START_POST_C_FUNCTION();
 #endif
+    BOOTTIME_MARK(BOOTTIME_STAGE_INITSCT);
+    CLKSTAGE_POLL();
 
 #if BSP_CFG_IO_LIB_ENABLE == 1
     /* Comment this out if not using I/O lib */
     _INIT_IOLIB();
+    BOOTTIME_MARK(BOOTTIME_STAGE_IOLIB);
 #endif
 
     /* Initialize MCU interrupt callbacks. */
     bsp_interrupt_open();
+    BOOTTIME_MARK(BOOTTIME_STAGE_INTERRUPT);
 
     /* Initialize register protection functionality. */
     bsp_register_protect_open();
+    BOOTTIME_MARK(BOOTTIME_STAGE_PROTECT);
+
+#if CLKSTAGE_CFG_ENABLE == 1
+    /* hardware_setup() depends on the clock, so switch to the clock source now that the waits have overlapped the
+       stages above. */
+    R_CLKSTAGE_Finish();
+    CLOCK_REFRESH();
+    BOOTTIME_MARK(BOOTTIME_STAGE_SWITCH);
+#endif
 
     /* Configure the MCU and board hardware */
     hardware_setup();
+    BOOTTIME_MARK(BOOTTIME_STAGE_HARDWARE);
 
     /* Change the MCU's user mode from supervisor to user */
     nop();
@@ -234,6 +286,7 @@ void PowerON_Reset_PC(void)
 * Arguments    : none
 * Return value : none
 ***********************************************************************************************************************/
+#if CLKSTAGE_CFG_ENABLE == 0
 static void operating_frequency_set (void)
 {
     /* Used for constructing value to write to SCKCR register. */
@@ -579,6 +632,7 @@ static void clock_source_select (void)
     #error "Error! Invalid setting for BSP_CFG_CLOCK_SOURCE in r_bsp_config.h"
 #endif 
 }
+#endif /* CLKSTAGE_CFG_ENABLE == 0 */
 
 
 /***********************************************************************************************************************
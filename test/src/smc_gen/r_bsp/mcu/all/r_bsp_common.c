@@ -43,17 +43,21 @@ Includes   <System Includes> , "Project Includes"
 /* Get information about current board and MCU. */
 #include "platform.h"
 
+/* Clock registry, with CLOCK_CFG_ENABLE */
+#include "r_clock.h"
+
 /***********************************************************************************************************************
 Macro definitions
 ***********************************************************************************************************************/
-#ifdef __RXV1
-#define CPU_CYCLES_PER_LOOP    (5)    // Known number of CPU cycles required to execute the delayWait() loop
-#else
-#define CPU_CYCLES_PER_LOOP    (4)
-#endif
+#define CPU_CYCLES_PER_LOOP    (BSP_DELAY_LOOP_CYCLES)      // Known number of CPU cycles of the delayWait() loop
 
-#define OVERHEAD_CYCLES        (2)    // R_BSP_SoftwareDelay() overhead per call
-#define OVERHEAD_CYCLES_64     (2)    // R_BSP_SoftwareDelay() overhead per call using 64-bit ints
+#define OVERHEAD_CYCLES        (BSP_DELAY_OVERHEAD_CYCLES)  // R_BSP_SoftwareDelay() overhead per call
+#define OVERHEAD_CYCLES_64     (BSP_DELAY_OVERHEAD_CYCLES)  // R_BSP_SoftwareDelay() overhead per call using 64-bit ints
+
+/* The overhead in delayWait() loops, in 32.32 fixed point as the clock registry's delay rates. */
+#define OVERHEAD_LOOPS         (OVERHEAD_CYCLES / CPU_CYCLES_PER_LOOP)
+#define OVERHEAD_LOOPS_FRAC    \
+    ((uint32_t)(((uint64_t)(OVERHEAD_CYCLES % CPU_CYCLES_PER_LOOP) << 32) / CPU_CYCLES_PER_LOOP))
 
 #define CKSEL_LOCO             (0x0)  // SCKCR3 register setting for LOCO
 
@@ -94,6 +98,13 @@ uint32_t R_BSP_GetVersion (void)
 *              :
 * Return Value : None
 ***********************************************************************************************************************/
+#if defined(RX_HOST_BUILD)
+static void delayWait (unsigned long loop_cnt)
+{
+    /* Host build: charge the cycles the loop would take to the MCU model. */
+    rx_host_delay((uint64_t)loop_cnt * CPU_CYCLES_PER_LOOP);
+}
+#else
 #pragma inline_asm delayWait
 static void delayWait (unsigned long loop_cnt)
 {
@@ -104,6 +115,7 @@ static void delayWait (unsigned long loop_cnt)
     SUB #01H, R1
     BNE ?-
 }
+#endif
 
 
 /***********************************************************************************************************************
@@ -114,7 +126,11 @@ static void delayWait (unsigned long loop_cnt)
 ***********************************************************************************************************************/
 uint32_t R_BSP_GetIClkFreqHz(void)
 {
+#if CLOCK_CFG_ENABLE == 1
+    return R_CLOCK_GetHz(CLOCK_ICLK);  // Decoded once per clock change
+#else
     return get_iclk_freq_hz();  // Get the MCU specific ICLK frequency
+#endif
 }
 
 
@@ -135,6 +151,41 @@ uint32_t R_BSP_GetIClkFreqHz(void)
 ***********************************************************************************************************************/
 bool R_BSP_SoftwareDelay(uint32_t delay, bsp_delay_units_t units)
 {
+#if CLOCK_CFG_ENABLE == 1
+    const clock_rate_t *p_rate;
+    uint64_t           frac_loops;
+    uint64_t           loop_cnt_64;
+
+    p_rate = R_CLOCK_GetDelayRate((uint32_t)units);  // Loops per unit at the current ICLK, NULL for invalid units
+    if (NULL == p_rate)
+    {
+        return(false);
+    }
+
+    /*
+     * loops = delay * rate - overhead, in 32.32 fixed point. The rate was worked out when the clock last changed, so
+     * this takes two 32 x 32-bit multiplies (EMULU) and no division. The rate's fraction is rounded down, which can
+     * make the count one loop short of the division's.
+     */
+    loop_cnt_64 = (uint64_t)delay * p_rate->whole;
+    frac_loops = (uint64_t)delay * p_rate->frac;
+    loop_cnt_64 += (frac_loops >> 32) - OVERHEAD_LOOPS;
+    if ((uint32_t)frac_loops < OVERHEAD_LOOPS_FRAC)
+    {
+        loop_cnt_64--;
+    }
+
+    if ((loop_cnt_64 > 0xFFFFFFFFULL) || (loop_cnt_64 == 0))
+    {
+        /* The requested delay is too large/small for the current ICLK (a short delay wraps around below zero).
+         * Return false which also results in the minimum possible delay. */
+        return(false);
+    }
+
+    delayWait((unsigned long)loop_cnt_64);
+
+    return(true);
+#else
     volatile uint32_t iclkRate;
     volatile uint32_t delay_cycles;
     volatile uint32_t loop_cnt;
@@ -209,4 +260,29 @@ bool R_BSP_SoftwareDelay(uint32_t delay, bsp_delay_units_t units)
     delayWait(loop_cnt);
 
     return(true);
+#endif
+}
+
+/***********************************************************************************************************************
+* Function Name: R_BSP_SoftwareDelayLoops
+* Description  : Delay for a loop count worked out at compile time, by R_BSP_SOFTWARE_DELAY().
+* Arguments    : uint32_t loops  - BSP_DELAY_LOOPS(delay, units): the loop count at BSP_ICLK_HZ
+*              : uint32_t delay  - the number of 'units' to delay
+*              : bsp_delay_units_t units - the 'base' for the units specified
+*
+*                At BSP_ICLK_HZ the loop count is used as it is. At any other ICLK, such as the LOCO before the
+*                clock is switched, or if the count is 0, it is R_BSP_SoftwareDelay(delay, units).
+*
+* Return Value : true if delay executed.
+*                false if delay/units combination resulted in overflow or the delay cannot be achieved
+***********************************************************************************************************************/
+bool R_BSP_SoftwareDelayLoops(uint32_t loops, uint32_t delay, bsp_delay_units_t units)
+{
+    if ((0 != loops) && (R_BSP_GetIClkFreqHz() == (uint32_t)BSP_ICLK_HZ))
+    {
+        delayWait(loops);
+        return(true);
+    }
+
+    return R_BSP_SoftwareDelay(delay, units);
 }
@@ -71,6 +71,27 @@ Macro definitions
 #define R_BSP_VERSION_MAJOR           (3)
 #define R_BSP_VERSION_MINOR           (80)
 
+/* CPU cycles of one delayWait() loop, and of R_BSP_SoftwareDelay() around the loop. */
+#ifdef __RXV1
+#define BSP_DELAY_LOOP_CYCLES         (5)
+#else
+#define BSP_DELAY_LOOP_CYCLES         (4)
+#endif
+#define BSP_DELAY_OVERHEAD_CYCLES     (2)
+
+/* Loop count of a constant delay at BSP_ICLK_HZ, for R_BSP_SoftwareDelayLoops(): a constant expression, 0 if the delay
+ * is too short or too long for a loop count. */
+#define BSP_DELAY_CYCLES(delay, units)  (((uint64_t)BSP_ICLK_HZ * (uint64_t)(delay)) / (uint64_t)(units))
+#define BSP_DELAY_LOOPS_64(delay, units) \
+    ((BSP_DELAY_CYCLES((delay), (units)) - BSP_DELAY_OVERHEAD_CYCLES) / BSP_DELAY_LOOP_CYCLES)
+#define BSP_DELAY_LOOPS(delay, units)   \
+    ((BSP_DELAY_CYCLES((delay), (units)) <= BSP_DELAY_OVERHEAD_CYCLES) ? 0UL : \
+     (BSP_DELAY_LOOPS_64((delay), (units)) > 0xFFFFFFFFULL) ? 0UL : (uint32_t)BSP_DELAY_LOOPS_64((delay), (units)))
+
+/* R_BSP_SoftwareDelay() for a constant delay: no arithmetic at run time while ICLK is BSP_ICLK_HZ. */
+#define R_BSP_SOFTWARE_DELAY(delay, units)  \
+    R_BSP_SoftwareDelayLoops(BSP_DELAY_LOOPS((delay), (units)), (delay), (units))
+
 /***********************************************************************************************************************
 Typedef definitions
 ***********************************************************************************************************************/
@@ -94,6 +115,7 @@ Exported global functions (to be accessed by other files)
 ***********************************************************************************************************************/
 uint32_t R_BSP_GetVersion(void);
 bool R_BSP_SoftwareDelay(uint32_t delay, bsp_delay_units_t units);
+bool R_BSP_SoftwareDelayLoops(uint32_t loops, uint32_t delay, bsp_delay_units_t units);
 uint32_t R_BSP_GetIClkFreqHz(void);
 
 
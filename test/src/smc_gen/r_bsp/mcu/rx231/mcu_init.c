@@ -88,6 +88,14 @@ Macro definitions
 /***********************************************************************************************************************
 Typedef definitions
 ***********************************************************************************************************************/
+/* The PDR registers of ports 0 to J are consecutive bytes from PORT0.PDR, with gaps where a port does not exist. PDR
+ * is an 8-bit register (I/O register list), so each port takes one byte read-modify-write.
+ */
+typedef struct st_bsp_prv_ne_pdr
+{
+    uint8_t     offset;     /* Offset of the PDR from PORT0.PDR */
+    uint8_t     mask;       /* Missing pins of the port, ORed into its PDR */
+} bsp_prv_ne_pdr_t;
 
 /***********************************************************************************************************************
 Exported global variables (to be accessed by other files)
@@ -96,6 +104,23 @@ Exported global variables (to be accessed by other files)
 /***********************************************************************************************************************
 Private global variables and functions
 ***********************************************************************************************************************/
+#if (BSP_PACKAGE_PINS != 100)
+static const bsp_prv_ne_pdr_t s_ne_pdr[] =
+{
+    { 0x00, BSP_PRV_PORT0_NE_PIN_MASK },
+    { 0x01, BSP_PRV_PORT1_NE_PIN_MASK },
+    { 0x02, BSP_PRV_PORT2_NE_PIN_MASK },
+    { 0x03, BSP_PRV_PORT3_NE_PIN_MASK },
+    { 0x04, BSP_PRV_PORT4_NE_PIN_MASK },
+    { 0x05, BSP_PRV_PORT5_NE_PIN_MASK },
+    { 0x0A, BSP_PRV_PORTA_NE_PIN_MASK },
+    { 0x0B, BSP_PRV_PORTB_NE_PIN_MASK },
+    { 0x0C, BSP_PRV_PORTC_NE_PIN_MASK },
+    { 0x0D, BSP_PRV_PORTD_NE_PIN_MASK },
+    { 0x0E, BSP_PRV_PORTE_NE_PIN_MASK },
+    { 0x12, BSP_PRV_PORTJ_NE_PIN_MASK }
+};
+#endif
 
 /***********************************************************************************************************************
 * Function Name: bsp_non_existent_port_init
@@ -108,19 +133,14 @@ Private global variables and functions
 void bsp_non_existent_port_init (void)
 {
 #if (BSP_PACKAGE_PINS != 100)
+    volatile uint8_t *p_pdr = &PORT0.PDR.BYTE;
+    uint32_t         i;
+
     /* OR in missing pin masks from above. */
-    PORT0.PDR.BYTE |= BSP_PRV_PORT0_NE_PIN_MASK;
-    PORT1.PDR.BYTE |= BSP_PRV_PORT1_NE_PIN_MASK;
-    PORT2.PDR.BYTE |= BSP_PRV_PORT2_NE_PIN_MASK;
-    PORT3.PDR.BYTE |= BSP_PRV_PORT3_NE_PIN_MASK;
-    PORT4.PDR.BYTE |= BSP_PRV_PORT4_NE_PIN_MASK;
-    PORT5.PDR.BYTE |= BSP_PRV_PORT5_NE_PIN_MASK;
-    PORTA.PDR.BYTE |= BSP_PRV_PORTA_NE_PIN_MASK;
-    PORTB.PDR.BYTE |= BSP_PRV_PORTB_NE_PIN_MASK;
-    PORTC.PDR.BYTE |= BSP_PRV_PORTC_NE_PIN_MASK;
-    PORTD.PDR.BYTE |= BSP_PRV_PORTD_NE_PIN_MASK;
-    PORTE.PDR.BYTE |= BSP_PRV_PORTE_NE_PIN_MASK;
-    PORTJ.PDR.BYTE |= BSP_PRV_PORTJ_NE_PIN_MASK;
+    for (i = 0; i < (sizeof(s_ne_pdr) / sizeof(s_ne_pdr[0])); i++)
+    {
+        p_pdr[s_ne_pdr[i].offset] |= s_ne_pdr[i].mask;
+    }
 #endif
 }
 
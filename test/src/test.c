@@ -8,6 +8,10 @@
 *
 ***********************************************************************/
 #include "r_smc_entry.h"
+#include "r_idle.h"
+#include "r_profile.h"
+#include "r_port.h"
+#include "r_deadline.h"
 
 void main(void);
 void UserInit(void);
@@ -16,15 +20,20 @@ void main(void)
 {
 	UserInit();
 
-	while(1)
-	{
-		nop();
-		nop();
-		nop();
-	}
+	R_SCHED_SetIdleHook(R_IDLE_Enter);
+	R_SCHED_Run();
 }
 
 void UserInit(void)
 {
+	R_PORT_Open();
+	R_IDLE_Open(R_Config_CMT0_GetTicks64);
+	R_DEADLINE_Open(R_Config_CMT1_GetCount32, R_CLOCK_GetHz(CLOCK_PCLKB) / CMT1_COUNT_CLOCK_DIVISOR, CLOCK_PCLKB);
+#if PROFILE_CFG_ENABLE == 1
+	R_PROFILE_Open(R_Config_CMT1_GetCount32);
+#endif
+	R_Config_CMT1_Start();
+	R_Config_ELC_Start();
+	R_Config_TMR0_Start();
 	R_Config_CMT0_Start();
 }